@@ -0,0 +1,222 @@
+// ================================================================================================
+// Filename: "BotInput.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the AiInput and ScriptedInput classes. For a class
+// description see the header file "BotInput.h"
+// ================================================================================================
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <math.h>
+#include "BotInput.h"
+#include "Paddle.h"
+#include "Ball.h"
+
+// Initialize Static Constants
+const float AiInput::AIM_ERROR = (Paddle::HEIGHT * 0.6f);
+
+// ===== AiInput Constructor ======================================================================
+// The constructor will find where the player's paddle meets the ball.
+//
+// Input:
+//	[IN] int playerNumber	- the player the bot plays as, 1 or 2
+//
+// Output: none
+// ================================================================================================
+AiInput::AiInput(int playerNumber)
+{
+	m_playerNumber = playerNumber;
+	m_approaching = false;
+	m_aimOffset = 0;
+
+	if(m_playerNumber == 1)
+	{
+		m_paddleX = (float)(GameData::LEFT_GOAL_LINE + Paddle::WIDTH);
+	}
+	else
+	{
+		m_paddleX = (float)(GameData::RIGHT_GOAL_LINE - Paddle::WIDTH);
+	}
+}
+
+// ===== AiInput::NextDirection ===================================================================
+// Method will move the paddle toward where the ball will cross it, plus this approach's aim
+// offset, or toward the middle while the ball is heading away. Within a move of the target the
+// paddle is held still, so it doesn't jitter about it.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it
+//	[IN] float paddlePosition		- the center of the client's paddle
+//
+// Output:
+//	[OUT] int						- one of the Paddle::Direction values
+// ================================================================================================
+int AiInput::NextDirection(const GameData &gameState, float paddlePosition)
+{
+	float velocityX = (float)cos(gameState.ballAngle);
+	bool approaching = ((m_playerNumber == 1) ? (velocityX < 0) : (velocityX > 0));
+	float target = (GameData::BOARD_HEIGHT / 2.0f);
+
+	if(approaching && !m_approaching)
+	{
+		m_aimOffset = ((((float)rand() / RAND_MAX) * 2) - 1) * AIM_ERROR;
+	}
+
+	m_approaching = approaching;
+
+	if(approaching)
+	{
+		target = (PredictCrossing(gameState) + m_aimOffset);
+	}
+
+	if(target < (paddlePosition - Paddle::BASE_MOVE_RATE))
+	{
+		return Paddle::UP;
+	}
+	else if(target > (paddlePosition + Paddle::BASE_MOVE_RATE))
+	{
+		return Paddle::DOWN;
+	}
+
+	return Paddle::STILL;
+}
+
+// ===== AiInput::PredictCrossing =================================================================
+// Method will find the height the ball will be at when it reaches the paddle, following it in a
+// straight line and folding the line back at the top and bottom walls, as the ball bounces.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it
+//
+// Output:
+//	[OUT] float						- the height the ball will cross the paddle at
+// ================================================================================================
+float AiInput::PredictCrossing(const GameData &gameState)
+{
+	double velocityX = cos(gameState.ballAngle);
+	double velocityY = ((-1) * sin(gameState.ballAngle));
+	double low = Ball::RADIUS;
+	double span = (GameData::BOARD_HEIGHT - (2 * Ball::RADIUS));
+
+	if(fabs(velocityX) < 0.0001)
+	{
+		return gameState.ballY;
+	}
+
+	double height = (gameState.ballY + ((velocityY / velocityX) * (m_paddleX - gameState.ballX)));
+
+	// Fold into the board, the bounces mirror the line every span
+	height = fmod((height - low), (2 * span));
+
+	if(height < 0)
+	{
+		height += (2 * span);
+	}
+
+	if(height > span)
+	{
+		height = ((2 * span) - height);
+	}
+
+	return (float)(height + low);
+}
+
+// ===== ScriptedInput Default Constructor ========================================================
+// The default constructor will start with an empty script, which holds the paddle still.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ScriptedInput::ScriptedInput(void)
+{
+	m_step = 0;
+	m_ticksLeft = 0;
+}
+
+// ===== ScriptedInput::Load ======================================================================
+// Method will read a script from a file.
+//
+// Input:
+//	[IN] const std::string &path	- the script's file
+//
+// Output:
+//	[OUT] bool						- true if the script was read and has at least one step, false
+//									  otherwise
+// ================================================================================================
+bool ScriptedInput::Load(const std::string &path)
+{
+	std::ifstream file(path.c_str());
+	std::string line;
+
+	if(!file)
+	{
+		return false;
+	}
+
+	m_steps.clear();
+
+	while(std::getline(file, line))
+	{
+		std::stringstream lineStream(line);
+		std::string name;
+		Step step;
+
+		if(!(lineStream >> name) || (name[0] == '#') || !(lineStream >> step.ticks) || (step.ticks <= 0))
+		{
+			continue;
+		}
+
+		if(name == "UP")
+		{
+			step.direction = Paddle::UP;
+		}
+		else if(name == "DOWN")
+		{
+			step.direction = Paddle::DOWN;
+		}
+		else
+		{
+			step.direction = Paddle::STILL;
+		}
+
+		m_steps.push_back(step);
+	}
+
+	m_step = 0;
+	m_ticksLeft = (m_steps.empty() ? 0 : m_steps[0].ticks);
+
+	return !m_steps.empty();
+}
+
+// ===== ScriptedInput::NextDirection =============================================================
+// Method will give the direction of the step being played, and move on to the next step, starting
+// over at the end, once its' ticks are used up.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it, unused
+//	[IN] float paddlePosition		- the client's paddle, unused
+//
+// Output:
+//	[OUT] int						- one of the Paddle::Direction values
+// ================================================================================================
+int ScriptedInput::NextDirection(const GameData &gameState, float paddlePosition)
+{
+	if(m_steps.empty())
+	{
+		return Paddle::STILL;
+	}
+
+	int direction = m_steps[m_step].direction;
+
+	if(--m_ticksLeft <= 0)
+	{
+		m_step = ((m_step + 1) % m_steps.size());
+		m_ticksLeft = m_steps[m_step].ticks;
+	}
+
+	return direction;
+}
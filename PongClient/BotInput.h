@@ -0,0 +1,91 @@
+// ================================================================================================
+// Filename: "BotInput.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The AiInput and ScriptedInput classes are InputSources that need no player, for bots and tests.
+//
+// AiInput plays the game. When the ball is heading for its' side it works out where the ball will
+// cross its' paddle, bouncing off the top and bottom walls on the way, and moves there; otherwise
+// it drifts back to the middle. Each time the ball turns toward it, it picks a fresh aim somewhere
+// within AIM_ERROR of that point, so it sometimes misses, and games between bots end.
+//
+// ScriptedInput plays a script in a loop. A script is a text file of steps, one to a line, each a
+// direction and the number of ticks to hold it:
+//
+//		UP 30
+//		STILL 10
+//		DOWN 30
+//
+// Blank lines and lines starting with '#' are skipped.
+// ================================================================================================
+
+#ifndef BOTINPUT_H
+#define BOTINPUT_H
+
+#include <string>
+#include <vector>
+#include "InputSource.h"
+
+// ================================================================================================
+// AiInput - follows the ball
+// ================================================================================================
+class AiInput: public InputSource
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	AiInput(int playerNumber);
+	~AiInput(void){}
+
+	// Method Prototypes
+	int NextDirection(const GameData &gameState, float paddlePosition);
+
+	// Constants
+	static const float AIM_ERROR;		// Furthest, in pixels, the aim is from where the ball will cross
+
+private:
+
+	float PredictCrossing(const GameData &gameState);
+
+	int m_playerNumber;
+	float m_paddleX;					// Where the paddle's face meets the ball
+	bool m_approaching;					// The ball was heading for this side last tick
+	float m_aimOffset;					// Offset from the crossing picked for this approach
+};
+
+// ================================================================================================
+// ScriptedInput - repeats a script of directions
+// ================================================================================================
+class ScriptedInput: public InputSource
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	ScriptedInput(void);
+	~ScriptedInput(void){}
+
+	// Method Prototypes
+	bool Load(const std::string &path);
+	int NextDirection(const GameData &gameState, float paddlePosition);
+
+private:
+
+	// A direction and how many ticks to hold it
+	struct Step
+	{
+		int direction;
+		int ticks;
+	};
+
+	std::vector<Step> m_steps;
+	unsigned int m_step;				// The step being played
+	int m_ticksLeft;					// Ticks left in it
+};
+
+#endif
@@ -0,0 +1,298 @@
+// ================================================================================================
+// Filename: "BotRunner.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the BotRunner class. For a class description see the
+// header file "BotRunner.h"
+// ================================================================================================
+
+#include <iostream>
+#include "BotRunner.h"
+
+// Initialize Static Constants
+const double BotRunner::CONNECT_RATE = 5.0;
+const int BotRunner::CONNECT_BURST = 10;
+const int BotRunner::RETRY_INTERVAL = 1000;
+const int BotRunner::START_TIMEOUT = 30000;
+
+// ===== Constructor ==============================================================================
+// The constructor will keep what the bots are made from. Nothing connects until Run().
+//
+// Input:
+//	[IN] const ClientConfig *config						- the client's options, the number of bots
+//														  and their input source
+//	[IN] std::function<Transport*(void)> connector		- opens a connection to the server
+//	[IN] const sf::Clock *gameClock						- the process's clock, shared by every bot
+//
+// Output: none
+// ================================================================================================
+BotRunner::BotRunner(const ClientConfig *config, std::function<Transport*(void)> connector, const sf::Clock *gameClock)
+{
+	m_config = config;
+	m_connector = connector;
+	m_gameClock = gameClock;
+	m_tokens = CONNECT_BURST;
+	m_lastRefill = 0;
+	m_gamesFinished = 0;
+	m_connectionsLost = 0;
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will release every bot, engines before the connections they use.
+// ================================================================================================
+BotRunner::~BotRunner(void)
+{
+	for(std::vector<Bot>::iterator it = m_bots.begin(); it != m_bots.end(); it++)
+	{
+		delete it->engine;
+		delete it->input;
+		delete it->connection;
+	}
+}
+
+// ===== Run ======================================================================================
+// Method will connect the bots at the rate the server admits them, start each one's engine once
+// its' game starts, and drive the engines until every bot is done, then print how they finished.
+//
+// Input: none
+//
+// Output:
+//	[OUT] int	- the process exit code, 0 if every bot finished its' game
+// ================================================================================================
+int BotRunner::Run(void)
+{
+	NetTime tickTime = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+	NetTime now = TimeBase::Now(m_gameClock);
+	int active = m_config->bots;
+
+	m_bots.resize(m_config->bots);
+	m_lastRefill = now;
+
+	for(std::vector<Bot>::iterator it = m_bots.begin(); it != m_bots.end(); it++)
+	{
+		it->connection = NULL;
+		it->input = NULL;
+		it->engine = NULL;
+		it->state = QUEUED;
+		it->due = now;
+		it->deadline = 0;
+	}
+
+	while(active > 0)
+	{
+		NetTime sleepTime = tickTime;
+
+		now = TimeBase::Now(m_gameClock);
+
+		// Refill the Connection Tokens
+		m_tokens += (((now - m_lastRefill) / 1000000.0) * CONNECT_RATE);
+		m_lastRefill = now;
+
+		if(m_tokens > CONNECT_BURST)
+		{
+			m_tokens = CONNECT_BURST;
+		}
+
+		active = 0;
+
+		for(unsigned int i = 0; i < m_bots.size(); i++)
+		{
+			Bot &bot = m_bots[i];
+
+			if(bot.state == QUEUED)
+			{
+				if((now >= bot.due) && (m_tokens >= 1))
+				{
+					m_tokens -= 1;
+					Connect(bot, i, now);
+				}
+				else
+				{
+					NetTime wait = (bot.due - now);
+					NetTime tokenWait = (NetTime)(((1 - m_tokens) / CONNECT_RATE) * 1000000.0);
+
+					if(tokenWait > wait)
+					{
+						wait = tokenWait;
+					}
+
+					if(wait < sleepTime)
+					{
+						sleepTime = wait;
+					}
+				}
+			}
+			else if(bot.state == WAITING)
+			{
+				CheckStart(bot, i, now);
+			}
+
+			if(bot.state == RUNNING)
+			{
+				Drive(bot, sleepTime);
+			}
+
+			active += ((bot.state != DONE) ? 1 : 0);
+		}
+
+		if((active > 0) && (sleepTime > 0))
+		{
+			sf::sleep(sf::microseconds(sleepTime));
+		}
+	}
+
+	std::cout << "Bots: " << m_bots.size() << "  Games finished: " << m_gamesFinished
+			  << "  Connections lost: " << m_connectionsLost << "\n";
+
+	return (((m_gamesFinished == 0) || (m_connectionsLost > 0)) ? 1 : 0);
+}
+
+// ===== Connect ==================================================================================
+// Method will open a bot's connection, which sends its' JOIN. The bot's start deadline is set on
+// its' first attempt, so retries don't extend it. A bot that can't connect at all is lost.
+//
+// Input:
+//	[IN/OUT] Bot &bot	- the bot to connect
+//	[IN] int index		- the bot's index, for messages
+//	[IN] NetTime now	- the current game clock time
+//
+// Output: none
+// ================================================================================================
+void BotRunner::Connect(Bot &bot, int index, NetTime now)
+{
+	if(bot.deadline == 0)
+	{
+		bot.deadline = (now + TimeBase::FromMilliseconds(START_TIMEOUT));
+	}
+
+	Transport *transport = m_connector();
+
+	if(transport == NULL)
+	{
+		std::cout << "Bot " << index << " could not connect to the server.\n";
+		Lose(bot);
+		return;
+	}
+
+	bot.connection = new CNetworkController(transport, m_gameClock, m_connector, false);
+	bot.state = WAITING;
+}
+
+// ===== CheckStart ===============================================================================
+// Method will check on a bot waiting for its' game. Once the game has started the bot is given an
+// input source and a headless engine, and started. A bot the server turned away as rate limited or
+// busy goes back in the queue to try again; one turned away for anything else, whose connection
+// was lost, or that is past its' deadline, is lost.
+//
+// Input:
+//	[IN/OUT] Bot &bot	- the waiting bot
+//	[IN] int index		- the bot's index, for messages and its' input source
+//	[IN] NetTime now	- the current game clock time
+//
+// Output: none
+// ================================================================================================
+void BotRunner::CheckStart(Bot &bot, int index, NetTime now)
+{
+	if(bot.connection->ShouldStartGame())
+	{
+		bot.input = InputSource::Create(m_config, bot.connection->GetPlayerNumber(), index);
+
+		if(bot.input == NULL)
+		{
+			Lose(bot);
+			return;
+		}
+
+		bot.engine = new ClientEngine(bot.connection, m_config, bot.input);
+		bot.engine->Start();
+		bot.state = RUNNING;
+	}
+	else if(!bot.connection->IsConnected())
+	{
+		int reason = bot.connection->GetRejectReason();
+
+		if(((reason == GameData::RATE_LIMITED) || (reason == GameData::TOO_MANY_PENDING)) && (now < bot.deadline))
+		{
+			delete bot.connection;
+			bot.connection = NULL;
+			bot.state = QUEUED;
+			bot.due = (now + TimeBase::FromMilliseconds(RETRY_INTERVAL));
+			return;
+		}
+
+		if(reason != CNetworkController::NOT_REJECTED)
+		{
+			std::cout << "Bot " << index << " was rejected: " << CNetworkController::RejectReasonText((sf::Uint8)reason) << "\n";
+		}
+		else
+		{
+			std::cout << "Bot " << index << " lost its' connection before its' game started.\n";
+		}
+
+		Lose(bot);
+	}
+	else if(now >= bot.deadline)
+	{
+		std::cout << "Bot " << index << " was not in a game after " << (START_TIMEOUT / 1000) << " seconds.\n";
+		Lose(bot);
+	}
+}
+
+// ===== Drive ====================================================================================
+// Method will advance a running bot's engine, and bring the sleep time in to its' next tick. A bot
+// whose game is over is finished and counted.
+//
+// Input:
+//	[IN/OUT] Bot &bot				- the running bot
+//	[IN/OUT] NetTime &sleepTime		- the time until the soonest next tick, so far this pass
+//
+// Output: none
+// ================================================================================================
+void BotRunner::Drive(Bot &bot, NetTime &sleepTime)
+{
+	if(!bot.engine->Advance())
+	{
+		bot.engine->Finish();
+		bot.state = DONE;
+
+		if(bot.engine->IsGameWon())
+		{
+			m_gamesFinished++;
+		}
+		else
+		{
+			m_connectionsLost++;
+		}
+
+		return;
+	}
+
+	NetTime due = bot.engine->GetTimeToNextTick();
+
+	if(due < sleepTime)
+	{
+		sleepTime = due;
+	}
+}
+
+// ===== Lose =====================================================================================
+// Method will give up on a bot that never got into a game, closing its' connection so the server
+// doesn't hold a seat for it.
+//
+// Input:
+//	[IN/OUT] Bot &bot	- the bot to give up on
+//
+// Output: none
+// ================================================================================================
+void BotRunner::Lose(Bot &bot)
+{
+	delete bot.input;
+	delete bot.connection;
+
+	bot.input = NULL;
+	bot.connection = NULL;
+	bot.state = DONE;
+	m_connectionsLost++;
+}
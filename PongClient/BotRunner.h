@@ -0,0 +1,106 @@
+// ================================================================================================
+// Filename: "BotRunner.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The BotRunner class runs headless clients, as many as the ClientConfig's bots option asks for, in
+// one process, for bots, tests on a machine with no display, and load generation against a server.
+//
+// Every bot is a full client: a CNetworkController of its' own, a headless ClientEngine, and an
+// InputSource from the config, so the bots exercise the same network, prediction and
+// interpolation code a player's client does.
+//
+// The server only admits CONNECT_RATE new connections a second from one address, in bursts of
+// CONNECT_BURST, so the bots connect no faster than that, from a token bucket of their own. The
+// constants match the server's default -accept-rate and -accept-burst. A bot the server still turns
+// away as rate limited, or as having too many handshakes pending, tries again RETRY_INTERVAL later.
+// A bot that isn't in a started game START_TIMEOUT after its' first attempt, such as the odd one out
+// with no one to pair with, gives up and counts as lost.
+//
+// Everything is driven from the calling thread. Each pass connects the bots that are due, starts an
+// engine for every bot whose game has started, and advances every engine that is running, then
+// sleeps until the soonest next tick. Bots that are still connecting or waiting to be paired never
+// hold up the ones already playing. A bot costs no thread beyond its' connection's two, no window,
+// font or rendering, and only the time its' ticks take. The client links with a 256KB stack reserve
+// rather than the default 1MB, so those threads leave a 32-bit process the address space for about
+// a thousand bots; the x64 configuration has room for far more.
+// ================================================================================================
+
+#ifndef BOTRUNNER_H
+#define BOTRUNNER_H
+
+#include <vector>
+#include <functional>
+#include <SFML\System\Clock.hpp>
+#include "CNetworkController.h"
+#include "ClientEngine.h"
+#include "InputSource.h"
+#include "ClientConfig.h"
+#include "Transport.h"
+#include "NetTime.h"
+
+class BotRunner
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	BotRunner(const ClientConfig *config, std::function<Transport*(void)> connector, const sf::Clock *gameClock);
+	~BotRunner(void);
+
+	// Method Prototypes
+	int Run(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const double CONNECT_RATE;		// Connections a second, the server's default accept rate
+	static const int CONNECT_BURST;			// Connections at once, the server's default accept burst
+	static const int RETRY_INTERVAL;		// Time, in ms, before a rate limited bot tries again
+	static const int START_TIMEOUT;			// Time, in ms, a bot has to get into a started game
+
+private:
+
+	// Bot States
+	enum BotState {QUEUED, WAITING, RUNNING, DONE};
+
+	// A headless client and what it runs on
+	struct Bot
+	{
+		CNetworkController *connection;
+		InputSource *input;
+		ClientEngine *engine;
+		int state;						// One of the BotState values
+		NetTime due;					// When a queued bot may next try to connect
+		NetTime deadline;				// When a bot not yet running gives up
+	};
+
+	void Connect(Bot &bot, int index, NetTime now);
+	void CheckStart(Bot &bot, int index, NetTime now);
+	void Drive(Bot &bot, NetTime &sleepTime);
+	void Lose(Bot &bot);
+
+	const ClientConfig *m_config;
+	std::function<Transport*(void)> m_connector;
+	const sf::Clock *m_gameClock;
+	std::vector<Bot> m_bots;
+
+	// Connection Pacing
+	double m_tokens;					// Connections that may be made now
+	NetTime m_lastRefill;
+
+	// Results
+	int m_gamesFinished;				// Bots whose game was won by someone
+	int m_connectionsLost;				// Bots that lost their connection, or never started
+};
+
+#endif
@@ -10,44 +10,113 @@
 
 #include <iostream>
 #include <SFML\Network\Packet.hpp>
+#include <SFML\System\Sleep.hpp>
 #include <Windows.h>
 #include "TimeSync.h"
 #include "CNetworkController.h"
 #include "PaddleUpdate.h"
+#include "TcpTransport.h"
+#include "EmulatedTransport.h"
 
-const int CNetworkController::MAX_QUEUE = 1;
+// Initialize Static Constants
+const int CNetworkController::DEFAULT_IDLE_TIMEOUT = 5000;
+const int CNetworkController::RECONNECT_INTERVAL = 250;
+const int CNetworkController::NOT_REJECTED = -1;
 
 // ===== Constructor ==============================================================================
-// The constructor will attempt to establish a connection to the passed IP and port number. If
+// The constructor will attempt to establish a TCP connection to the passed IP and port number. If
 // successful, it will start the listening thread and set m_connected to true. If the connection
 // fails, it will not start the thread and will set m_connected to false.
 // 
 // Input:
 //	[IN] sf::ipAddress ipAddress	-	the IP address of the server
 //	[IN] int portNumber				-	the port number that the server is listening to
+//	[IN] sf::Clock *gameClock		-	the game engines clock
 //
 // Output: none
 //
 //  ===============================================================================================
 CNetworkController::CNetworkController(sf::IpAddress ipAddress, int portNumber, const sf::Clock *gameClock) : m_gameClock(gameClock)
 {
+	m_connector = [ipAddress, portNumber](){ return (Transport*)TcpTransport::Connect(ipAddress, portNumber); };
+	m_verbose = true;
+
 	// Attempt to establish connection
-	if (m_serverConnection.connect(ipAddress, portNumber) != sf::TcpSocket::Done)
+	Start(m_connector());
+}
+
+// ===== Constructor ==============================================================================
+// The constructor will use an already connected transport, such as one end of a LoopbackTransport
+// pair for a server in the same process. The CNetworkController takes ownership of the transport.
+// If a connector is passed, it will be used to reconnect and resume the session when the connection
+// is lost; without one, a lost connection ends the session. A quiet controller only prints errors,
+// not its' progress through the handshake or a resume.
+// 
+// Input:
+//	[IN] Transport *transport					-	the connected transport
+//	[IN] sf::Clock *gameClock					-	the game engines clock
+//	[IN] std::function<Transport*()> connector	-	opens a new connection to the same server
+//	[IN] bool verbose							-	false to keep the progress messages quiet
+//
+// Output: none
+//
+//  ===============================================================================================
+CNetworkController::CNetworkController(Transport *transport, const sf::Clock *gameClock,
+									   std::function<Transport*(void)> connector, bool verbose) : m_gameClock(gameClock)
+{
+	m_connector = connector;
+	m_verbose = verbose;
+
+	Start(transport);
+}
+
+// ===== Start ====================================================================================
+// Method will send a JOIN and start the listening and outgoing threads if the transport is
+// connected. A new connection always opens with a JOIN; only a reconnection in Resume() sends a
+// RESUME.
+//
+// Input:
+//	[IN] Transport *transport		-	the connected transport, or NULL if the connection failed
+//
+// Output: none
+// ================================================================================================
+void CNetworkController::Start(Transport *transport)
+{
+	m_transport = transport;
+	m_startGame = false;
+	m_netSeed = 0;
+	m_downTraceLength = 0;
+	m_rejectReason = NOT_REJECTED;
+	m_idleTimeout = DEFAULT_IDLE_TIMEOUT;
+	m_sessionToken = 0;
+	m_resumeGrace = 0;
+	m_serverSyncPoint = 0;
+	m_clockEstimate.offset = 0;
+	m_clockEstimate.uncertainty = 0;
+	m_clockEstimate.roundTripTime = 0;
+	m_clockEstimate.reference = 0;
+	m_clockEstimate.skew = 0;
+	m_clockEstimate.valid = false;
+
+	if (m_transport == NULL)
 	{
 		// Error Starting Connection
 		m_connected = false;
-		m_startGame = false;
 		m_listeningThread = NULL;
 		m_outThread = NULL;
 	}
 	else
 	{
-		// Connection established; Start thread
+		// Connection established; Join the server and start thread
+		sf::Packet joinPacket;
+		sf::Uint8 cmdCode = GameData::JOIN;
+
+		joinPacket << cmdCode;
+		SendPacket(joinPacket);
+
 		m_connected = true;
-		m_startGame = false;
 		m_listeningThread = new std::thread(&CNetworkController::SocketListening, this);
 		m_outThread = new std::thread(&CNetworkController::SendOutThread, this);
-		m_artificialLatency = 0;
 	}
 }
 
@@ -56,10 +125,22 @@ CNetworkController::CNetworkController(sf::IpAddress ipAddress, int portNumber,
 // ================================================================================================
 CNetworkController::~CNetworkController()
 {
+	m_connected = false;	// Stops the listening thread from trying to resume
+
+	m_transportLock.lock();
+
+	if (m_transport != NULL)
+	{
+		m_transport->Disconnect();	// Wakes the blocked listening thread
+	}
+
+	m_transportLock.unlock();
+
 	StopThread();
 	StopOutgoingThread();
 	delete m_listeningThread;
 	delete m_outThread;
+	delete m_transport;
 }
 
 // ===== StopThread ===============================================================================
@@ -88,32 +169,36 @@ void CNetworkController::StopOutgoingThread()
 	if (m_outThread != NULL)
 	{
 		m_connected = false;	// Set Thread-Loop conditional to false
+		WakeWaiters();
 		m_outThread->join();	// Wait for thread to end
 	}
 }
 
 // ===== SendPaddleUpdate =========================================================================
 // This method will take the clients paddle information and package it along with a timestamp. Once
-// packaged, the method will send the packet through the m_serverConnection.
+// packaged, the method will send the packet through the m_transport.
 //
 // Input: 
-//	[IN] double yLocation	- the current Y-Coordinate of the top of the paddle
-//	[IN] int direction		- an int representing the direction the paddle is currently moving
+//	[IN] sf::Uint32 sequence	- the input's sequence number, one more than the last update's
+//	[IN] double yLocation		- the predicted Y-Coordinate of the center of the paddle
+//	[IN] int direction			- an int representing the direction the paddle is currently moving
 //
 // Output: none
 // ================================================================================================
-void CNetworkController::SendPaddleUpdate(float yLocation, int direction)
+void CNetworkController::SendPaddleUpdate(sf::Uint32 sequence, float yLocation, int direction)
 {
 	sf::Uint8 commandCode = GameData::PADDLE_UPDATE;
 
 	PaddleUpdate update;
+	update.m_sequence = sequence;
 	update.m_paddleLoc = yLocation;
 	update.m_paddleDir = direction;
-	update.m_timestamp = m_gameClock->getElapsedTime().asMilliseconds();
+	update.m_timestamp = TimeBase::Now(m_gameClock);
 
 	sf::Packet dataPacket;
 
 	dataPacket << commandCode << update;
+	m_telemetry.Stamp(dataPacket, update.m_timestamp);
 
 	SendPacket(dataPacket);
 }
@@ -121,69 +206,190 @@ void CNetworkController::SendPaddleUpdate(float yLocation, int direction)
 // ===== SocketListening ==========================================================================
 // This method will loop while connected to the server. When a packet is received, the method
 // will check the command code and handle the data accordingly. The only two command codes that
-// should be received by a client, are GAME_UPDATE and TIME_SYNC.
+// should be received by a client, are GAME_UPDATE and TIME_SYNC, along with the server's
+// HEARTBEATs, which are echoed back.
 //
-// The SocketListening thread will wait m_artificialLatency when it receives a packet.
+// The INITIALIZE packet carries the down link of the server's network profile. If it changes
+// packets at all, the transport is wrapped so everything received after it crosses the link. When
+// the server is replaying a trace, the down half of it follows in NET_TRACE packets and the
+// transport is wrapped once the last of them has arrived.
+//
+// The full server time in INITIALIZE and in each TIME_SYNC request is the sync point used to
+// expand the compact times in GAME_UPDATEs. The INITIALIZE also carries the idle timeout and the
+// session token a lost connection is resumed with.
+//
+// If no packet arrives within the idle timeout, the server is considered lost and the thread ends.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void CNetworkController::SocketListening(void)
 {
-	sf::TcpSocket::Status receiveStatus;
+	sf::Socket::Status receiveStatus;
 	sf::Packet receivedPacket;
 	sf::Uint8 cmdCode;
 
 	while (m_connected)
 	{
-		receiveStatus = m_serverConnection.receive(receivedPacket);	// Blocking
+		receiveStatus = m_transport->Receive(receivedPacket, sf::milliseconds(m_idleTimeout));
 
-		if(receiveStatus == sf::TcpSocket::Done)
+		if(receiveStatus == sf::Socket::Done)
 		{
 			receivedPacket >> cmdCode;
 
 			if(cmdCode == GameData::INITIALIZE)
 			{
-				std::cout << "Received Init Packet\n";
+				if(m_verbose)
+				{
+					std::cout << "Received Init Packet\n";
+				}
+
 				sf::Uint8 player;
-				sf::Uint32 latency;
+				sf::Uint32 netSeed;
+				sf::Uint32 traceLength;
+				sf::Uint32 idleTimeout;
+				sf::Uint32 sessionToken;
+				sf::Uint32 resumeGrace;
 
-				receivedPacket >> player >> latency;
+				receivedPacket >> player >> m_downLink >> netSeed >> traceLength >> idleTimeout >> sessionToken >> resumeGrace;
+				TimeBase::Read(receivedPacket, m_serverSyncPoint);
 
 				m_playerNum = player;
-				m_artificialLatency = latency;
+				m_netSeed = netSeed;
+				m_idleTimeout = idleTimeout;
+				m_sessionToken = sessionToken;
+				m_resumeGrace = resumeGrace;
+
+				m_downTrace.clear();
+				m_downTraceLength = traceLength;
+
+				if(m_downTraceLength == 0)
+				{
+					m_transportLock.lock();
+
+					m_transport = EmulateLink(m_transport);
+
+					m_transportLock.unlock();
+				}
+
+				if(m_verbose)
+				{
+					std::cout << "Assigned as Player: " << m_playerNum << " Emulating down link latency: "
+							  << m_downLink.latency << "ms\n";
+				}
+			}
+			else if(cmdCode == GameData::NET_TRACE)
+			{
+				sf::Uint16 count = 0;
+				TraceSample sample;
+
+				receivedPacket >> count;
+
+				for(int i = 0; (i < count) && (receivedPacket >> sample); i++)
+				{
+					m_downTrace.push_back(sample);
+				}
+
+				if(m_downTrace.size() == m_downTraceLength)
+				{
+					m_transportLock.lock();
 
-				std::cout << "Assigned as Player: " << m_playerNum << " Latency set at: " << m_artificialLatency << "ms\n";
+					m_transport = EmulateLink(m_transport);
+
+					m_transportLock.unlock();
+
+					if(m_verbose)
+					{
+						std::cout << "Replaying down link trace of " << m_downTraceLength << " samples\n";
+					}
+				}
 			}
 			else if(cmdCode == GameData::GAME_UPDATE)
 			{
 				GameData newData;
-				receivedPacket >> newData;
+				NetTime arrival = TimeBase::Now(m_gameClock);
+				NetTime serverSendTime = 0;
+				sf::Uint8 precision = GameData::FULL_PRECISION;
+
+				receivedPacket >> precision;
+				GameData::Read(receivedPacket, newData, precision);
+				newData.serverTime = TimeBase::Expand(newData.serverTime, m_serverSyncPoint);
 
-				if(!m_startGame)
+				if(m_telemetry.Read(receivedPacket, arrival, m_serverSyncPoint, serverSendTime))
 				{
-					m_startGame = newData.startGame;	// Check for GameStart Command
+					ClockEstimate estimate = GetClockEstimate();
+
+					if(estimate.valid)
+					{
+						m_telemetry.AddOneWayDelay(estimate.ToServerTime(arrival) - serverSendTime);
+					}
 				}
 
+				bool started = (!m_startGame && newData.startGame);		// Check for GameStart Command
+
 				m_dataLock.lock();		// Lock Data
 
-				if(m_dataQueue.size() > MAX_QUEUE)
+				m_jitterBuffer.Insert(newData, TimeBase::Now(m_gameClock));
+
+				if(started)
 				{
-					m_dataQueue.pop_front();
+					m_startGame = true;
 				}
 
-				m_dataQueue.push_back(newData);
-
 				m_dataLock.unlock();	// Unlock Data
+
+				if(started)
+				{
+					m_startSignal.notify_all();
+				}
+			}
+			else if(cmdCode == GameData::HEARTBEAT)
+			{
+				sf::Packet echoPacket;
+				NetTime sendTime;
+
+				TimeBase::ReadCompact(receivedPacket, sendTime);
+				echoPacket << cmdCode;
+				TimeBase::WriteCompact(echoPacket, sendTime);
+
+				SendPacket(echoPacket);
+			}
+			else if(cmdCode == GameData::REJECT)
+			{
+				sf::Uint8 reason = 0;
+				receivedPacket >> reason;
+
+				// A quiet controller's owner reports the rejection, and may retry it
+				if(m_verbose)
+				{
+					std::cout << "Server rejected the connection: " << RejectReasonText(reason) << "\n";
+				}
+
+				m_rejectReason = reason;
+				m_connected = false;
 			}
 			else if(cmdCode == GameData::TIME_SYNC)
 			{
-				std::cout << "Time Sync Request Received.\n";
 				TimeSync syncRequest;
 
 				receivedPacket >> syncRequest;
 
-				syncRequest.clientRecieveTime = m_gameClock->getElapsedTime().asMilliseconds();
+				syncRequest.clientRecieveTime = TimeBase::Now(m_gameClock);
+				m_serverSyncPoint = syncRequest.serverSendTime;
+
+				if(syncRequest.offsetValid)
+				{
+					m_dataLock.lock();
+
+					m_clockEstimate.offset = syncRequest.offsetEstimate;
+					m_clockEstimate.uncertainty = syncRequest.offsetUncertainty;
+					m_clockEstimate.reference = syncRequest.offsetReference;
+					m_clockEstimate.skew = syncRequest.offsetSkew;
+					m_clockEstimate.valid = true;
+
+					m_dataLock.unlock();
+				}
+
 				SendTimeSync(syncRequest);
 			}
 			else
@@ -191,58 +397,283 @@ void CNetworkController::SocketListening(void)
 				std::cout << "Error with Command Code...\n";
 			}
 		}
-		else if(receiveStatus == sf::TcpSocket::Disconnected)
+		else if(receiveStatus == sf::Socket::Disconnected)
 		{
-			std::cout <<"Disconnected from Server.\n";
-			m_connected = false;
+			ConnectionLost("Disconnected from Server.");
+		}
+		else if(receiveStatus == sf::Socket::NotReady)
+		{
+			ConnectionLost("Server timed out.");
 		}
 		else
 		{
 			std::cout <<"Error Receiving Last Packet.\n";
 		}
 	}
+
+	WakeWaiters();		// The connection is over
 }
 
-// ===== GetNextData ==============================================================================
-// The method will return the most recent GameData update received by the server. It will be 
-// controlled by a mutex lock to ensure is doesn't grab data while the listening thread is writing
-// new data.
-// 
+// ===== RejectReasonText =========================================================================
+// Method will return a description of a REJECT's reason code.
+//
+// Input:
+//	[IN] sf::Uint8 reason	- the GameData::RejectReason
+//
+// Output:
+//	[OUT] const char*		- the description
+// ================================================================================================
+const char* CNetworkController::RejectReasonText(sf::Uint8 reason)
+{
+	switch(reason)
+	{
+	case GameData::SERVER_FULL:
+		return "the server is full.";
+	case GameData::RATE_LIMITED:
+		return "too many connections from this address, try again shortly.";
+	case GameData::TOO_MANY_PENDING:
+		return "the server is busy, try again shortly.";
+	case GameData::HANDSHAKE_FAILED:
+		return "the handshake failed.";
+	case GameData::UNKNOWN_SESSION:
+		return "the session has expired.";
+	default:
+		return "unknown reason.";
+	}
+}
+
+// ===== ConnectionLost ===========================================================================
+// Method will try to resume the session after the connection to the server was lost. If it can't
+// be resumed, the controller is marked as disconnected. Must only be called by the listening thread.
+//
+// Input:
+//	[IN] const char *reason	- why the connection was lost
+//
+// Output: none
+// ================================================================================================
+void CNetworkController::ConnectionLost(const char *reason)
+{
+	if(!m_connected)
+	{
+		return;		// Shutting down
+	}
+
+	std::cout << reason << "\n";
+
+	if(!Resume())
+	{
+		m_connected = false;
+
+		m_transportLock.lock();
+
+		m_transport->Disconnect();
+
+		m_transportLock.unlock();
+	}
+}
+
+// ===== Resume ===================================================================================
+// Method will reconnect to the server and send a RESUME with the session token, retrying every
+// RECONNECT_INTERVAL until the server's resume grace window has passed. Once the server accepts, the
+// new transport replaces the old one, anything still waiting to be sent is discarded, and the jitter
+// buffer is cleared so the game is rebuilt from the snapshot the server sends next.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if the session was resumed, false otherwise
+// ================================================================================================
+bool CNetworkController::Resume(void)
+{
+	if((m_sessionToken == 0) || !m_connector)
+	{
+		return false;
+	}
+
+	if(m_verbose)
+	{
+		std::cout << "Attempting to resume session...\n";
+	}
+
+	sf::Clock graceClock;
+
+	while(m_connected && (graceClock.getElapsedTime().asMilliseconds() < m_resumeGrace))
+	{
+		Transport *transport = m_connector();
+
+		if(transport != NULL)
+		{
+			sf::Packet resumePacket;
+			sf::Packet replyPacket;
+			sf::Uint8 cmdCode = GameData::RESUME;
+			sf::Uint32 sessionToken = m_sessionToken;
+			sf::Uint8 accepted = 0;
+			bool replied = false;
+
+			resumePacket << cmdCode << sessionToken;
+
+			if((transport->Send(resumePacket) == sf::Socket::Done) &&
+			   (transport->Receive(replyPacket, sf::milliseconds(m_idleTimeout)) == sf::Socket::Done) &&
+			   (replyPacket >> cmdCode))
+			{
+				if(cmdCode == GameData::RESUME)
+				{
+					replied = (replyPacket >> accepted);
+				}
+				else if(cmdCode == GameData::REJECT)
+				{
+					sf::Uint8 reason = 0;
+					replyPacket >> reason;
+
+					std::cout << "Server rejected the connection: " << RejectReasonText(reason) << "\n";
+					replied = true;
+
+					if((reason == GameData::RATE_LIMITED) || (reason == GameData::TOO_MANY_PENDING) ||
+					   (reason == GameData::SERVER_FULL))
+					{
+						replied = false;	// Busy rather than refused, worth trying again
+					}
+				}
+			}
+
+			if(replied && accepted)
+			{
+				m_transportLock.lock();
+
+				delete m_transport;
+				m_transport = EmulateLink(transport);
+
+				m_transportLock.unlock();
+
+				m_outLock.lock();
+
+				m_outPackets.clear();
+				m_syncReplies.clear();
+
+				m_outLock.unlock();
+
+				m_telemetry.Restart();
+
+				m_dataLock.lock();
+
+				m_jitterBuffer.Clear();
+
+				m_dataLock.unlock();
+
+				if(m_verbose)
+				{
+					std::cout << "Session resumed.\n";
+				}
+				return true;
+			}
+
+			delete transport;
+
+			if(replied)
+			{
+				std::cout << "Server refused to resume the session.\n";
+				return false;
+			}
+		}
+
+		sf::sleep(sf::milliseconds(RECONNECT_INTERVAL));
+	}
+
+	std::cout << "Unable to resume session.\n";
+	return false;
+}
+
+// ===== GetSnapshots =============================================================================
+// The method will ask the jitter buffer for the two snapshots that bracket the current render time.
+// It will be controlled by a mutex lock to ensure it doesn't read the buffer while the listening
+// thread is inserting new data.
+//
+// Input:
+//	[IN/OUT] GameData &older	- receives the snapshot at or before the render time
+//	[IN/OUT] GameData &newer	- receives the snapshot after the render time
+//	[IN/OUT] float &alpha		- receives the blend factor between older (0) and newer (1)
+//
+// Output:
+//	[OUT] bool					- true if the render time was bracketed, false if the buffer has
+//								  run dry and the engine must carry on without new data
+// ================================================================================================
+bool CNetworkController::GetSnapshots(GameData &older, GameData &newer, float &alpha)
+{
+	m_dataLock.lock();		// Lock Data
+
+	bool bracketed = m_jitterBuffer.GetBracket(TimeBase::Now(m_gameClock), older, newer, alpha);
+
+	m_dataLock.unlock();	// Unlock Data
+
+	return bracketed;
+}
+
+// ===== GetLatestData ============================================================================
+// The method will return the most recent GameData update received from the server, or a default
+// GameData if nothing has been received yet.
+//
+// Input: none
+//
+// Output:
+//	[OUT] GameData latest	-	the latest GameData update from the server
+// ================================================================================================
+GameData CNetworkController::GetLatestData(void)
+{
+	GameData latest;
+
+	m_dataLock.lock();		// Lock Data
+
+	m_jitterBuffer.GetLatest(latest);
+
+	m_dataLock.unlock();	// Unlock Data
+
+	return latest;
+}
+
+// ===== GetClockEstimate =========================================================================
+// The method will return the server's latest estimate of the difference between its' clock and
+// this client's clock. The round trip time is not sent by the server, so the smoothed round trip
+// from the link telemetry is given instead. Use the estimate's ToServerTime() to map a time on
+// this client's clock to the server clock.
+//
 // Input: none
 //
 // Output:
-//	[OUT] GameData m_newData	-	the latest GameData update from the server
+//	[OUT] ClockEstimate	- server time minus client time; valid is false until the server has one
 // ================================================================================================
-GameData CNetworkController::GetNextData(void)
+ClockEstimate CNetworkController::GetClockEstimate(void)
 {
+	ClockEstimate estimate;
+
 	m_dataLock.lock();		// Lock Data
 
-	GameData data = m_dataQueue.front();
-	m_dataQueue.pop_front();
+	estimate = m_clockEstimate;
 
 	m_dataLock.unlock();	// Unlock Data
 
-	return data;
+	estimate.roundTripTime = m_telemetry.GetStats().smoothedRtt;
+
+	return estimate;
 }
 
 // ===== SendTimeSync =============================================================================
-// This method will be called when the server sends a clock sync command. The method will create
-// a packet containing time stamps that will allow the server to adjust for latency.
+// This method will be called when the server sends a clock sync command. The reply is queued for
+// the outgoing thread, which stamps the client send time immediately before sending it.
+//
+// Input:
+//	[IN] TimeSync serverRequest	- the request, with the client receive time already stamped
 //
-// Input:none
 // Output: none
 // ================================================================================================
 void CNetworkController::SendTimeSync(TimeSync serverRequest)
 {
-	sf::Packet syncPacket;
-	sf::Uint8 cmdCode = GameData::TIME_SYNC;
+	m_outLock.lock();
 
-	serverRequest.clientSendTime = m_gameClock->getElapsedTime().asMilliseconds();
+	m_syncReplies.push_back(serverRequest);
 
-	syncPacket << cmdCode << serverRequest;
+	m_outLock.unlock();
 
-	std::cout << "Sending Time Sync\n";
-	SendPacket(syncPacket);
+	m_outWake.notify_one();
 }
 
 // ===== SendPacket ===============================================================================
@@ -261,44 +692,131 @@ void CNetworkController::SendPacket(sf::Packet packet)
 	m_outPackets.push_back(packet);
 
 	m_outLock.unlock();
+
+	m_outWake.notify_one();
 }
 
 // ===== SendOutThread ============================================================================
-// This method is used to simulate artificial latency between the client and server. It will wait
-// m_artificialLatency time, before sending out all packets in the outPackets list. This method will
-// be the starting place for the m_outThread member and should only ever be called by that thread.
+// This method will send out all packets in the outPackets list. This method will be the starting
+// place for the m_outThread member and should only ever be called by that thread.
+//
+// Clock sync replies go out first, each stamped with the client send time as it is sent. With
+// nothing to send, the thread sleeps until SendPacket() or SendTimeSync() wakes it.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void CNetworkController::SendOutThread(void)
 {
-	sf::Packet tempPacket;
-	sf::Clock lagClock;
+	std::list<sf::Packet> sending;
+	std::list<TimeSync> syncReplies;
 
 	while(m_connected)
 	{
-		if(lagClock.getElapsedTime().asMilliseconds() < m_artificialLatency)
-		{
-			continue;
-		}
-		else
+		std::unique_lock<std::mutex> lock(m_outLock);
+
+		m_outWake.wait(lock, [this](){ return (!m_outPackets.empty() || !m_syncReplies.empty() || !m_connected); });
+
+		sending.swap(m_outPackets);
+		syncReplies.swap(m_syncReplies);
+
+		lock.unlock();
+
+		m_transportLock.lock();
+
+		while(!syncReplies.empty())
 		{
-			lagClock.restart();
+			sf::Packet syncPacket;
+			sf::Uint8 cmdCode = GameData::TIME_SYNC;
 
-			m_outLock.lock();
+			syncReplies.front().clientSendTime = TimeBase::Now(m_gameClock);
+			syncPacket << cmdCode << syncReplies.front();
 
-			while(!m_outPackets.empty())
-			{
-				tempPacket = m_outPackets.front();
-				m_outPackets.pop_front();
-				m_serverConnection.send(tempPacket);
-			}
+			m_transport->Send(syncPacket);
+			syncReplies.pop_front();
+		}
 
-			m_outLock.unlock();
+		while(!sending.empty())
+		{
+			m_transport->Send(sending.front());
+			sending.pop_front();
 		}
+
+		m_transportLock.unlock();
 	}
 }
 
+// ===== WakeWaiters ==============================================================================
+// Method will wake the outgoing thread and anything in WaitForStart(), so they notice the
+// connection has ended.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void CNetworkController::WakeWaiters(void)
+{
+	m_outLock.lock();
+	m_outLock.unlock();		// Taken so a waiter is either asleep or yet to check m_connected
+
+	m_outWake.notify_all();
 
+	m_dataLock.lock();
+	m_dataLock.unlock();
 
+	m_startSignal.notify_all();
+}
+
+// ===== WaitForStart =============================================================================
+// Method will block until the server starts the game, or the connection is lost, so the client
+// can start its' engine the moment the match begins. A caller that can't block polls
+// ShouldStartGame() and IsConnected() instead, and GetRejectReason() tells it why the server turned
+// the connection away, if it did.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if the game has started, false if the connection was lost first
+// ================================================================================================
+bool CNetworkController::WaitForStart(void)
+{
+	std::unique_lock<std::mutex> lock(m_dataLock);
+
+	m_startSignal.wait(lock, [this](){ return (m_startGame || !m_connected); });
+
+	return m_startGame;
+}
+
+// ===== GetLinkStats =============================================================================
+// Method will return the latest measurements of the connection to the server, taken from the
+// LinkTelemetry trailers on the PADDLE_UPDATEs sent and the GAME_UPDATEs received.
+//
+// Input: none
+//
+// Output:
+//	[OUT] LinkStats	- round trip, one-way delay, jitter and loss of the connection
+// ================================================================================================
+LinkStats CNetworkController::GetLinkStats(void)
+{
+	return m_telemetry.GetStats();
+}
+
+// ===== EmulateLink ==============================================================================
+// Method will wrap a transport so the packets received on it cross the down link the server sent in
+// the INITIALIZE packet, replaying the down trace if one was sent. If neither changes packets the
+// transport is returned as it is.
+//
+// Input:
+//	[IN] Transport *transport	- the transport to wrap
+//
+// Output:
+//	[OUT] Transport*			- the transport the CNetworkController should use
+// ================================================================================================
+Transport* CNetworkController::EmulateLink(Transport *transport)
+{
+	if(!m_downLink.IsActive() && m_downTrace.empty())
+	{
+		return transport;
+	}
+
+	return new EmulatedTransport(transport, m_downLink, m_netSeed, &m_downTrace);
+}
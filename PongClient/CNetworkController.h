@@ -18,14 +18,16 @@
 // When an instance of CNetworkController is created, it will attempt to establish a connection with
 // the passed IP-Address and port number. If the connection fails, the classes "IsConnected()" method
 // will return false. This method should be called by the client after the instance is created to 
-// ensure the connection is ready.
+// ensure the connection is ready. A CNetworkController can also be handed an already connected
+// Transport, such as one end of a LoopbackTransport pair.
 //
 // All network related data, including timestamps, will be handled by the CNetworkController. Classes
 // that wish to send data, will pass the data and the CNetworkController will handle the packaging and
-// sending.
+// sending. It also keeps the connection alive: it answers the server's heartbeats and clock syncs,
+// measures the link, and resumes the session if the connection is lost.
 //
 // Packets being sent to and from the server will contain a command code and the appropriate data
-// for that command. Command codes are defined in the ClientHandler class in the PongServer project.
+// for that command. Command codes are defined in the GameData class in the PongLibrary project.
 // ================================================================================================
 
 #ifndef CNETWORKCONTROLLER_H
@@ -33,13 +35,22 @@
 
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <string>
 #include <list>
-#include <SFML\Network\TcpSocket.hpp>
+#include <vector>
+#include <functional>
 #include <SFML\Network\IpAddress.hpp>
 #include <SFML\System\Clock.hpp>
+#include "Transport.h"
+#include "NetTime.h"
+#include "ClockSync.h"
 #include "GameData.h"
 #include "TimeSync.h"
+#include "JitterBuffer.h"
+#include "NetworkProfile.h"
+#include "NetworkTrace.h"
+#include "LinkTelemetry.h"
 
 
 class CNetworkController
@@ -51,22 +62,34 @@ public:
 	// Methods
 	// ============================================================================================
 
-	static const int MAX_QUEUE; 
-
 	// Constructor/Destructor
 	CNetworkController(sf::IpAddress ipAddress, int portNumber, const sf::Clock *gameClock);
+	CNetworkController(Transport *transport, const sf::Clock *gameClock,
+					   std::function<Transport*(void)> connector = nullptr, bool verbose = true);
 	~CNetworkController(void);
 
 	// Method Prototypes
 	void StopThread();
 	void StopOutgoingThread();
-	void SendPaddleUpdate(float yLocation, int direction);
-	GameData GetNextData();
+	void SendPaddleUpdate(sf::Uint32 sequence, float yLocation, int direction);
+	bool GetSnapshots(GameData &older, GameData &newer, float &alpha);
+	GameData GetLatestData(void);
+	ClockEstimate GetClockEstimate(void);
+	LinkStats GetLinkStats(void);
+	bool WaitForStart(void);
+
+	// Static Methods
+	static const char* RejectReasonText(sf::Uint8 reason);
+
+	// Constants
+	static const int DEFAULT_IDLE_TIMEOUT;	// Idle timeout, in ms, used until the server sends its' own
+	static const int RECONNECT_INTERVAL;	// Time, in ms, between attempts to reconnect while resuming
+	static const int NOT_REJECTED;			// GetRejectReason() before any REJECT arrives
 
 	// Inlined Methods
 	bool IsConnected(){ return m_connected; }
 	int GetPlayerNumber(void){ return m_playerNum; }
-	bool DataQueueEmpty(void){ return m_dataQueue.empty(); }
+	int GetRejectReason(void){ return m_rejectReason; }
 	bool ShouldStartGame(void){ return m_startGame; }
 
 
@@ -78,33 +101,56 @@ private:
 
 	// Connection Data
 	std::thread *m_listeningThread;
-	sf::TcpSocket m_serverConnection;
+	Transport *m_transport;
+	std::mutex m_transportLock;		// Held while sending, and while the transport is replaced
 	bool m_connected;
-	int m_artificialLatency;
-
-		// GameData Queue Members
-	std::list<GameData> m_dataQueue;
+	bool m_verbose;					// False to print only errors
+	int m_idleTimeout;
+	int m_rejectReason;				// The RejectReason the server sent, or NOT_REJECTED
+
+	// Session Data
+	std::function<Transport*(void)> m_connector;
+	sf::Uint32 m_sessionToken;
+	int m_resumeGrace;
+	LinkProfile m_downLink;			// The network conditions to emulate on received packets
+	unsigned int m_netSeed;			// Seed for the down link emulator
+	std::vector<TraceSample> m_downTrace;	// Down half of the trace the server is replaying
+	unsigned int m_downTraceLength;			// Samples in the whole down trace
+	NetTime m_serverSyncPoint;		// Latest full server time received, only touched by the listening thread
+
+	// GameData Buffer Members
+	JitterBuffer m_jitterBuffer;
 	std::mutex m_dataLock;
+	ClockEstimate m_clockEstimate;		// The server's estimate, server time minus client time
+	LinkTelemetry m_telemetry;			// Stamped on PADDLE_UPDATEs, read off GAME_UPDATEs
 
 	// Game Data
 	int m_playerNum;
 	const sf::Clock *m_gameClock;
 	bool m_startGame;
+	std::condition_variable m_startSignal;	// Signalled with m_dataLock when the game starts or the connection ends
 
 	// Outgoing Data
 	std::thread *m_outThread;
 	std::mutex m_outLock;
+	std::condition_variable m_outWake;		// Signalled with m_outLock when there is something to send
 	std::list<sf::Packet> m_outPackets;
+	std::list<TimeSync> m_syncReplies;		// Stamped and sent by the outgoing thread
 
 	// ============================================================================================
 	// Methods
 	// ============================================================================================
 
 	// Prototypes
+	void Start(Transport *transport);
 	void SocketListening(void);
 	void SendTimeSync(TimeSync serverRequest);
 	void SendPacket(sf::Packet packet);
 	void SendOutThread(void);
+	void WakeWaiters(void);
+	void ConnectionLost(const char *reason);
+	bool Resume(void);
+	Transport* EmulateLink(Transport *transport);
 
 };
 
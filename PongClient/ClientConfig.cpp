@@ -0,0 +1,103 @@
+// ================================================================================================
+// Filename: "ClientConfig.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ClientConfig class. For a class description see
+// the header file "ClientConfig.h"
+// ================================================================================================
+
+#include <cstring>
+#include <cstdlib>
+#include "ClientConfig.h"
+
+// ===== Default Constructor ======================================================================
+// The default constructor will set every option to its' default.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ClientConfig::ClientConfig(void)
+{
+	// Netcode Options
+	rollback = false;
+
+	// Rendering Options
+	frameLimit = 0;
+	frameLogInterval = 0;
+
+	// Headless Options
+	headless = false;
+	bots = 1;
+	server = "";
+
+	// Input Options
+	inputSource = "";
+	recordFile = "";
+}
+
+// ===== ParseOption ==============================================================================
+// Method will read the command line option at argv[index], along with its' value if it takes one,
+// if it is one of the client's options. The index is left on the last argument consumed.
+//
+// Input:
+//	[IN] int argc			- the number of command line arguments
+//	[IN] char* argv[]		- the command line arguments
+//	[IN/OUT] int &index		- the argument to read
+//
+// Output:
+//	[OUT] bool				- true if the option was recognized, false otherwise
+// ================================================================================================
+bool ClientConfig::ParseOption(int argc, char* argv[], int &index)
+{
+	// Options Without a Value
+	if(strcmp(argv[index], "-rollback") == 0)
+	{
+		rollback = true;
+		return true;
+	}
+
+	if(strcmp(argv[index], "-headless") == 0)
+	{
+		headless = true;
+		return true;
+	}
+
+	if((index + 1) >= argc)
+	{
+		return false;
+	}
+
+	if(strcmp(argv[index], "-fps") == 0)
+	{
+		frameLimit = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-frame-log") == 0)
+	{
+		frameLogInterval = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-bots") == 0)
+	{
+		bots = atoi(argv[++index]);
+		headless = true;
+	}
+	else if(strcmp(argv[index], "-server") == 0)
+	{
+		server = argv[++index];
+	}
+	else if(strcmp(argv[index], "-input") == 0)
+	{
+		inputSource = argv[++index];
+	}
+	else if(strcmp(argv[index], "-record") == 0)
+	{
+		recordFile = argv[++index];
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
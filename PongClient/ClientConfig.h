@@ -0,0 +1,60 @@
+// ================================================================================================
+// Filename: "ClientConfig.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ClientConfig class holds the options the client was started with. ClientStart fills one in
+// from the command line and the ClientEngine keeps a const pointer to it, so a new option only has
+// to be added here and read where it is used.
+//
+// The constructor sets every option to its' default. To increase simplicity, the ClientConfig class
+// will make all members public.
+// ================================================================================================
+
+#ifndef CLIENTCONFIG_H
+#define CLIENTCONFIG_H
+
+#include <string>
+
+class ClientConfig
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ClientConfig(void);
+	~ClientConfig(void){}
+
+	// Method Prototypes
+	bool ParseOption(int argc, char* argv[], int &index);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Netcode Options
+	bool rollback;						// Simulate locally and roll back, instead of interpolating snapshots
+
+	// Rendering Options
+	int frameLimit;						// Most frames drawn per second, 0 to pace to the display's refresh
+	int frameLogInterval;				// Time, in ms, between prints of the frame time stats, 0 for off
+
+	// Headless Options
+	bool headless;						// Run with no window, font or rendering
+	int bots;							// Headless clients to run in this process
+	std::string server;					// Server to connect to, as typed at the prompt; empty to ask
+
+	// Input Options
+	std::string inputSource;			// keyboard, ai, script:<file> or replay:<file>; empty for the
+										// default, the keyboard with a window and ai without
+	std::string recordFile;				// File to record the inputs given to, empty for none
+};
+
+#endif
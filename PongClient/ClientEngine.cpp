@@ -16,28 +16,40 @@
 #include "Calculator.h"
 
 // Initialize Constants
-const int ClientEngine::SHORT_THRESHOLD = 5;
-const int ClientEngine::MEDIUM_THRESHOLD = 10;
-const int ClientEngine::FAST_THRESHOLD = 20;
-const float ClientEngine::MEDIUM_SPEED_MOD = 1.5;
-const float ClientEngine::FAST_SPEED_MOD = 2;
+const int ClientEngine::NETWORK_TEXT_INTERVAL = 1000;
+const float ClientEngine::RECONCILE_TOLERANCE = 0.5f;
+const float ClientEngine::CORRECTION_DECAY = 0.8f;
+const int ClientEngine::MAX_PENDING_INPUTS = 256;
+const int ClientEngine::MAX_EXTRAPOLATION = 200;
+const int ClientEngine::ROLLBACK_BUDGET = 500;
+const int ClientEngine::BUDGET_TRIALS = 200;
+const int ClientEngine::MAX_CATCH_UP_TICKS = 5;
 
 // ===== Constructor ==============================================================================
-// The constructor will set-up the GUI and initialize all game values for the client. It will start
-// the engine and begin rendering and checking for data from server.
+// The constructor will set-up the GUI and initialize all game values for the client. The window is
+// created here, on the engine's thread, which polls its' events; the ClientRenderer draws in it. A
+// headless engine creates no window, font or renderer, and prints nothing.
+//
+// Input:
+//	[IN] CNetworkController *networkControl	- the connection to the server
+//	[IN] const ClientConfig *config			- the client's options, the rollback mode, headless
+//											  mode and the frame pacing
+//	[IN] InputSource *input					- where the paddle input comes from, kept by the caller
 //
-// Input: none
 // Output: none
 //  ===============================================================================================
-ClientEngine::ClientEngine(CNetworkController *networkControl)
+ClientEngine::ClientEngine(CNetworkController *networkControl, const ClientConfig *config, InputSource *input)
 {
 	// Initialize Engine Members
 	m_networkControl = networkControl;
+	m_config = config;
+	m_input = input;
 	m_engineClock.restart();
+	m_accumulator = 0;
 	m_running = false;
+	m_verbose = !m_config->headless;
 
 	// Initialize Game Pieces
-	m_mainWindow = new sf::RenderWindow(sf::VideoMode(GameData::BOARD_WIDTH, GameData::BOARD_HEIGHT), "Pong Client", sf::Style::Close | sf::Style::Titlebar);
 
 	m_leftPaddle = new Paddle(1);
 	m_rightPaddle = new Paddle(2);
@@ -54,33 +66,46 @@ ClientEngine::ClientEngine(CNetworkController *networkControl)
 	}
 
 	m_oppMoveDirection = Paddle::STILL;
-	m_oppSpeedMod = 1;
+	m_extrapolatedTicks = 0;
+	m_ballError = sf::Vector2f(0, 0);
+	m_opponentError = 0;
 
-	// Initialize Window Members
-	if(!m_gameFont.loadFromFile("arial.ttf"))
+	m_predictedPaddle = new Paddle(m_networkControl->GetPlayerNumber());
+	m_inputSequence = 0;
+	m_lastAckedInput = 0;
+	m_predictionError = 0;
+
+	m_rollback = NULL;
+	m_lastConfirmedTick = -1;
+	m_rollbacks = 0;
+	m_worstRollback = 0;
+
+	if(m_config->rollback)
 	{
-		std::cout << "Font Error\n";
-		m_mainWindow->close();
+		m_rollback = new RollbackSession(m_networkControl->GetPlayerNumber());
+
+		if(m_verbose)
+		{
+			CheckRollbackBudget();
+		}
 	}
 
-	m_player1ScoreText.setFont(m_gameFont);
-	m_player1ScoreText.setCharacterSize(48);
-	m_player2ScoreText.setFont(m_gameFont);
-	m_player2ScoreText.setCharacterSize(48);
+	// Initialize Window and Renderer
+	m_mainWindow = NULL;
+	m_renderer = NULL;
+
+	if(!m_config->headless)
+	{
+		m_mainWindow = new sf::RenderWindow(sf::VideoMode(GameData::BOARD_WIDTH, GameData::BOARD_HEIGHT), "Pong Client", sf::Style::Close | sf::Style::Titlebar);
+		m_renderer = new ClientRenderer(m_mainWindow, m_config);
+	}
 
+	m_ticks = 0;
+	m_skippedTicks = 0;
 	m_player1Score = 0;
 	m_player2Score = 0;
 
-	m_player1ScoreText.setColor(sf::Color(255, 255, 255));
-	m_player2ScoreText.setColor(sf::Color(255, 255, 255));
-
-	m_player1ScoreText.setOrigin((m_player1ScoreText.getLocalBounds().width / 2), (m_player1ScoreText.getLocalBounds().height / 2));
-	m_player2ScoreText.setOrigin((m_player2ScoreText.getLocalBounds().width / 2), (m_player2ScoreText.getLocalBounds().height / 2));
-
-	m_player1ScoreText.setPosition(((float)(GameData::BOARD_WIDTH / 2) - 150), 25);
-	m_player2ScoreText.setPosition(((float)(GameData::BOARD_WIDTH / 2) + 150), 25);
-
-	UpdateScoreText();
+	UpdateNetworkText();
 }
 
 // ===== Destructor ===============================================================================
@@ -90,120 +115,316 @@ ClientEngine::~ClientEngine(void)
 {
 	delete m_leftPaddle;
 	delete m_rightPaddle;
+	delete m_predictedPaddle;
+	delete m_rollback;
+	delete m_renderer;
 	delete m_mainWindow;
 }
 
 // ===== Run ======================================================================================
-// This method will be the "infinite" loop that starts when the engine starts. Every iteration it
-// will check for data from server, update the game state based on server data, respond to user
-// input, render the main window, and send a paddle update to the server.
+// This method will be the "infinite" loop that starts when the engine starts. It starts the engine,
+// advances it, sleeping until each next tick is due, and finishes it once the game is over. A
+// BotRunner driving many headless engines from one thread calls Start(), Advance() and Finish()
+// itself instead.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void ClientEngine::Run(void)
 {
-	bool wPressed = false;
-	bool sPressed = false;
-	int paddleDirection;
+	Start();
 
+	while(Advance())
+	{
+		sf::sleep(sf::microseconds(GetTimeToNextTick()));
+	}
+
+	Finish();
+}
+
+// ===== Start ====================================================================================
+// Method will place the ball where the server's first snapshot has it and start the clock. With a
+// window, it also publishes the first RenderState and starts the render thread.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::Start(void)
+{
 	m_running = true;
+	m_accumulator = 0;
 
-	GameData startData = m_networkControl->GetNextData();
+	GameData startData = m_networkControl->GetLatestData();
 	m_gameBall.setPosition(startData.ballX, startData.ballY);
 	m_gameBall.SetMoveAngle(startData.ballAngle);
 
-	while(m_running)
+	if(m_renderer != NULL)
 	{
-		// Limit Engine to ~60 Cycles a Second
-		if(m_engineClock.getElapsedTime().asMilliseconds() <= GameData::ENGINE_SPEED)
+		SavePreviousPositions();
+		PublishState(0);
+		m_renderer->Start();
+	}
+
+	m_engineClock.restart();
+}
+
+// ===== Advance ==================================================================================
+// Method will make one pass of the engine. The simulation runs at a fixed step: the time since the
+// last pass is added to an accumulator, and a Tick() is run for every ENGINE_SPEED of it. At most
+// MAX_CATCH_UP_TICKS ticks are run in one pass; after a longer stall the rest are skipped rather
+// than run in a burst. With a window, the engine then publishes a RenderState for the render
+// thread, which draws from the published states, so the engine only ever waits on its' own clock,
+// never on the display.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true while the game is running, false once it is over
+// ================================================================================================
+bool ClientEngine::Advance(void)
+{
+	NetTime tickTime = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+
+	m_accumulator += m_engineClock.restart().asMicroseconds();
+
+	// Get Latest Window Events
+	PollInput();
+
+	// Run the Fixed Steps Due
+	int ticks = 0;
+
+	while(m_running && (m_accumulator >= tickTime))
+	{
+		if(ticks == MAX_CATCH_UP_TICKS)
 		{
-			Render();
-			continue;
+			m_skippedTicks += (int)(m_accumulator / tickTime);
+			m_accumulator %= tickTime;
+			break;
 		}
-		else
+
+		if(m_renderer != NULL)
+		{
+			SavePreviousPositions();
+		}
+
+		Tick();
+
+		m_accumulator -= tickTime;
+		ticks++;
+		m_ticks++;
+	}
+
+	if((ticks > 0) && (m_renderer != NULL))
+	{
+		// Refresh the Link Readout
+		if(m_networkTextClock.getElapsedTime().asMilliseconds() >= NETWORK_TEXT_INTERVAL)
 		{
-			m_engineClock.restart();
+			m_networkTextClock.restart();
+			UpdateNetworkText();
+		}
 
-			// Check DataQueue
-			if(!m_networkControl->DataQueueEmpty())
-			{
-				m_gameState = m_networkControl->GetNextData();
-				UpdateGameData();
-			}
-			else
-			{
-				m_gameBall.Move(1);
-
-				// Interpolate The Opponents Paddle
-				if(m_networkControl->GetPlayerNumber() == 1)
-				{
-					InterpolateOpponent(m_gameState.playerTwoPaddlePosition, m_gameState.playerTwoDirection);
-				}
-				else
-				{
-					InterpolateOpponent(m_gameState.playerOnePaddlePosition, m_gameState.playerOneDirection);
-				}
-			}
+		// Hand the Result to the Render Thread
+		PublishState(m_accumulator);
+	}
 
-			// Get Latest User Input
-			sf::Event event;
-			while(m_mainWindow->pollEvent(event))
-			{
-				if(event.type == sf::Event::Closed)
-				{
-					m_mainWindow->close();
-				}
-				else if((event.type == sf::Event::KeyPressed) && (event.key.code == sf::Keyboard::W))
-				{
-					wPressed = true;
-				}
-				else if((event.type == sf::Event::KeyPressed) && (event.key.code == sf::Keyboard::S))
-				{
-					sPressed = true;
-				}
-				else if((event.type == sf::Event::KeyReleased) && (event.key.code == sf::Keyboard::W))
-				{
-					wPressed = false;
-				}
-				else if((event.type == sf::Event::KeyReleased) && (event.key.code == sf::Keyboard::S))
-				{
-					sPressed = false;
-				}
-			} 
-
-			// Adjust Client Paddle
-			if((wPressed) && (!sPressed))
-			{
-				m_clientPaddle->MoveUp(1);
-				paddleDirection = Paddle::UP;
-			}
-			else if((sPressed) && (!wPressed))
-			{
-				m_clientPaddle->MoveDown(1);
-				paddleDirection = Paddle::DOWN;
-			}
-			else
+	return m_running;
+}
+
+// ===== GetTimeToNextTick ========================================================================
+// Method will find how long until the engine's next tick is due.
+//
+// Input: none
+//
+// Output:
+//	[OUT] NetTime	- the time, in us, 0 if a tick is already due
+// ================================================================================================
+NetTime ClientEngine::GetTimeToNextTick(void)
+{
+	NetTime due = (TimeBase::FromMilliseconds(GameData::ENGINE_SPEED) - m_accumulator - m_engineClock.getElapsedTime().asMicroseconds());
+
+	return ((due > 0) ? due : 0);
+}
+
+// ===== Finish ===================================================================================
+// Method will stop the render thread, if there is one, once the game is over.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::Finish(void)
+{
+	m_running = false;
+
+	if(m_renderer != NULL)
+	{
+		m_renderer->Stop();
+	}
+}
+
+// ===== Tick =====================================================================================
+// This method will run a single engine cycle. It will check for data from server, update the game
+// state based on server data, apply the user's input, and send a paddle update to the server. The
+// input is asked of the InputSource once a tick, so the same code runs for the keyboard, a bot, a
+// script or a replay.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::Tick(void)
+{
+	GameData olderData;
+	GameData newerData;
+	float blendAlpha;
+	int paddleDirection;
+
+	// Reconcile the Prediction with the Newest Snapshot
+	ReconcilePaddle();
+
+	// Check Jitter Buffer, or the Newest Snapshot when Rolling Back
+	if(m_rollback != NULL)
+	{
+		if(m_networkControl->IsConnected())
+		{
+			ConfirmRollback();
+		}
+		else
+		{
+			if(m_verbose)
 			{
-				paddleDirection = Paddle::STILL;
+				std::cout << "Lost connection to the server.\n";
 			}
+			m_running = false;
+		}
+	}
+	else if(m_networkControl->GetSnapshots(olderData, newerData, blendAlpha))
+	{
+		m_gameState = BlendSnapshots(olderData, newerData, blendAlpha);
 
-			CheckPaddleCollisions();
+		if(m_extrapolatedTicks > 0)
+		{
+			StartBlendBack();
+		}
 
-			// Render The Game Screen
-			Render();
+		UpdateGameData();
+	}
+	else if(!m_networkControl->IsConnected())
+	{
+		if(m_verbose)
+		{
+			std::cout << "Lost connection to the server.\n";
+		}
+		m_running = false;
+	}
+	else
+	{
+		ExtrapolateState();
+	}
 
-			// Send Paddle Update
-			m_networkControl->SendPaddleUpdate(m_clientPaddle->getPosition().y, paddleDirection);
+	// Adjust Client Paddle
+	paddleDirection = m_input->NextDirection(m_gameState, m_predictedPaddle->getPosition().y);
 
+	PredictPaddle(paddleDirection);
+
+	if(m_rollback != NULL)
+	{
+		AdvanceRollback(paddleDirection);
+	}
+	else
+	{
+		CheckPaddleCollisions();
+	}
+
+	// Send Paddle Update
+	m_networkControl->SendPaddleUpdate(m_inputSequence, m_predictedPaddle->getPosition().y, paddleDirection);
+}
+
+// ===== PollInput ================================================================================
+// Method will handle the window's events once a pass, and pass each on to the input source. A
+// headless engine has no window, so there is nothing to poll. Closing the window ends the game;
+// the render thread is stopped first, so the window isn't closed while it is still drawing to it.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::PollInput(void)
+{
+	sf::Event event;
+
+	if(m_mainWindow == NULL)
+	{
+		return;
+	}
+
+	while(m_mainWindow->pollEvent(event))
+	{
+		if(event.type == sf::Event::Closed)
+		{
+			m_renderer->Stop();
+			m_mainWindow->close();
+			m_running = false;
+			return;
+		}
+		else
+		{
+			m_input->HandleEvent(event);
 		}
 	}
 }
 
+// ===== SavePreviousPositions ====================================================================
+// Method will keep where the ball and paddles are before a tick moves them, for the renderer to
+// draw between.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::SavePreviousPositions(void)
+{
+	m_previousBall = m_gameBall.getPosition();
+	m_previousLeft = m_leftPaddle->getPosition();
+	m_previousRight = m_rightPaddle->getPosition();
+}
+
+// ===== PublishState =============================================================================
+// Method will fill in the renderer's next RenderState from the game as the last tick left it, and
+// publish it to the render thread.
+//
+// Input:
+//	[IN] NetTime tickProgress	- time already accumulated toward the next tick, in us
+//
+// Output: none
+// ================================================================================================
+void ClientEngine::PublishState(NetTime tickProgress)
+{
+	RenderState &state = m_renderer->GetNextState();
+
+	state.tickProgress = tickProgress;
+
+	state.ballPosition = m_gameBall.getPosition();
+	state.previousBall = m_previousBall;
+	state.leftPosition = m_leftPaddle->getPosition();
+	state.previousLeft = m_previousLeft;
+	state.rightPosition = m_rightPaddle->getPosition();
+	state.previousRight = m_previousRight;
+	state.playerOneHealth = m_leftPaddle->GetHealth();
+	state.playerTwoHealth = m_rightPaddle->GetHealth();
+	state.healthPackSpawned = m_gameState.healthPackSpawned;
+
+	state.playerOneScore = m_player1Score;
+	state.playerTwoScore = m_player2Score;
+	state.networkText = m_networkString;
+	state.ticks = m_ticks;
+	state.skippedTicks = m_skippedTicks;
+
+	state.publishTime = m_renderer->GetTime();
+	m_renderer->Publish();
+}
+
 // ===== UpdateGameData ===========================================================================
 // This method take a GameData structure that was received by the server and use it to update all
-// gameState variables on the client. It will call the InterpolateXXXXX() methods for the opponent 
-// paddle and ball positions. It will also check for scores, and winning conditions.
+// gameState variables on the client. The state has already been interpolated to the render time by
+// BlendSnapshots(), so the ball and opponent paddle are placed where it says, plus whatever is left
+// of the blend back from an extrapolation. It will also check for scores, and winning conditions.
 //
 // Input: none
 // Output: none
@@ -213,47 +434,61 @@ void ClientEngine::UpdateGameData()
 	// Update Paddle Health
 	if(m_leftPaddle->GetHealth() != m_gameState.playerOneHealth)
 	{
-		std::cout << "Player 1 Health change, new health = " << m_gameState.playerOneHealth << std::endl;
+		if(m_verbose)
+		{
+			std::cout << "Player 1 Health change, new health = " << m_gameState.playerOneHealth << std::endl;
+		}
 		m_leftPaddle->SetHealth(m_gameState.playerOneHealth);
 	}
 
 	if(m_rightPaddle->GetHealth() != m_gameState.playerTwoHealth)
 	{
-		std::cout << "Player 2 Health change, new health = " << m_gameState.playerTwoHealth << std::endl;
+		if(m_verbose)
+		{
+			std::cout << "Player 2 Health change, new health = " << m_gameState.playerTwoHealth << std::endl;
+		}
 		m_rightPaddle->SetHealth(m_gameState.playerTwoHealth);
 	}
 
-	// Interpolate Ball Position
-	InterpolateBall(m_gameState.ballX, m_gameState.ballY, m_gameState.ballAngle);
+	// Decay the Blend Back
+	m_ballError *= CORRECTION_DECAY;
+	m_opponentError *= CORRECTION_DECAY;
+
+	if((std::fabs(m_ballError.x) <= RECONCILE_TOLERANCE) && (std::fabs(m_ballError.y) <= RECONCILE_TOLERANCE))
+	{
+		m_ballError = sf::Vector2f(0, 0);
+	}
 
-	// Interpolate The Opponents Paddle
+	if(std::fabs(m_opponentError) <= RECONCILE_TOLERANCE)
+	{
+		m_opponentError = 0;
+	}
+
+	// Place the Ball
+	m_gameBall.setPosition(ClampTo((m_gameState.ballX + m_ballError.x), Ball::RADIUS, (GameData::BOARD_WIDTH - Ball::RADIUS)),
+						   ClampTo((m_gameState.ballY + m_ballError.y), Ball::RADIUS, (GameData::BOARD_HEIGHT - Ball::RADIUS)));
+	m_gameBall.SetMoveAngle(m_gameState.ballAngle);
+
+	// Place The Opponents Paddle
 	if(m_networkControl->GetPlayerNumber() == 1)
 	{
-		InterpolateOpponent(m_gameState.playerTwoPaddlePosition, m_gameState.playerTwoDirection);
+		m_opponentPaddle->setPosition(m_opponentPaddle->getPosition().x, (m_gameState.playerTwoPaddlePosition + m_opponentError));
+		m_oppMoveDirection = m_gameState.playerTwoDirection;
 	}
 	else
 	{
-		InterpolateOpponent(m_gameState.playerOnePaddlePosition, m_gameState.playerOneDirection);
+		m_opponentPaddle->setPosition(m_opponentPaddle->getPosition().x, (m_gameState.playerOnePaddlePosition + m_opponentError));
+		m_oppMoveDirection = m_gameState.playerOneDirection;
 	}
 
 	// Check for Score
 	if(m_player1Score != m_gameState.playerOneScore)
 	{
 		m_player1Score = m_gameState.playerOneScore;
-		UpdateScoreText();
-
-		// Ball needs to be reset, not interpolated after a score.
-		m_gameBall.setPosition(m_gameState.ballX, m_gameState.ballY);
-		m_gameBall.SetMoveAngle(m_gameState.ballAngle);
 	}
 	if(m_player2Score != m_gameState.playerTwoScore)
 	{
 		m_player2Score = m_gameState.playerTwoScore;
-		UpdateScoreText();
-
-		// Ball needs to be reset, not interpolated after a score.
-		m_gameBall.setPosition(m_gameState.ballX, m_gameState.ballY);
-		m_gameBall.SetMoveAngle(m_gameState.ballAngle);
 	}
 
 	// Check for Win
@@ -261,72 +496,324 @@ void ClientEngine::UpdateGameData()
 	{
 		if(m_gameState.winningPlayer == 1)
 		{
-			std::cout << "Player 1 Won the Game!\n";
+			if(m_verbose)
+			{
+				std::cout << "Player 1 Won the Game!\n";
+			}
 			m_running = false;
 		}
 		else
 		{
-			std::cout << "Player 2 Won the Game!\n";
+			if(m_verbose)
+			{
+				std::cout << "Player 2 Won the Game!\n";
+			}
 			m_running = false;
 		}
 	}
 }
 
-// ===== UpdateScoreText ==========================================================================
-// Method will update the sf::Text members with the latest scores.
+// ===== BlendSnapshots ===========================================================================
+// Method will build the GameData the client should be showing at the render time, using the two
+// snapshots that bracket it. The render time trails the newest snapshot by the jitter buffer's
+// playout delay, so there is nearly always a snapshot on each side of it to interpolate between.
+//
+// Positions are interpolated along a cubic Hermite curve rather than a straight line. The tangent
+// at each snapshot is the velocity it was sent with, the ball's angle at its' base move rate and
+// each paddle's direction at its' base move rate, scaled to the ticks between the snapshots. The
+// ball and paddles then leave one snapshot and reach the next moving the way the server moved them,
+// so there is no visible kink at each snapshot, and a snapshot skipped by the server's pacing
+// costs no smoothness. The curve can bulge past the board at a bounce, so the results are kept on
+// the board.
+//
+// Everything else is taken from the newer snapshot so scores, health, and wins are never missed.
+// The ball angle is taken from the older snapshot so the blended position and angle describe the
+// same leg of the ball's travel.
+//
+// Input:
+//	[IN] const GameData &older	- the snapshot at or before the render time
+//	[IN] const GameData &newer	- the snapshot after the render time
+//	[IN] float alpha			- how far between the snapshots the render time is, 0 to 1
+//
+// Output:
+//	[OUT] GameData blended		- the game state at the render time
+// ================================================================================================
+GameData ClientEngine::BlendSnapshots(const GameData &older, const GameData &newer, float alpha)
+{
+	GameData blended = newer;
+
+	// Ticks between the snapshots, tangents are per tick
+	double span = (double)(newer.serverTick - older.serverTick);
+
+	if(span < 1)
+	{
+		span = 1;
+	}
+
+	float paddleTop = (Paddle::HEIGHT / 2);
+	float paddleBottom = (GameData::BOARD_HEIGHT - (Paddle::HEIGHT / 2));
+
+	blended.playerOnePaddlePosition = ClampTo((float)Calculator::Hermite(older.playerOnePaddlePosition, (PaddleVelocity(older.playerOneDirection) * span),
+																		 newer.playerOnePaddlePosition, (PaddleVelocity(newer.playerOneDirection) * span), alpha),
+											  paddleTop, paddleBottom);
+	blended.playerTwoPaddlePosition = ClampTo((float)Calculator::Hermite(older.playerTwoPaddlePosition, (PaddleVelocity(older.playerTwoDirection) * span),
+																		 newer.playerTwoPaddlePosition, (PaddleVelocity(newer.playerTwoDirection) * span), alpha),
+											  paddleTop, paddleBottom);
+
+	// Don't blend across a serve, the ball jumps to the center
+	if((older.playerOneScore == newer.playerOneScore) && (older.playerTwoScore == newer.playerTwoScore))
+	{
+		double olderXRate = (Ball::BASE_MOVE_RATE * cos(older.ballAngle) * span);
+		double olderYRate = ((-1) * Ball::BASE_MOVE_RATE * sin(older.ballAngle) * span);	// y-plane grows downward
+		double newerXRate = (Ball::BASE_MOVE_RATE * cos(newer.ballAngle) * span);
+		double newerYRate = ((-1) * Ball::BASE_MOVE_RATE * sin(newer.ballAngle) * span);
+
+		blended.ballX = ClampTo((float)Calculator::Hermite(older.ballX, olderXRate, newer.ballX, newerXRate, alpha),
+								Ball::RADIUS, (GameData::BOARD_WIDTH - Ball::RADIUS));
+		blended.ballY = ClampTo((float)Calculator::Hermite(older.ballY, olderYRate, newer.ballY, newerYRate, alpha),
+								Ball::RADIUS, (GameData::BOARD_HEIGHT - Ball::RADIUS));
+		blended.ballAngle = older.ballAngle;
+	}
+
+	return blended;
+}
+
+// ===== ExtrapolateState =========================================================================
+// Method will carry the ball and opponent paddle on from where they were last shown when the jitter
+// buffer has run dry. The ball keeps its' last angle and speed, reflecting off the walls in Move()
+// and off the paddles in CheckPaddleCollisions(), and the opponent paddle keeps moving in its' last
+// direction. After MAX_EXTRAPOLATION both are held where they are, so a long outage freezes the
+// game rather than letting the guess wander further and further from the server.
 //
 // Input: none
 // Output: none
 // ================================================================================================
-void ClientEngine::UpdateScoreText(void)
+void ClientEngine::ExtrapolateState(void)
 {
-	std::stringstream p1String;
-	std::stringstream p2String;
+	if((m_extrapolatedTicks * GameData::ENGINE_SPEED) >= MAX_EXTRAPOLATION)
+	{
+		return;
+	}
 
-	p1String << m_player1Score;
-	p2String << m_player2Score;
+	m_extrapolatedTicks++;
 
-	m_player1ScoreText.setString(p1String.str());
-	m_player2ScoreText.setString(p2String.str());
+	m_gameBall.Move(1);
+	ApplyInput(m_opponentPaddle, m_oppMoveDirection);
 }
 
-// ===== InterpolateBall ==========================================================================
-// Method will adjust ball position from the current clients view to the latest server view. This
-// method is resonsible for making sure that the ball moves smoothly instead of "teleporting" around.
-// The method will be responsible for adjusting the angle of the balls travel, its' position, and 
-// setting the speed mod if needed.
+// ===== StartBlendBack ===========================================================================
+// Method will be called on the first interpolated state after an extrapolation. Rather than snap
+// the ball and opponent paddle to it, the difference between where they were extrapolated to and
+// where they should be is kept as a correction that decays away over the next few cycles, the same
+// way the client paddle's prediction is corrected. After a score the ball is served from the
+// center, so it snaps there instead.
 //
-// Input:
-//	[IN] float ballX		-	the server's ball's x-coordinate
-//	[IN] float ballY		-	the server's ball's y-coordinate
-//	[IN] double ballAngle	-	the server's ball's angle of travel
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::StartBlendBack(void)
+{
+	m_extrapolatedTicks = 0;
+
+	if((m_player1Score == m_gameState.playerOneScore) && (m_player2Score == m_gameState.playerTwoScore))
+	{
+		m_ballError = sf::Vector2f((m_gameBall.getPosition().x - m_gameState.ballX), (m_gameBall.getPosition().y - m_gameState.ballY));
+	}
+	else
+	{
+		m_ballError = sf::Vector2f(0, 0);
+	}
+
+	float opponentPosition = ((m_networkControl->GetPlayerNumber() == 1) ? m_gameState.playerTwoPaddlePosition : m_gameState.playerOnePaddlePosition);
+
+	m_opponentError = (m_opponentPaddle->getPosition().y - opponentPosition);
+
+	// UpdateGameData() decays the correction before showing it, so start it one step higher
+	m_ballError /= CORRECTION_DECAY;
+	m_opponentError /= CORRECTION_DECAY;
+}
+
+// ===== CheckRollbackBudget ======================================================================
+// Method will time a full rollback on this machine before the game starts. Every engine cycle may
+// have to simulate MAX_ROLLBACK ticks again on top of its' own, so a rollback that doesn't fit well
+// inside a cycle would make the client fall behind; if it is over ROLLBACK_BUDGET a warning is
+// printed.
 //
+// Input: none
 // Output: none
 // ================================================================================================
-void ClientEngine::InterpolateBall(float ballX, float ballY, double ballAngle)
+void ClientEngine::CheckRollbackBudget(void)
 {
-	if(m_gameBall.GetMoveAngle() == ballAngle)
+	NetTime rollbackTime = RollbackSession::MeasureRollback(RollbackSession::MAX_ROLLBACK, BUDGET_TRIALS);
+
+	std::cout << "Rollback of " << RollbackSession::MAX_ROLLBACK << " ticks takes " << rollbackTime << "us (budget "
+			  << ROLLBACK_BUDGET << "us).\n";
+
+	if(rollbackTime > ROLLBACK_BUDGET)
 	{
-		double distance = Calculator::GetDistanceTo(m_gameBall.getPosition().x, m_gameBall.getPosition().y, ballX, ballY);
+		std::cout << "Warning: rollback is over budget on this machine, the game may stutter.\n";
+	}
+}
 
-		if(distance < MEDIUM_THRESHOLD)
-		{
-			m_gameBall.Move(1);
-		}
-		else if(distance < FAST_THRESHOLD)
+// ===== ConfirmRollback ==========================================================================
+// Method will take the newest snapshot, if it hasn't been seen yet, for its' scores, health, and win,
+// and check the rollback session's prediction against it. The session is started from the first
+// snapshot, running ahead of it by the round trip time. Every rollback is timed.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::ConfirmRollback(void)
+{
+	GameData latest = m_networkControl->GetLatestData();
+
+	if(latest.serverTick == m_lastConfirmedTick)
+	{
+		return;
+	}
+
+	m_lastConfirmedTick = latest.serverTick;
+	m_gameState = latest;
+
+	if(!m_rollback->IsStarted())
+	{
+		LinkStats stats = m_networkControl->GetLinkStats();
+		NetTime tickTime = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+		int lead = 1;
+
+		if(stats.rttValid)
 		{
-			m_gameBall.Move(MEDIUM_SPEED_MOD);
+			lead = (int)((stats.smoothedRtt + tickTime - 1) / tickTime);
 		}
-		else
+
+		m_rollback->Reset(latest, lead);
+		return;
+	}
+
+	sf::Clock rollbackClock;
+
+	if(m_rollback->Confirm(latest) > 0)
+	{
+		NetTime rollbackTime = rollbackClock.getElapsedTime().asMicroseconds();
+
+		m_rollbacks++;
+
+		if(rollbackTime > m_worstRollback)
 		{
-			m_gameBall.Move(FAST_SPEED_MOD);
+			m_worstRollback = rollbackTime;
 		}
 	}
+}
+
+// ===== AdvanceRollback ==========================================================================
+// Method will step the rollback session with this cycle's input, and show its' present state: the
+// ball and both paddles are placed where it has them.
+//
+// Input:
+//	[IN] int direction	-	this cycle's input, one of the Paddle::Direction values
+//
+// Output: none
+// ================================================================================================
+void ClientEngine::AdvanceRollback(int direction)
+{
+	if(!m_rollback->IsStarted())
+	{
+		return;
+	}
+
+	m_rollback->Advance(direction, m_inputSequence);
+
+	const SimState &present = m_rollback->GetPresent();
+
+	present.ApplyPositions(m_gameState);
+	UpdateGameData();
+
+	float clientPosition = ((m_networkControl->GetPlayerNumber() == 1) ? present.playerOnePaddlePosition : present.playerTwoPaddlePosition);
+
+	m_clientPaddle->setPosition(m_clientPaddle->getPosition().x, clientPosition);
+}
+
+// ===== PaddleVelocity ===========================================================================
+// Method will find how far a paddle moving in the given direction travels each engine tick.
+//
+// Input:
+//	[IN] int direction	-	one of the Paddle::Direction values
+//
+// Output:
+//	[OUT] float			-	the change in the paddle's y-coordinate per tick
+// ================================================================================================
+float ClientEngine::PaddleVelocity(int direction)
+{
+	if(direction == Paddle::UP)
+	{
+		return ((-1) * Paddle::BASE_MOVE_RATE);
+	}
+	else if(direction == Paddle::DOWN)
+	{
+		return Paddle::BASE_MOVE_RATE;
+	}
+
+	return 0;
+}
+
+// ===== ClampTo ==================================================================================
+// Method will keep a value between the given limits.
+//
+// Input:
+//	[IN] float value	-	the value to clamp
+//	[IN] float low		-	the least value allowed
+//	[IN] float high		-	the greatest value allowed
+//
+// Output:
+//	[OUT] float			-	the value, moved inside the limits if it was outside them
+// ================================================================================================
+float ClientEngine::ClampTo(float value, float low, float high)
+{
+	if(value < low)
+	{
+		return low;
+	}
+	else if(value > high)
+	{
+		return high;
+	}
+
+	return value;
+}
+
+// ===== UpdateNetworkText ========================================================================
+// Method will update the link readout, drawn in the corner of the window by the renderer, with the
+// latest round trip time, jitter, and lost and late packets measured by the CNetworkController. In
+// rollback mode it also shows how many rollbacks there have been and the longest.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientEngine::UpdateNetworkText(void)
+{
+	std::stringstream networkString;
+	LinkStats stats = m_networkControl->GetLinkStats();
+
+	networkString.precision(1);
+	networkString << std::fixed << "RTT ";
+
+	if(stats.rttValid)
+	{
+		networkString << (stats.smoothedRtt / 1000.0) << "ms";
+	}
 	else
 	{
-		m_gameBall.setPosition(ballX, ballY);
-		m_gameBall.SetMoveAngle(ballAngle);
+		networkString << "-";
 	}
+
+	networkString << "  Jitter " << (stats.jitter / 1000.0) << "ms  Lost " << stats.lost << "  Late " << stats.late;
+
+	if(m_rollback != NULL)
+	{
+		networkString << "  Rollbacks " << m_rollbacks << " (worst " << m_worstRollback << "us)";
+	}
+
+	m_networkString = networkString.str();
 }
 
 // ===== CheckPaddleCollisions ====================================================================
@@ -341,14 +828,20 @@ void ClientEngine::CheckPaddleCollisions(void)
 	{
 		if((Calculator::CheckCollision(m_gameBall, *m_leftPaddle)) && (m_gameState.playerOneHealth > 0))
 		{
-			std::cout << "Left Paddle Hit\n";
+			if(m_verbose)
+			{
+				std::cout << "Left Paddle Hit\n";
+			}
 
 			double newAngle = Calculator::GetAngleTo(m_leftPaddle->getPosition().x, 
 													 m_leftPaddle->getPosition().y,
 													 m_gameBall.getPosition().x,
 													 m_gameBall.getPosition().y);
 
-			std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
+			if(m_verbose)
+			{
+				std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
+			}
 
 			// Ensure angle is not too steep; 
 			// Too steep if: (60 < angle < 180) or (180 < angle < 300)
@@ -369,14 +862,20 @@ void ClientEngine::CheckPaddleCollisions(void)
 	{
 		if((Calculator::CheckCollision(m_gameBall, *m_rightPaddle)) && (m_gameState.playerTwoHealth > 0))
 		{
-			std::cout << "Right Paddle Hit\n";
+			if(m_verbose)
+			{
+				std::cout << "Right Paddle Hit\n";
+			}
 
 			double newAngle = Calculator::GetAngleTo(m_rightPaddle->getPosition().x, 
 													 m_rightPaddle->getPosition().y,
 													 m_gameBall.getPosition().x,
 													 m_gameBall.getPosition().y);
 
-			std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
+			if(m_verbose)
+			{
+				std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
+			}
 
 			// Ensure angle is not too steep; 
 			// Too steep if: (angle < 120 ) or (angle > 240)
@@ -396,90 +895,103 @@ void ClientEngine::CheckPaddleCollisions(void)
 
 }
 
-// ===== InterpolateOpponent ======================================================================
-// Method will adjust the opponents paddle position. This method is resonsible for making sure that 
-// the paddle moves smoothly instead of "teleporting" around. The method will be responsible for 
-// adjusting the paddle's position, and setting the speed mod if needed.
+// ===== PredictPaddle ============================================================================
+// Method will apply this cycle's input to the predicted paddle straight away, and keep it, under the
+// next sequence number, until the server acknowledges it. The shown paddle is the prediction plus
+// what is left of the last correction.
 //
 // Input:
-//	[IN] float paddleLoc	-	the opponent paddle's y-coordinate
-//	[IN] int paddleDir		-	the opponent paddle's direction of movement
+//	[IN] int direction	-	this cycle's input, one of the Paddle::Direction values
 //
 // Output: none
 // ================================================================================================
-void ClientEngine::InterpolateOpponent(float paddleLoc, int paddleDir)
+void ClientEngine::PredictPaddle(int direction)
 {
-	if(paddleLoc > m_opponentPaddle->getPosition().y)	// Paddle is too high
-	{
-		double distance = paddleLoc - m_opponentPaddle->getPosition().y;
+	PaddleUpdate input;
 
-		if(distance < SHORT_THRESHOLD)
-		{
-			m_opponentPaddle->setPosition(m_opponentPaddle->getPosition().x, paddleLoc);
-		}
-		else if(distance < MEDIUM_THRESHOLD)
-		{
-			m_opponentPaddle->MoveDown(1);
-		}
-		else if(distance < FAST_THRESHOLD)
-		{
-			m_opponentPaddle->MoveDown(MEDIUM_SPEED_MOD);
-		}
-		else
-		{
-			m_opponentPaddle->MoveDown(FAST_SPEED_MOD);
-		}
-	}
-	else if(paddleLoc < m_opponentPaddle->getPosition().y)	// Paddle is too low
-	{
-		double distance = m_opponentPaddle->getPosition().y - paddleLoc;
+	input.m_sequence = ++m_inputSequence;
+	input.m_paddleDir = direction;
 
-		if(distance < SHORT_THRESHOLD)
-		{
-			m_opponentPaddle->setPosition(m_opponentPaddle->getPosition().x, paddleLoc);
-		}
-		else if(distance < MEDIUM_THRESHOLD)
-		{
-			m_opponentPaddle->MoveUp(1);
-		}
-		else if(distance < FAST_THRESHOLD)
-		{
-			m_opponentPaddle->MoveUp(MEDIUM_SPEED_MOD);
-		}
-		else
-		{
-			m_opponentPaddle->MoveUp(FAST_SPEED_MOD);
-		}
-	}
+	ApplyInput(m_predictedPaddle, direction);
+
+	m_pendingInputs.push_back(input);
 
+	if((int)m_pendingInputs.size() > MAX_PENDING_INPUTS)
+	{
+		m_pendingInputs.pop_front();	// The server has stopped answering, don't grow without bound
+	}
 
-	m_oppMoveDirection = paddleDir;
+	m_predictionError *= CORRECTION_DECAY;
+	m_clientPaddle->setPosition(m_predictedPaddle->getPosition().x, (m_predictedPaddle->getPosition().y + m_predictionError));
 }
 
-// ===== Render ===================================================================================
-// Method will render the main window, the ball, scores, and paddles
+// ===== ReconcilePaddle ==========================================================================
+// Method will check the newest snapshot for a newer acknowledgement of this client's inputs. If
+// there is one, the acknowledged inputs are released and the rest are replayed on top of the
+// server's paddle position. A replay that differs from the prediction by more than the tolerance
+// replaces it, and the difference is shown as a decaying correction.
 //
 // Input: none
 // Output: none
 // ================================================================================================
-void ClientEngine::Render(void)
+void ClientEngine::ReconcilePaddle(void)
 {
-	// Clear Screen
-	m_mainWindow->clear(sf::Color(0, 0, 0));
+	GameData latest = m_networkControl->GetLatestData();
+	bool playerOne = (m_networkControl->GetPlayerNumber() == 1);
+	sf::Uint32 ack = (playerOne ? latest.playerOneLastInput : latest.playerTwoLastInput);
+	float serverPosition = (playerOne ? latest.playerOnePaddlePosition : latest.playerTwoPaddlePosition);
+
+	if((sf::Int32)(ack - m_lastAckedInput) <= 0)
+	{
+		return;		// Nothing new from the server
+	}
+
+	m_lastAckedInput = ack;
+
+	while(!m_pendingInputs.empty() && ((sf::Int32)(m_pendingInputs.front().m_sequence - ack) <= 0))
+	{
+		m_pendingInputs.pop_front();
+	}
+
+	// Replay from the server's view
+	float predicted = m_predictedPaddle->getPosition().y;
 
-	// Draw Pieces
-	m_mainWindow->draw(m_player1ScoreText);
-	m_mainWindow->draw(m_player2ScoreText);
-	m_mainWindow->draw(*m_leftPaddle);
-	m_mainWindow->draw(*m_rightPaddle);
+	m_predictedPaddle->setPosition(m_predictedPaddle->getPosition().x, serverPosition);
 
-	if(m_gameState.healthPackSpawned)
+	for(std::list<PaddleUpdate>::iterator it = m_pendingInputs.begin(); it != m_pendingInputs.end(); it++)
 	{
-		m_mainWindow->draw(m_healthPack);
+		ApplyInput(m_predictedPaddle, it->m_paddleDir);
 	}
 
-	m_mainWindow->draw(m_gameBall);
+	float error = (predicted - m_predictedPaddle->getPosition().y);
 
-	// Display Screen
-	m_mainWindow->display();
-}
\ No newline at end of file
+	if(std::fabs(error) <= RECONCILE_TOLERANCE)
+	{
+		m_predictedPaddle->setPosition(m_predictedPaddle->getPosition().x, predicted);
+	}
+	else
+	{
+		m_predictionError += error;
+	}
+}
+
+// ===== ApplyInput ===============================================================================
+// Method will move a paddle one cycle in the given direction, the same way the server does.
+//
+// Input:
+//	[IN] Paddle *paddle		-	the paddle to move
+//	[IN] int direction		-	one of the Paddle::Direction values
+//
+// Output: none
+// ================================================================================================
+void ClientEngine::ApplyInput(Paddle *paddle, int direction)
+{
+	if(direction == Paddle::UP)
+	{
+		paddle->MoveUp(1);
+	}
+	else if(direction == Paddle::DOWN)
+	{
+		paddle->MoveDown(1);
+	}
+}
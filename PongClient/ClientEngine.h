@@ -6,13 +6,21 @@
 // ================================================================================================
 // Class Description:
 // 
-// The ClientEngine class will control all game logic and updates to the game data.
+// The ClientEngine class will control all game logic and updates to the game data. It steps the
+// game at a fixed ENGINE_SPEED, taking the paddle input from an InputSource once a tick. The
+// client's own paddle is predicted and reconciled with the server. The ball and the opponent's
+// paddle are interpolated between the server's snapshots, or extrapolated when the snapshots stop,
+// unless the engine is in rollback mode, where a RollbackSession simulates the whole game ahead of
+// the server. Each pass publishes a RenderState for the ClientRenderer to draw on its' own thread.
+// A headless engine has no window or renderer, and can be driven by a BotRunner through Start(),
+// Advance() and Finish().
 // ================================================================================================ 
 
 #ifndef CLIENTENGINE_H
 #define CLIENTENGINE_H
 
 #include <list>
+#include <string>
 #include <mutex>
 #include <thread>
 #include <SFML\System\Clock.hpp>
@@ -21,7 +29,11 @@
 #include "CNetworkController.h"
 #include "Paddle.h"
 #include "Ball.h"
-#include "HealthPack.h"
+#include "PaddleUpdate.h"
+#include "RollbackSession.h"
+#include "ClientConfig.h"
+#include "ClientRenderer.h"
+#include "InputSource.h"
 
 class ClientEngine
 {
@@ -33,15 +45,19 @@ public:
 	// ============================================================================================
 
 	// Constructor/Destructor Prototypes
-	ClientEngine(CNetworkController *networkControl);
+	ClientEngine(CNetworkController *networkControl, const ClientConfig *config, InputSource *input);
 	~ClientEngine(void);
 
 	// Prototypes
-	void Render(void);
+	void Run(void);
+	void Start(void);
+	bool Advance(void);
+	NetTime GetTimeToNextTick(void);
+	void Finish(void);
 
 	// Inlined Methods
-	void Run(void);
 	void Stop(void){ m_running = false; }
+	bool IsGameWon(void){ return m_gameState.gameWon; }
 
 private:
 
@@ -50,27 +66,56 @@ private:
 	// ============================================================================================
 
 	// Prototypes
+	void Tick(void);
+	void PollInput(void);
+	void SavePreviousPositions(void);
+	void PublishState(NetTime tickProgress);
 	void UpdateGameData();
+	GameData BlendSnapshots(const GameData &older, const GameData &newer, float alpha);
+	void ExtrapolateState(void);
+	void CheckRollbackBudget(void);
+	void ConfirmRollback(void);
+	void AdvanceRollback(int direction);
+	void StartBlendBack(void);
+	static float PaddleVelocity(int direction);
+	static float ClampTo(float value, float low, float high);
 	void CheckPaddleCollisions(void);
-	void UpdateScoreText(void);
-	void InterpolateBall(float ballX, float ballY, double ballAngle);
-	void InterpolateOpponent(float paddleLoc, int paddleDir);
+	void UpdateNetworkText(void);
+	void PredictPaddle(int direction);
+	void ReconcilePaddle(void);
+	static void ApplyInput(Paddle *paddle, int direction);
 
 	// ============================================================================================
 	// Class Data Members
 	// ============================================================================================
 
-	// Speed Mod Constants
-	static const int SHORT_THRESHOLD;
-	static const int MEDIUM_THRESHOLD;
-	static const int FAST_THRESHOLD;
-	static const float MEDIUM_SPEED_MOD;
-	static const float FAST_SPEED_MOD;
+	// Prediction Constants
+	static const float RECONCILE_TOLERANCE;	// Largest replay difference, in pixels, that isn't corrected
+	static const float CORRECTION_DECAY;	// Fraction of the correction left after each cycle
+	static const int MAX_PENDING_INPUTS;	// Most unacknowledged inputs kept for replay
+
+	// Extrapolation Constants
+	static const int MAX_EXTRAPOLATION;		// Longest time, in ms, the ball and opponent are carried on
+											// without snapshots before they are held
+
+	// Rollback Constants
+	static const int ROLLBACK_BUDGET;		// Longest time, in us, a full rollback should take
+	static const int BUDGET_TRIALS;			// Rollbacks timed by the budget check
+
+	// Fixed Step Constants
+	static const int MAX_CATCH_UP_TICKS;	// Most ticks run in one pass, the rest are skipped
+
+	// Link Readout Constants
+	static const int NETWORK_TEXT_INTERVAL;	// Time, in ms, between refreshes of the link readout
 
 	// Engine Related Members
 	CNetworkController *m_networkControl;
-	sf::Clock m_engineClock;
+	const ClientConfig *m_config;
+	InputSource *m_input;
+	sf::Clock m_engineClock;				// Time since the last pass
+	NetTime m_accumulator;					// Time toward the next tick, in us
 	bool m_running;
+	bool m_verbose;							// False when headless, to print nothing
 
 	// Game Pieces
 	GameData m_gameState;
@@ -79,17 +124,41 @@ private:
 	Paddle *m_clientPaddle;
 	Paddle *m_opponentPaddle;
 	int m_oppMoveDirection;
-	int m_oppSpeedMod;
+
+	// Extrapolation Members
+	int m_extrapolatedTicks;				// Cycles carried on since the buffer ran dry, 0 when not
+	sf::Vector2f m_ballError;				// Blend back still being shown, added to the ball
+	float m_opponentError;					// Blend back still being shown, added to the opponent paddle
 	Ball m_gameBall;
 
+	// Prediction Members
+	Paddle *m_predictedPaddle;				// The client paddle as the inputs so far place it
+	sf::Uint32 m_inputSequence;				// Sequence of the latest input sent
+	sf::Uint32 m_lastAckedInput;			// Latest input the server has applied
+	std::list<PaddleUpdate> m_pendingInputs;	// Inputs sent but not yet applied, oldest first
+	float m_predictionError;				// Correction still being shown, added to the prediction
+
+	// Rollback Members, only used in rollback mode
+	RollbackSession *m_rollback;			// NULL when interpolating snapshots instead
+	int m_lastConfirmedTick;				// Server tick of the last snapshot checked
+	int m_rollbacks;						// Snapshots that needed a rollback
+	NetTime m_worstRollback;				// Longest rollback, in us
+
 	// Window Members
-	sf::RenderWindow *m_mainWindow;
-	sf::Font m_gameFont;
+	sf::RenderWindow *m_mainWindow;			// Created and polled here, drawn in by the renderer, NULL
+											// when headless
+	ClientRenderer *m_renderer;				// NULL when headless
 	int m_player1Score;
-	sf::Text m_player1ScoreText;
 	int m_player2Score;
-	sf::Text m_player2ScoreText;
-	HealthPack m_healthPack;
+	std::string m_networkString;			// Round trip, jitter and loss readout
+	sf::Clock m_networkTextClock;
+
+	// Render State Members
+	sf::Vector2f m_previousBall;			// Positions before the last tick, drawn between
+	sf::Vector2f m_previousLeft;
+	sf::Vector2f m_previousRight;
+	int m_ticks;							// Ticks run since the engine started
+	int m_skippedTicks;						// Ticks skipped since the engine started
 
 };
 
@@ -0,0 +1,366 @@
+// ================================================================================================
+// Filename: "ClientRenderer.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ClientRenderer class. For a class description
+// see the header file "ClientRenderer.h"
+// ================================================================================================
+
+#include <sstream>
+#include <iostream>
+#include <math.h>
+#include "ClientRenderer.h"
+#include "GameData.h"
+
+// Initialize Static Constants
+const float ClientRenderer::SNAP_DISTANCE = 50.0f;
+const int ClientRenderer::READOUT_INTERVAL = 1000;
+const unsigned int ClientRenderer::SCORE_SIZE = 48;
+const unsigned int ClientRenderer::READOUT_SIZE = 14;
+
+// ===== Constructor ==============================================================================
+// The constructor will set-up the window's frame pacing, the pieces and the text. The render
+// thread doesn't start until Start().
+//
+// Input:
+//	[IN] sf::RenderWindow *window		- the window to draw in, created on the engine's thread
+//	[IN] const ClientConfig *config		- the client's options, the frame limit and frame log
+//
+// Output: none
+// ================================================================================================
+ClientRenderer::ClientRenderer(sf::RenderWindow *window, const ClientConfig *config) : m_leftPaddle(1), m_rightPaddle(2),
+	m_scoreGlyphs(&m_gameFont, SCORE_SIZE, sf::Color(255, 255, 255)), m_readoutGlyphs(&m_gameFont, READOUT_SIZE, sf::Color(128, 128, 128))
+{
+	m_mainWindow = window;
+	m_config = config;
+	m_renderThread = NULL;
+	m_running = false;
+
+	if(m_config->frameLimit > 0)
+	{
+		m_mainWindow->setFramerateLimit(m_config->frameLimit);
+	}
+	else
+	{
+		m_mainWindow->setVerticalSyncEnabled(true);
+	}
+
+	m_healthPackSpawned = false;
+
+	// Initialize Text Members
+	if(!m_gameFont.loadFromFile("arial.ttf"))
+	{
+		std::cout << "Font Error\n";
+		m_mainWindow->close();
+	}
+
+	m_player1Score = 0;
+	m_player2Score = 0;
+
+	RebuildScores();
+
+	// Initialize Frame Members
+	m_frames = 0;
+	m_frameTimeTotal = 0;
+	m_worstFrame = 0;
+	m_lastTicks = 0;
+	m_lastSkippedTicks = 0;
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will stop the render thread if it is still running.
+// ================================================================================================
+ClientRenderer::~ClientRenderer(void)
+{
+	Stop();
+}
+
+// ===== Start ====================================================================================
+// Method will hand the window's drawing over to a new render thread. The engine should have
+// published its' first state.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientRenderer::Start(void)
+{
+	if(m_renderThread != NULL)
+	{
+		return;
+	}
+
+	m_mainWindow->setActive(false);		// A context can only be active on one thread
+
+	m_running = true;
+	m_frameClock.restart();
+	m_readoutClock.restart();
+	m_renderThread = new std::thread(&ClientRenderer::RenderLoop, this);
+}
+
+// ===== Stop =====================================================================================
+// Method will end the render thread, waiting for the frame being drawn, and hand the window back
+// to the calling thread.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientRenderer::Stop(void)
+{
+	if(m_renderThread == NULL)
+	{
+		return;
+	}
+
+	m_running = false;				// Set Thread-Loop conditional to false
+	m_renderThread->join();			// Wait for thread to end
+	delete m_renderThread;
+	m_renderThread = NULL;
+
+	m_mainWindow->setActive(true);
+}
+
+// ===== RenderLoop ===============================================================================
+// This method is the render thread. Every frame it takes the latest state the engine published,
+// finds how far the engine is toward its' next tick, draws, and keeps the frame stats. display()
+// waits for the display's refresh, or the frame limit, so the loop is paced without sleeping.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientRenderer::RenderLoop(void)
+{
+	NetTime tickTime = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+
+	m_mainWindow->setActive(true);
+
+	while(m_running)
+	{
+		RecordFrame(m_frameClock.restart().asMicroseconds());
+
+		if(m_states.TakeLatest())
+		{
+			ApplyState(m_states.GetFront());
+		}
+
+		const RenderState &state = m_states.GetFront();
+
+		// How Far Between the Last Tick and the Next
+		float alpha = (float)(state.tickProgress + (GetTime() - state.publishTime)) / tickTime;
+
+		if(alpha > 1)
+		{
+			alpha = 1;
+		}
+
+		// Refresh the Frame Readout
+		if(m_readoutClock.getElapsedTime().asMilliseconds() >= READOUT_INTERVAL)
+		{
+			UpdateFrameText(state);
+		}
+
+		Render(state, alpha);
+	}
+
+	m_mainWindow->setActive(false);
+}
+
+// ===== ApplyState ===============================================================================
+// Method will bring everything but the moving pieces up to a newly taken state: the paddles'
+// health, the health pack, the scores and the link readout. The glyph quads are only rebuilt when
+// the text changes.
+//
+// Input:
+//	[IN] const RenderState &state	- the state just taken
+//
+// Output: none
+// ================================================================================================
+void ClientRenderer::ApplyState(const RenderState &state)
+{
+	if(m_leftPaddle.GetHealth() != state.playerOneHealth)
+	{
+		m_leftPaddle.SetHealth(state.playerOneHealth);
+	}
+
+	if(m_rightPaddle.GetHealth() != state.playerTwoHealth)
+	{
+		m_rightPaddle.SetHealth(state.playerTwoHealth);
+	}
+
+	m_healthPackSpawned = state.healthPackSpawned;
+
+	if((m_player1Score != state.playerOneScore) || (m_player2Score != state.playerTwoScore))
+	{
+		m_player1Score = state.playerOneScore;
+		m_player2Score = state.playerTwoScore;
+
+		RebuildScores();
+	}
+
+	if(m_networkString != state.networkText)
+	{
+		m_networkString = state.networkText;
+
+		RebuildReadouts();
+	}
+}
+
+// ===== Render ===================================================================================
+// Method will draw the game in three draw calls: the score glyphs, the readout glyphs, and one
+// batch of every shape. The shape batch is rebuilt each frame, with the ball and paddles placed
+// between where they were before the last tick and where it left them, by the given fraction of a
+// tick; a piece that jumped further than SNAP_DISTANCE in the tick, such as the ball on a serve, is
+// placed where it is.
+//
+// Input:
+//	[IN] const RenderState &state	-	the state to draw
+//	[IN] float alpha				-	how far the frame is toward the next tick, 0 to 1
+//
+// Output: none
+// ================================================================================================
+void ClientRenderer::Render(const RenderState &state, float alpha)
+{
+	m_leftPaddle.setPosition(state.leftPosition);
+	m_rightPaddle.setPosition(state.rightPosition);
+	m_gameBall.setPosition(state.ballPosition);
+
+	// Batch Pieces
+	m_shapes.Clear();
+	m_shapes.AddShape(m_leftPaddle, BetweenTicks(state.previousLeft, state.leftPosition, alpha));
+	m_shapes.AddShape(m_rightPaddle, BetweenTicks(state.previousRight, state.rightPosition, alpha));
+
+	if(m_healthPackSpawned)
+	{
+		m_shapes.AddShape(m_healthPack, sf::Vector2f(0, 0));
+	}
+
+	m_shapes.AddShape(m_gameBall, BetweenTicks(state.previousBall, state.ballPosition, alpha));
+
+	// Clear Screen
+	m_mainWindow->clear(sf::Color(0, 0, 0));
+
+	// Draw Batches
+	m_scoreGlyphs.Draw(*m_mainWindow);
+	m_readoutGlyphs.Draw(*m_mainWindow);
+	m_shapes.Draw(*m_mainWindow);
+
+	// Display Screen
+	m_mainWindow->display();
+}
+
+// ===== BetweenTicks =============================================================================
+// Method will find the offset that moves a piece drawn at its' current position back to the given
+// fraction of a tick between its' previous and current positions.
+//
+// Input:
+//	[IN] sf::Vector2f previous	-	the piece's position before the last tick
+//	[IN] sf::Vector2f current	-	the piece's position after it
+//	[IN] float alpha			-	how far the frame is toward the next tick, 0 to 1
+//
+// Output:
+//	[OUT] sf::Vector2f			-	the offset to draw the piece at
+// ================================================================================================
+sf::Vector2f ClientRenderer::BetweenTicks(sf::Vector2f previous, sf::Vector2f current, float alpha)
+{
+	sf::Vector2f step = (current - previous);
+
+	if((fabs(step.x) > SNAP_DISTANCE) || (fabs(step.y) > SNAP_DISTANCE))
+	{
+		return sf::Vector2f(0, 0);
+	}
+
+	return ((-step) * (1 - alpha));
+}
+
+// ===== RebuildScores ============================================================================
+// Method will lay the score glyphs out again, each score centered 150 pixels either side of the
+// middle of the board.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientRenderer::RebuildScores(void)
+{
+	std::stringstream p1String;
+	std::stringstream p2String;
+	float top = (25 + (SCORE_SIZE / 2.0f));
+
+	p1String << m_player1Score;
+	p2String << m_player2Score;
+
+	m_scoreGlyphs.Clear();
+	m_scoreGlyphs.AddCentered(p1String.str(), sf::Vector2f(((float)(GameData::BOARD_WIDTH / 2) - 150), top));
+	m_scoreGlyphs.AddCentered(p2String.str(), sf::Vector2f(((float)(GameData::BOARD_WIDTH / 2) + 150), top));
+}
+
+// ===== RebuildReadouts ==========================================================================
+// Method will lay the readout glyphs out again, the frame readout above the link readout in the
+// bottom corner.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientRenderer::RebuildReadouts(void)
+{
+	m_readoutGlyphs.Clear();
+	m_readoutGlyphs.AddString(m_frameString, sf::Vector2f(10, ((float)GameData::BOARD_HEIGHT - 42)));
+	m_readoutGlyphs.AddString(m_networkString, sf::Vector2f(10, ((float)GameData::BOARD_HEIGHT - 24)));
+}
+
+// ===== RecordFrame ==============================================================================
+// Method will add a frame's time to the frame stats.
+//
+// Input:
+//	[IN] NetTime frameTime	- time since the last frame, in us
+//
+// Output: none
+// ================================================================================================
+void ClientRenderer::RecordFrame(NetTime frameTime)
+{
+	m_frames++;
+	m_frameTimeTotal += frameTime;
+
+	if(frameTime > m_worstFrame)
+	{
+		m_worstFrame = frameTime;
+	}
+}
+
+// ===== UpdateFrameText ==========================================================================
+// Method will update the frame readout with the stats since the last refresh, frames per second,
+// the mean and longest frame time, and the ticks the engine ran and skipped, and start counting
+// again. When the frame log is on, the readout is printed too, once every frame log interval.
+//
+// Input:
+//	[IN] const RenderState &state	- the latest state, for the engine's tick counts
+//
+// Output: none
+// ================================================================================================
+void ClientRenderer::UpdateFrameText(const RenderState &state)
+{
+	std::stringstream frameString;
+	double seconds = (m_readoutClock.restart().asMicroseconds() / 1000000.0);
+	double meanFrame = ((m_frames > 0) ? ((double)m_frameTimeTotal / m_frames) : 0);
+
+	frameString.precision(1);
+	frameString << std::fixed << "FPS " << (m_frames / seconds) << "  Frame " << (meanFrame / 1000.0) << "ms (worst "
+				<< (m_worstFrame / 1000.0) << "ms)  Ticks " << (state.ticks - m_lastTicks) << "  Skipped "
+				<< (state.skippedTicks - m_lastSkippedTicks);
+
+	m_frameString = frameString.str();
+
+	RebuildReadouts();
+
+	if((m_config->frameLogInterval > 0) && (m_frameLogClock.getElapsedTime().asMilliseconds() >= m_config->frameLogInterval))
+	{
+		m_frameLogClock.restart();
+		std::cout << frameString.str() << "\n";
+	}
+
+	m_frames = 0;
+	m_frameTimeTotal = 0;
+	m_worstFrame = 0;
+	m_lastTicks = state.ticks;
+	m_lastSkippedTicks = state.skippedTicks;
+}
@@ -0,0 +1,141 @@
+// ================================================================================================
+// Filename: "ClientRenderer.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ClientRenderer class draws the game on a thread of its' own, so that drawing, and waiting in
+// display() for the display's refresh, never holds up the ClientEngine's input sampling, snapshot
+// handling, or paddle updates.
+//
+// The engine publishes a RenderState through the renderer's RenderStateBuffer after every burst of
+// ticks. Each frame, the render thread takes the latest published state, if there is a newer one,
+// and draws it. The renderer has its' own ball, paddles and health pack to draw, placed from the
+// state, so it never touches the engine's pieces. The ball and paddles are drawn between their
+// positions before and after the last tick, by how far the engine had got toward the next tick
+// when it published plus the time since, so motion stays smooth whether the display runs faster
+// or slower than the engine.
+//
+// Drawing is batched. Every shape is copied into one ShapeBatch each frame, and the scores and the
+// readouts are each kept as a GlyphBatch that is only laid out again when its' text changes, so a
+// frame takes three draw calls.
+//
+// Frames are paced by vsync, or by the frame limit in the ClientConfig. The renderer keeps its' own
+// frame stats, the frame rate and the mean and longest frame time, and shows them with the ticks
+// the engine ran and skipped above the link readout.
+//
+// The window must be created, and its' events polled, on the engine's thread. Start() hands the
+// window's drawing to the render thread, and Stop() hands it back.
+// ================================================================================================
+
+#ifndef CLIENTRENDERER_H
+#define CLIENTRENDERER_H
+
+#include <string>
+#include <thread>
+#include <atomic>
+#include <SFML\System\Clock.hpp>
+#include <SFML\Graphics.hpp>
+#include "Paddle.h"
+#include "Ball.h"
+#include "HealthPack.h"
+#include "RenderState.h"
+#include "ShapeBatch.h"
+#include "GlyphBatch.h"
+#include "ClientConfig.h"
+#include "NetTime.h"
+
+class ClientRenderer
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ClientRenderer(sf::RenderWindow *window, const ClientConfig *config);
+	~ClientRenderer(void);
+
+	// Method Prototypes
+	void Start(void);
+	void Stop(void);
+
+	// Inlined Methods
+	RenderState& GetNextState(void){ return m_states.GetBack(); }
+	void Publish(void){ m_states.Publish(); }
+	NetTime GetTime(void) const { return TimeBase::Now(&m_stateClock); }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const float SNAP_DISTANCE;		// Largest move, in pixels, in one tick that is drawn
+											// between ticks rather than snapped to
+	static const int READOUT_INTERVAL;		// Time, in ms, between refreshes of the frame readout
+	static const unsigned int SCORE_SIZE;	// Character size of the scores
+	static const unsigned int READOUT_SIZE;	// Character size of the readouts
+
+private:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Prototypes
+	void RenderLoop(void);
+	void ApplyState(const RenderState &state);
+	void Render(const RenderState &state, float alpha);
+	static sf::Vector2f BetweenTicks(sf::Vector2f previous, sf::Vector2f current, float alpha);
+	void RebuildScores(void);
+	void RebuildReadouts(void);
+	void RecordFrame(NetTime frameTime);
+	void UpdateFrameText(const RenderState &state);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Renderer Members
+	sf::RenderWindow *m_mainWindow;
+	const ClientConfig *m_config;
+	std::thread *m_renderThread;
+	std::atomic<bool> m_running;			// Thread-loop conditional, cleared by Stop() on the engine thread
+	RenderStateBuffer m_states;
+	sf::Clock m_stateClock;					// Never restarted, states are published on it
+
+	// Pieces, placed from the front state
+	Paddle m_leftPaddle;
+	Paddle m_rightPaddle;
+	Ball m_gameBall;
+	HealthPack m_healthPack;
+	bool m_healthPackSpawned;
+
+	// Batches
+	ShapeBatch m_shapes;					// Rebuilt every frame
+	GlyphBatch m_scoreGlyphs;				// Rebuilt when a score changes
+	GlyphBatch m_readoutGlyphs;				// Rebuilt when a readout changes
+
+	// Text Members
+	sf::Font m_gameFont;
+	int m_player1Score;
+	int m_player2Score;
+	std::string m_networkString;			// The link readout being shown
+	std::string m_frameString;				// Frame rate, frame time and tick readout
+
+	// Frame Members
+	sf::Clock m_frameClock;					// Time since the last frame
+	sf::Clock m_readoutClock;
+	sf::Clock m_frameLogClock;
+	int m_frames;							// Frames since the readout was last refreshed
+	NetTime m_frameTimeTotal;
+	NetTime m_worstFrame;
+	int m_lastTicks;						// The state's tick counts at the last refresh
+	int m_lastSkippedTicks;
+};
+
+#endif
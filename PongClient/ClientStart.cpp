@@ -6,6 +6,19 @@
 // ================================================================================================
 // This file is where client execution will start. It will get the server IP from the user, attempt
 // a connection and if successful, will prepare the client for play.
+//
+// Command Line Options:
+//	-rollback				- simulate the whole game locally and roll it back to correct it, instead
+//							  of interpolating the server's snapshots
+//	-fps <n>				- most frames drawn per second, 0 to pace to the display's refresh
+//	-frame-log <ms>			- print the frame time stats this often, 0 for off
+//	-server <address>		- the server to connect to, as it would be typed at the prompt, so the
+//							  client can start without one
+//	-headless				- run with no window, font or rendering, from a bot's input
+//	-bots <n>				- run n headless clients in this process, for load generation
+//	-input <source>			- keyboard, ai, script:<file> or replay:<file>; defaults to the keyboard
+//							  with a window and ai without
+//	-record <file>			- record every input the client gives to a file a replay can play back
 // ================================================================================================
 
 #include <Windows.h>
@@ -13,18 +26,26 @@
 #include <string>
 #include <cstdio>
 #include <thread>
+#include <functional>
 #include <SFML/Graphics.hpp>
 #include <sstream>
 #include "Paddle.h"
 #include "CNetworkController.h"
+#include "ClientConfig.h"
 #include "ClientEngine.h"
+#include "InputSource.h"
+#include "BotRunner.h"
+#include "TcpTransport.h"
+#include "SharedMemoryTransport.h"
 
 // Game Constants
 const int PONG_SERVER_PORT = 8585;
 const std::string PONG_SERVER_LOCAL_HOST = "127.0.0.1"; 
+const std::string PONG_SERVER_SHARED_MEMORY = "SHM";
 
 // Function Prototypes
 bool CheckIP(std::string &ipString);
+bool ParseIP(std::string command, std::string &ipString);
 unsigned GetNumberOfDigits (unsigned i);
 
 int main(int argc, char* argv[])
@@ -36,14 +57,53 @@ int main(int argc, char* argv[])
 	bool ipValid = false;
 	bool initialized = false;
 
+	// Read Command Line Options
+	ClientConfig config;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!config.ParseOption(argc, argv, i))
+		{
+			std::cout << "Ignoring unknown option " << argv[i] << "\n";
+		}
+	}
+
+	if(config.frameLimit < 0)
+	{
+		config.frameLimit = 0;
+	}
+
+	if(config.frameLogInterval < 0)
+	{
+		config.frameLogInterval = 0;
+	}
+
+	if(config.bots < 1)
+	{
+		config.bots = 1;
+	}
+
 	// Connection Data
 	std::string ipString;
 	sf::IpAddress serverIP;
 	sf::Clock gameClock;
 
+	if(!config.server.empty())
+	{
+		ipValid = ParseIP(config.server, ipString);
+
+		if(!ipValid)
+		{
+			std::cout << "\nInvalid server " << config.server << "\n";
+			return 1;
+		}
+
+		serverIP = ipString;
+	}
+
 	while (!ipValid)
 	{
-		std::cout << "\nPlease enter the IP address of the PongServer (xxx.xxx.xxx.xxx)\nIncluding zeros; xxx.67.xxx.xxx should be written as xxx.067.xxx.xxx\nEnter 'LH' for local host\n\nIP: ";
+		std::cout << "\nPlease enter the IP address of the PongServer (xxx.xxx.xxx.xxx)\nIncluding zeros; xxx.67.xxx.xxx should be written as xxx.067.xxx.xxx\nEnter 'LH' for local host\nEnter 'SHM' for a server on this machine over shared memory\n\nIP: ";
 
 		if(CheckIP(ipString))
 		{
@@ -52,21 +112,48 @@ int main(int argc, char* argv[])
 		}
 	}
 
-	// Attempt Connection to Server
-	CNetworkController serverConnection(serverIP, PONG_SERVER_PORT, &gameClock);
+	// Attempt Connection to Server; the same connector is used to resume after a dropped connection
+	std::function<Transport*(void)> connector;
+
+	if(ipString == PONG_SERVER_SHARED_MEMORY)
+	{
+		connector = [](){ return (Transport*)SharedMemoryTransport::Connect(PONG_SERVER_PORT); };
+	}
+	else
+	{
+		connector = [serverIP](){ return (Transport*)TcpTransport::Connect(serverIP, PONG_SERVER_PORT); };
+	}
+
+	// Headless Bots Drive Their Own Connections
+	if(config.headless)
+	{
+		BotRunner runner(&config, connector, &gameClock);
+		return runner.Run();
+	}
+
+	CNetworkController serverConnection(connector(), &gameClock, connector);
 
 	if(serverConnection.IsConnected())
 	{
 		std::cout << "Connection Established with Server.\nWaiting for initialization data from server...\n";
 
-		while(!serverConnection.ShouldStartGame())
+		if(serverConnection.WaitForStart())
 		{
-			Sleep(1000);
-		}
+			InputSource *input = InputSource::Create(&config, serverConnection.GetPlayerNumber(), 0);
 
-		std::cout << "Client Engine Starting...\n";
-		ClientEngine engine(&serverConnection);
-		engine.Run();
+			if(input != NULL)
+			{
+				std::cout << "Client Engine Starting...\n";
+				ClientEngine engine(&serverConnection, &config, input);
+				engine.Run();
+			}
+
+			delete input;
+		}
+		else
+		{
+			std::cout << "Lost connection to the server before the game started.\n";
+		}
 	}
 	else
 	{
@@ -85,7 +172,7 @@ int main(int argc, char* argv[])
 // checks the first 15. This is to "flush" the input buffer, in case the user enters too many 
 // character which will cause the check to be called again immediately. If the entered IP address is
 // valid, or the user enteres "LH", the method will assign the ip as a string the to passed string
-// paramter.
+// paramter. If the user enters "SHM", the string will be set to PONG_SERVER_SHARED_MEMORY instead.
 //
 // Input: 
 //	[IN/OUT] std::string &ipString	-	a reference to a string that will be used to hold the ipAddress
@@ -96,13 +183,31 @@ int main(int argc, char* argv[])
 bool CheckIP(std::string &ipString)
 {
 	char tempIP[256];
-	std::string delimiter = ".";
 
 	fgets(tempIP, 256, stdin);	// Get the next characters off input stream
 
 	std::string command = std::string(tempIP);
 	//remove \n
 	command.pop_back();
+
+	return ParseIP(command, ipString);
+}
+
+// ===== ParseIP ==================================================================================
+// This method checks an entered server, from the prompt or the -server option, the same way
+// CheckIP() describes.
+//
+// Input:
+//	[IN] std::string command			-	the entered server
+//	[IN/OUT] std::string &ipString	-	a reference to a string that will be used to hold the ipAddress
+//
+// Output:
+//	[OUT] bool						-	true if IP is valid, false otherwise
+// ================================================================================================
+bool ParseIP(std::string command, std::string &ipString)
+{
+	std::string delimiter = ".";
+
 	//check if it's now empty
 	if(command.empty())
 	{
@@ -117,6 +222,13 @@ bool CheckIP(std::string &ipString)
 		return true;
 	}
 
+	if(_stricmp(command.c_str(), "SHM") == 0)
+	{
+		std::cout << "Shared Memory Specified\n";
+		ipString = PONG_SERVER_SHARED_MEMORY;
+		return true;
+	}
+
 	//check if everything is a number or the delimeter
 	if(command.find_first_not_of("0123456789"+delimiter) != std::string::npos)
 	{
@@ -0,0 +1,131 @@
+// ================================================================================================
+// Filename: "GlyphBatch.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the GlyphBatch class. For a class description see the
+// header file "GlyphBatch.h"
+// ================================================================================================
+
+#include "GlyphBatch.h"
+
+// ===== Constructor ==============================================================================
+// The constructor will start the batch empty.
+//
+// Input:
+//	[IN] const sf::Font *font			- the font to lay the strings out in, must outlive the batch
+//	[IN] unsigned int characterSize		- the character size, in pixels
+//	[IN] sf::Color color				- the color of every glyph
+//
+// Output: none
+// ================================================================================================
+GlyphBatch::GlyphBatch(const sf::Font *font, unsigned int characterSize, sf::Color color) : m_vertices(sf::Triangles)
+{
+	m_font = font;
+	m_characterSize = characterSize;
+	m_color = color;
+}
+
+// ===== AddString ================================================================================
+// Method will add the glyph quads of a string to the batch.
+//
+// Input:
+//	[IN] const std::string &text	- the string, on one line
+//	[IN] sf::Vector2f position		- the top left of the string
+//
+// Output: none
+// ================================================================================================
+void GlyphBatch::AddString(const std::string &text, sf::Vector2f position)
+{
+	float x = position.x;
+	float y = (position.y + m_characterSize);		// Baseline
+	sf::Uint32 previous = 0;
+
+	for(std::string::size_type i = 0; i < text.size(); i++)
+	{
+		sf::Uint32 current = (unsigned char)text[i];
+		const sf::Glyph &glyph = m_font->getGlyph(current, m_characterSize, false);
+
+		x += m_font->getKerning(previous, current, m_characterSize);
+		previous = current;
+
+		float left = (x + glyph.bounds.left);
+		float top = (y + glyph.bounds.top);
+		float right = (left + glyph.bounds.width);
+		float bottom = (top + glyph.bounds.height);
+
+		float u1 = (float)glyph.textureRect.left;
+		float v1 = (float)glyph.textureRect.top;
+		float u2 = (float)(glyph.textureRect.left + glyph.textureRect.width);
+		float v2 = (float)(glyph.textureRect.top + glyph.textureRect.height);
+
+		if((glyph.bounds.width > 0) && (glyph.bounds.height > 0))
+		{
+			m_vertices.append(sf::Vertex(sf::Vector2f(left, top), m_color, sf::Vector2f(u1, v1)));
+			m_vertices.append(sf::Vertex(sf::Vector2f(right, top), m_color, sf::Vector2f(u2, v1)));
+			m_vertices.append(sf::Vertex(sf::Vector2f(left, bottom), m_color, sf::Vector2f(u1, v2)));
+			m_vertices.append(sf::Vertex(sf::Vector2f(left, bottom), m_color, sf::Vector2f(u1, v2)));
+			m_vertices.append(sf::Vertex(sf::Vector2f(right, top), m_color, sf::Vector2f(u2, v1)));
+			m_vertices.append(sf::Vertex(sf::Vector2f(right, bottom), m_color, sf::Vector2f(u2, v2)));
+		}
+
+		x += glyph.advance;
+	}
+}
+
+// ===== AddCentered ==============================================================================
+// Method will add the glyph quads of a string to the batch, centered on a point.
+//
+// Input:
+//	[IN] const std::string &text	- the string, on one line
+//	[IN] sf::Vector2f center		- where the center of the string goes
+//
+// Output: none
+// ================================================================================================
+void GlyphBatch::AddCentered(const std::string &text, sf::Vector2f center)
+{
+	AddString(text, sf::Vector2f((center.x - (MeasureWidth(text) / 2)), (center.y - (m_characterSize / 2.0f))));
+}
+
+// ===== MeasureWidth =============================================================================
+// Method will find how wide a string is laid out, from its' start to the end of its' last advance.
+//
+// Input:
+//	[IN] const std::string &text	- the string, on one line
+//
+// Output:
+//	[OUT] float						- its' width, in pixels
+// ================================================================================================
+float GlyphBatch::MeasureWidth(const std::string &text)
+{
+	float width = 0;
+	sf::Uint32 previous = 0;
+
+	for(std::string::size_type i = 0; i < text.size(); i++)
+	{
+		sf::Uint32 current = (unsigned char)text[i];
+
+		width += m_font->getKerning(previous, current, m_characterSize);
+		width += m_font->getGlyph(current, m_characterSize, false).advance;
+		previous = current;
+	}
+
+	return width;
+}
+
+// ===== Draw =====================================================================================
+// Method will draw every glyph in the batch with one draw call.
+//
+// Input:
+//	[IN/OUT] sf::RenderTarget &target	- the target to draw to
+//
+// Output: none
+// ================================================================================================
+void GlyphBatch::Draw(sf::RenderTarget &target)
+{
+	if(m_vertices.getVertexCount() > 0)
+	{
+		target.draw(m_vertices, sf::RenderStates(&m_font->getTexture(m_characterSize)));
+	}
+}
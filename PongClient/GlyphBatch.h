@@ -0,0 +1,58 @@
+// ================================================================================================
+// Filename: "GlyphBatch.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The GlyphBatch class holds the glyph quads of one or more strings, all in one font, size and
+// color, in one textured sf::VertexArray, so they are drawn with a single draw() call against the
+// font's glyph texture. An sf::Text per string would cost a draw call each.
+//
+// The quads are cached: they are only rebuilt when the strings change, by Clear() and AddString()
+// again, not every frame. Glyphs are laid out the way sf::Text lays them out, by each glyph's
+// bounds and advance and the kerning between pairs, with the baseline one character size below the
+// given top.
+//
+// Every size of a font has its' own glyph texture, so strings of different sizes need a batch
+// each.
+// ================================================================================================
+
+#ifndef GLYPHBATCH_H
+#define GLYPHBATCH_H
+
+#include <string>
+#include <SFML\Graphics.hpp>
+
+class GlyphBatch
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	GlyphBatch(const sf::Font *font, unsigned int characterSize, sf::Color color);
+	~GlyphBatch(void){}
+
+	// Method Prototypes
+	void AddString(const std::string &text, sf::Vector2f position);
+	void AddCentered(const std::string &text, sf::Vector2f center);
+	float MeasureWidth(const std::string &text);
+	void Draw(sf::RenderTarget &target);
+
+	// Inlined Methods
+	void Clear(void){ m_vertices.clear(); }
+
+private:
+
+	const sf::Font *m_font;
+	unsigned int m_characterSize;
+	sf::Color m_color;
+	sf::VertexArray m_vertices;
+};
+
+#endif
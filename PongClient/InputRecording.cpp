@@ -0,0 +1,183 @@
+// ================================================================================================
+// Filename: "InputRecording.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the RecordingInput and ReplayInput classes. For a
+// class description see the header file "InputRecording.h"
+// ================================================================================================
+
+#include "InputRecording.h"
+#include "Paddle.h"
+
+// Initialize Static Constants
+const int RecordingInput::TICKS_PER_LINE = 60;
+
+// ===== RecordingInput Constructor ===============================================================
+// The constructor will take ownership of the source to record. Nothing is recorded until the file
+// is opened.
+//
+// Input:
+//	[IN] InputSource *source	- the source to record
+//
+// Output: none
+// ================================================================================================
+RecordingInput::RecordingInput(InputSource *source)
+{
+	m_source = source;
+	m_ticksOnLine = 0;
+}
+
+// ===== RecordingInput Destructor ================================================================
+// The destructor will finish the recording's last line and release the recorded source.
+// ================================================================================================
+RecordingInput::~RecordingInput(void)
+{
+	if(m_file.is_open() && (m_ticksOnLine > 0))
+	{
+		m_file << "\n";
+	}
+
+	delete m_source;
+}
+
+// ===== RecordingInput::Open =====================================================================
+// Method will create the file to record to, replacing any file already there.
+//
+// Input:
+//	[IN] const std::string &path	- the file to record to
+//
+// Output:
+//	[OUT] bool						- true if the file was opened, false otherwise
+// ================================================================================================
+bool RecordingInput::Open(const std::string &path)
+{
+	m_file.open(path.c_str(), std::ios::out | std::ios::trunc);
+
+	return m_file.is_open();
+}
+
+// ===== RecordingInput::NextDirection ============================================================
+// Method will get the recorded source's next direction, and write it to the file.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it
+//	[IN] float paddlePosition		- the center of the client's paddle
+//
+// Output:
+//	[OUT] int						- the source's direction
+// ================================================================================================
+int RecordingInput::NextDirection(const GameData &gameState, float paddlePosition)
+{
+	int direction = m_source->NextDirection(gameState, paddlePosition);
+
+	if(direction == Paddle::UP)
+	{
+		m_file << 'U';
+	}
+	else if(direction == Paddle::DOWN)
+	{
+		m_file << 'D';
+	}
+	else
+	{
+		m_file << 'S';
+	}
+
+	if(++m_ticksOnLine == TICKS_PER_LINE)
+	{
+		m_file << "\n";
+		m_ticksOnLine = 0;
+	}
+
+	return direction;
+}
+
+// ===== RecordingInput::HandleEvent ==============================================================
+// Method will pass a window event on to the recorded source.
+//
+// Input:
+//	[IN] const sf::Event &event		- an event the engine polled
+//
+// Output: none
+// ================================================================================================
+void RecordingInput::HandleEvent(const sf::Event &event)
+{
+	m_source->HandleEvent(event);
+}
+
+// ===== ReplayInput Default Constructor ==========================================================
+// The default constructor will start with an empty recording, which holds the paddle still.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ReplayInput::ReplayInput(void)
+{
+	m_next = 0;
+}
+
+// ===== ReplayInput::Load ========================================================================
+// Method will read a recording from a file.
+//
+// Input:
+//	[IN] const std::string &path	- the recording's file
+//
+// Output:
+//	[OUT] bool						- true if the file was read, false otherwise
+// ================================================================================================
+bool ReplayInput::Load(const std::string &path)
+{
+	std::ifstream file(path.c_str());
+	char direction;
+
+	if(!file)
+	{
+		return false;
+	}
+
+	m_directions.clear();
+	m_next = 0;
+
+	while(file.get(direction))
+	{
+		if((direction == 'U') || (direction == 'D') || (direction == 'S'))
+		{
+			m_directions.push_back(direction);
+		}
+	}
+
+	return true;
+}
+
+// ===== ReplayInput::NextDirection ===============================================================
+// Method will give the recording's direction for the next tick, or still once it has run out.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it, unused
+//	[IN] float paddlePosition		- the client's paddle, unused
+//
+// Output:
+//	[OUT] int						- one of the Paddle::Direction values
+// ================================================================================================
+int ReplayInput::NextDirection(const GameData &gameState, float paddlePosition)
+{
+	if(m_next >= m_directions.size())
+	{
+		return Paddle::STILL;
+	}
+
+	char direction = m_directions[m_next++];
+
+	if(direction == 'U')
+	{
+		return Paddle::UP;
+	}
+	else if(direction == 'D')
+	{
+		return Paddle::DOWN;
+	}
+
+	return Paddle::STILL;
+}
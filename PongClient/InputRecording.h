@@ -0,0 +1,77 @@
+// ================================================================================================
+// Filename: "InputRecording.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The RecordingInput and ReplayInput classes record a client's inputs and play them back.
+//
+// A RecordingInput wraps another InputSource. It passes every direction the source gives, and every
+// event, straight through, and writes each direction to a file as it goes. A ReplayInput reads such
+// a file back and gives the same directions, one per tick, then holds the paddle still once the
+// recording runs out.
+//
+// A recording is one character per engine tick, 'U', 'D' or 'S', so a minute of play is under 4KB.
+// Newlines are written every second's worth of ticks to keep the file readable, and are skipped on
+// playback.
+// ================================================================================================
+
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+
+#include <string>
+#include <fstream>
+#include "InputSource.h"
+
+// ================================================================================================
+// RecordingInput - records another source's directions
+// ================================================================================================
+class RecordingInput: public InputSource
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	RecordingInput(InputSource *source);
+	~RecordingInput(void);
+
+	// Method Prototypes
+	bool Open(const std::string &path);
+	int NextDirection(const GameData &gameState, float paddlePosition);
+	void HandleEvent(const sf::Event &event);
+
+	// Constants
+	static const int TICKS_PER_LINE;		// Directions written before each newline
+
+private:
+
+	InputSource *m_source;					// Owned, deleted with the recording
+	std::ofstream m_file;
+	int m_ticksOnLine;
+};
+
+// ================================================================================================
+// ReplayInput - plays a recording back
+// ================================================================================================
+class ReplayInput: public InputSource
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	ReplayInput(void);
+	~ReplayInput(void){}
+
+	// Method Prototypes
+	bool Load(const std::string &path);
+	int NextDirection(const GameData &gameState, float paddlePosition);
+
+private:
+
+	std::string m_directions;				// The recording, newlines removed
+	std::string::size_type m_next;			// The direction for the next tick
+};
+
+#endif
@@ -0,0 +1,180 @@
+// ================================================================================================
+// Filename: "InputSource.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the InputSource and KeyboardInput classes. For a class
+// description see the header file "InputSource.h"
+// ================================================================================================
+
+#include <iostream>
+#include <sstream>
+#include "InputSource.h"
+#include "BotInput.h"
+#include "InputRecording.h"
+#include "Paddle.h"
+
+// ===== Create ===================================================================================
+// Method will build the input source the config asks for, wrapped in a RecordingInput if it asks
+// for a recording. When the process runs more than one client, replays and recordings are per
+// client, so the client's index is added to their file names: "game.txt" becomes "game.txt.3".
+//
+// Input:
+//	[IN] const ClientConfig *config		- the client's options
+//	[IN] int playerNumber				- the client's player number, 1 or 2
+//	[IN] int clientIndex				- which of the process's clients this is, from 0
+//
+// Output:
+//	[OUT] InputSource*					- the new source, to be deleted by the caller, or NULL if the
+//										  config names an unknown source or a file that can't be read
+// ================================================================================================
+InputSource* InputSource::Create(const ClientConfig *config, int playerNumber, int clientIndex)
+{
+	std::string kind = config->inputSource;
+	std::string path;
+	std::string::size_type colon = kind.find(':');
+	std::stringstream suffix;
+
+	if(config->bots > 1)
+	{
+		suffix << "." << clientIndex;
+	}
+
+	if(colon != std::string::npos)
+	{
+		path = kind.substr(colon + 1);
+		kind = kind.substr(0, colon);
+	}
+
+	if(kind.empty())
+	{
+		kind = (config->headless ? "ai" : "keyboard");
+	}
+
+	InputSource *source = NULL;
+
+	if((kind == "keyboard") && !config->headless)
+	{
+		source = new KeyboardInput();
+	}
+	else if(kind == "ai")
+	{
+		source = new AiInput(playerNumber);
+	}
+	else if(kind == "script")
+	{
+		ScriptedInput *script = new ScriptedInput();
+
+		if(script->Load(path))
+		{
+			source = script;
+		}
+		else
+		{
+			std::cout << "Could not read the input script " << path << "\n";
+			delete script;
+		}
+	}
+	else if(kind == "replay")
+	{
+		ReplayInput *replay = new ReplayInput();
+
+		if(replay->Load(path + suffix.str()))
+		{
+			source = replay;
+		}
+		else
+		{
+			std::cout << "Could not read the input recording " << (path + suffix.str()) << "\n";
+			delete replay;
+		}
+	}
+	else
+	{
+		std::cout << "Unknown input source " << config->inputSource << "\n";
+	}
+
+	if((source != NULL) && !config->recordFile.empty())
+	{
+		RecordingInput *recording = new RecordingInput(source);
+
+		if(recording->Open(config->recordFile + suffix.str()))
+		{
+			source = recording;
+		}
+		else
+		{
+			std::cout << "Could not open " << (config->recordFile + suffix.str()) << " to record to\n";
+			delete recording;
+			source = NULL;
+		}
+	}
+
+	return source;
+}
+
+// ===== KeyboardInput Default Constructor ========================================================
+// The default constructor will start with neither key held.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+KeyboardInput::KeyboardInput(void)
+{
+	m_wPressed = false;
+	m_sPressed = false;
+}
+
+// ===== KeyboardInput::NextDirection =============================================================
+// Method will give the direction the held keys ask for: up for W, down for S, and still for
+// neither or both.
+//
+// Input:
+//	[IN] const GameData &gameState	- the game as the client shows it, unused
+//	[IN] float paddlePosition		- the client's paddle, unused
+//
+// Output:
+//	[OUT] int						- one of the Paddle::Direction values
+// ================================================================================================
+int KeyboardInput::NextDirection(const GameData &gameState, float paddlePosition)
+{
+	if((m_wPressed) && (!m_sPressed))
+	{
+		return Paddle::UP;
+	}
+	else if((m_sPressed) && (!m_wPressed))
+	{
+		return Paddle::DOWN;
+	}
+
+	return Paddle::STILL;
+}
+
+// ===== KeyboardInput::HandleEvent ===============================================================
+// Method will keep track of which keys are held from the window's events.
+//
+// Input:
+//	[IN] const sf::Event &event		- an event the engine polled
+//
+// Output: none
+// ================================================================================================
+void KeyboardInput::HandleEvent(const sf::Event &event)
+{
+	if((event.type == sf::Event::KeyPressed) && (event.key.code == sf::Keyboard::W))
+	{
+		m_wPressed = true;
+	}
+	else if((event.type == sf::Event::KeyPressed) && (event.key.code == sf::Keyboard::S))
+	{
+		m_sPressed = true;
+	}
+	else if((event.type == sf::Event::KeyReleased) && (event.key.code == sf::Keyboard::W))
+	{
+		m_wPressed = false;
+	}
+	else if((event.type == sf::Event::KeyReleased) && (event.key.code == sf::Keyboard::S))
+	{
+		m_sPressed = false;
+	}
+}
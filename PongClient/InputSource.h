@@ -0,0 +1,79 @@
+// ================================================================================================
+// Filename: "InputSource.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The InputSource class is the interface the ClientEngine gets its' paddle input from. Once every
+// engine tick it asks its' source for a direction, given the game as the client currently shows
+// it, and predicts and sends that direction exactly as it would a key press. Where the input comes
+// from doesn't matter to the engine, so the same network, prediction and interpolation code runs
+// for a player at the keyboard, a bot, a scripted test, or a replay of a recorded game.
+//
+// Sources that need the window's events, such as the keyboard, are given every event the engine
+// polls through HandleEvent(). A headless engine has no window, so it never calls it.
+//
+// Create() builds the source the ClientConfig asks for:
+//	KeyboardInput	- the W and S keys, the default with a window
+//	AiInput			- follows the ball, the default when headless (see "BotInput.h")
+//	ScriptedInput	- repeats a script of directions and tick counts (see "BotInput.h")
+//	ReplayInput		- plays back a recording, one direction per tick (see "InputRecording.h")
+// and, when the config asks for a recording, wraps it in a RecordingInput that writes every
+// direction it gives to a file a ReplayInput can play back.
+// ================================================================================================
+
+#ifndef INPUTSOURCE_H
+#define INPUTSOURCE_H
+
+#include <SFML\Window\Event.hpp>
+#include "GameData.h"
+#include "ClientConfig.h"
+
+// ================================================================================================
+// InputSource - the interface
+// ================================================================================================
+class InputSource
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Destructor
+	virtual ~InputSource(void){}
+
+	// Interface Prototypes
+	virtual int NextDirection(const GameData &gameState, float paddlePosition) = 0;
+	virtual void HandleEvent(const sf::Event &event){}
+
+	// Static Methods
+	static InputSource* Create(const ClientConfig *config, int playerNumber, int clientIndex);
+};
+
+// ================================================================================================
+// KeyboardInput - the W and S keys, from the window's events
+// ================================================================================================
+class KeyboardInput: public InputSource
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	KeyboardInput(void);
+	~KeyboardInput(void){}
+
+	// Method Prototypes
+	int NextDirection(const GameData &gameState, float paddlePosition);
+	void HandleEvent(const sf::Event &event);
+
+private:
+
+	bool m_wPressed;
+	bool m_sPressed;
+};
+
+#endif
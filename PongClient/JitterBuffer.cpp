@@ -0,0 +1,264 @@
+// ================================================================================================
+// Filename: "JitterBuffer.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the JitterBuffer class. For a class description see
+// the header file "JitterBuffer.h"
+// ================================================================================================
+
+#include <cstdlib>
+#include <algorithm>
+#include "JitterBuffer.h"
+
+// Initialize Static Constants
+const int JitterBuffer::MAX_SNAPSHOTS = 32;
+const int JitterBuffer::OFFSET_WINDOW = 64;
+const int JitterBuffer::MIN_PLAYOUT_DELAY = GameData::ENGINE_SPEED;
+const int JitterBuffer::MAX_PLAYOUT_DELAY = 250;
+const float JitterBuffer::JITTER_MULTIPLIER = 3;
+
+// ===== Constructor ==============================================================================
+// The constructor will zero the jitter estimate and start the playout delay at its' minimum.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+JitterBuffer::JitterBuffer(void)
+{
+	Clear();
+}
+
+// ===== Clear ====================================================================================
+// Method will empty the buffer and reset all estimates.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void JitterBuffer::Clear(void)
+{
+	m_snapshots.clear();
+	m_offsetSamples.clear();
+	m_lastConsumedTick = -1;
+
+	m_hasArrival = false;
+	m_lastArrivalTime = 0;
+	m_lastServerTime = 0;
+	m_jitter = 0;
+	m_spacing = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+	m_playoutDelay = TimeBase::FromMilliseconds(MIN_PLAYOUT_DELAY);
+	m_clockOffset = 0;
+}
+
+// ===== Insert ===================================================================================
+// Method will place a snapshot into the buffer in server tick order. Snapshots older than the last
+// one handed to the engine, or with a tick that is already buffered, are dropped.
+//
+// Input:
+//	[IN] const GameData &snapshot	- the snapshot received from the server
+//	[IN] NetTime arrivalTime		- the local time the snapshot arrived
+//
+// Output:
+//	[OUT] bool						- true if the snapshot was buffered, false if it was dropped
+// ================================================================================================
+bool JitterBuffer::Insert(const GameData &snapshot, NetTime arrivalTime)
+{
+	if(snapshot.serverTick <= m_lastConsumedTick)
+	{
+		return false;	// Too late to be used
+	}
+
+	UpdateEstimates(snapshot, arrivalTime);
+
+	// Walk backwards, late packets are usually only a tick or two behind
+	std::list<Entry>::iterator it = m_snapshots.end();
+
+	while(it != m_snapshots.begin())
+	{
+		std::list<Entry>::iterator prev = it;
+		prev--;
+
+		if(prev->data.serverTick == snapshot.serverTick)
+		{
+			return false;	// Duplicate
+		}
+		else if(prev->data.serverTick < snapshot.serverTick)
+		{
+			break;
+		}
+
+		it = prev;
+	}
+
+	Entry entry;
+	entry.data = snapshot;
+	entry.arrivalTime = arrivalTime;
+	m_snapshots.insert(it, entry);
+
+	while((int)m_snapshots.size() > MAX_SNAPSHOTS)
+	{
+		m_snapshots.pop_front();
+	}
+
+	return true;
+}
+
+// ===== UpdateEstimates ==========================================================================
+// Method will update the jitter, clock offset, and playout delay estimates with a new arrival. The
+// jitter is the smoothed difference between how far apart two snapshots arrived and how far apart
+// the server sent them (the RFC 3550 interarrival jitter). The clock offset is the smallest
+// (server time - arrival time) seen in the recent window, which lines the render clock up with the
+// fastest path through the network. The spacing is the smoothed server time between a snapshot
+// and the one before it.
+//
+// Input:
+//	[IN] const GameData &snapshot	- the snapshot that just arrived
+//	[IN] NetTime arrivalTime		- the local time the snapshot arrived
+//
+// Output: none
+// ================================================================================================
+void JitterBuffer::UpdateEstimates(const GameData &snapshot, NetTime arrivalTime)
+{
+	if(m_hasArrival)
+	{
+		NetTime transitDiff = ((arrivalTime - m_lastArrivalTime) - (snapshot.serverTime - m_lastServerTime));
+
+		NetTime gap = (snapshot.serverTime - m_lastServerTime);
+
+		m_jitter += ((std::llabs(transitDiff) - m_jitter) / 16);
+
+		if(gap > 0)
+		{
+			m_spacing += ((gap - m_spacing) / 8);
+		}
+	}
+
+	m_hasArrival = true;
+	m_lastArrivalTime = arrivalTime;
+	m_lastServerTime = snapshot.serverTime;
+
+	// Windowed minimum of the clock offset
+	m_offsetSamples.push_back(snapshot.serverTime - arrivalTime);
+
+	if((int)m_offsetSamples.size() > OFFSET_WINDOW)
+	{
+		m_offsetSamples.pop_front();
+	}
+
+	m_clockOffset = m_offsetSamples.front();
+
+	for(std::list<NetTime>::iterator it = m_offsetSamples.begin(); it != m_offsetSamples.end(); it++)
+	{
+		if(*it < m_clockOffset)
+		{
+			m_clockOffset = *it;
+		}
+	}
+
+	// Keep one snapshot's spacing, at least a tick, plus enough headroom to ride out the measured jitter
+	NetTime spacing = std::max(m_spacing, TimeBase::FromMilliseconds(GameData::ENGINE_SPEED));
+
+	m_playoutDelay = (spacing + (NetTime)(JITTER_MULTIPLIER * m_jitter));
+
+	if(m_playoutDelay < TimeBase::FromMilliseconds(MIN_PLAYOUT_DELAY))
+	{
+		m_playoutDelay = TimeBase::FromMilliseconds(MIN_PLAYOUT_DELAY);
+	}
+	else if(m_playoutDelay > TimeBase::FromMilliseconds(MAX_PLAYOUT_DELAY))
+	{
+		m_playoutDelay = TimeBase::FromMilliseconds(MAX_PLAYOUT_DELAY);
+	}
+}
+
+// ===== GetBracket ===============================================================================
+// Method will find the two buffered snapshots whose server times bracket the current render time,
+// and how far between them the render time falls. Snapshots older than the bracket are released.
+//
+// If the render time is before the oldest snapshot, both references receive the oldest snapshot.
+// If the render time is past the newest snapshot, both receive the newest and the method returns
+// false so the engine knows it has run out of data.
+//
+// Input:
+//	[IN] NetTime localTime		- the current local time
+//	[IN/OUT] GameData &older	- receives the snapshot at or before the render time
+//	[IN/OUT] GameData &newer	- receives the snapshot after the render time
+//	[IN/OUT] float &alpha		- receives the blend factor between older (0) and newer (1)
+//
+// Output:
+//	[OUT] bool					- true if the render time was bracketed, false otherwise
+// ================================================================================================
+bool JitterBuffer::GetBracket(NetTime localTime, GameData &older, GameData &newer, float &alpha)
+{
+	if(m_snapshots.empty())
+	{
+		return false;
+	}
+
+	NetTime renderTime = (localTime + m_clockOffset - m_playoutDelay);
+
+	// Before the oldest snapshot
+	if(renderTime < m_snapshots.front().data.serverTime)
+	{
+		older = m_snapshots.front().data;
+		newer = older;
+		alpha = 0;
+		return true;
+	}
+
+	std::list<Entry>::iterator it = m_snapshots.begin();
+	std::list<Entry>::iterator next = it;
+	next++;
+
+	while(next != m_snapshots.end())
+	{
+		if(next->data.serverTime > renderTime)
+		{
+			break;
+		}
+
+		it = next;
+		next++;
+	}
+
+	// Release everything before the bracket
+	m_snapshots.erase(m_snapshots.begin(), it);
+	m_lastConsumedTick = (it->data.serverTick - 1);
+
+	older = it->data;
+
+	if(next == m_snapshots.end())	// Past the newest snapshot
+	{
+		newer = older;
+		alpha = 0;
+		return false;
+	}
+
+	newer = next->data;
+
+	NetTime span = (newer.serverTime - older.serverTime);
+	alpha = ((span > 0) ? ((float)(renderTime - older.serverTime) / span) : 0);
+
+	return true;
+}
+
+// ===== GetLatest ================================================================================
+// Method will place the newest buffered snapshot into the reference.
+//
+// Input:
+//	[IN/OUT] GameData &latest	- receives the newest snapshot
+//
+// Output:
+//	[OUT] bool					- true if a snapshot was available, false otherwise
+// ================================================================================================
+bool JitterBuffer::GetLatest(GameData &latest)
+{
+	if(m_snapshots.empty())
+	{
+		return false;
+	}
+
+	latest = m_snapshots.back().data;
+
+	return true;
+}
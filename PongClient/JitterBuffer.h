@@ -0,0 +1,94 @@
+// ================================================================================================
+// Filename: "JitterBuffer.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The JitterBuffer class will hold the GameData snapshots received from the server, ordered by the
+// server tick that produced them. Snapshots that arrive late or out of order are slotted into place
+// and duplicates are dropped.
+//
+// Every snapshot is stamped with the local time it arrived. The buffer uses those arrival times to
+// estimate the network jitter and to size its own playout delay. The engine asks the buffer for the
+// two snapshots that bracket the current render time (local time converted to server time, minus
+// the playout delay) and blends between them. The server sends fewer snapshots to a client on a
+// slow link, so the buffer also tracks how far apart the snapshots are, and the playout delay is
+// kept at least that long so there is always a newer snapshot to blend towards.
+//
+// All times are NetTimes; the snapshots' server times must already be expanded.
+//
+// The JitterBuffer is not thread safe. The CNetworkController will guard it with its' data lock.
+// ================================================================================================
+
+#ifndef JITTERBUFFER_H
+#define JITTERBUFFER_H
+
+#include <list>
+#include "GameData.h"
+
+class JitterBuffer
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	JitterBuffer(void);
+	~JitterBuffer(void){}
+
+	// Method Prototypes
+	bool Insert(const GameData &snapshot, NetTime arrivalTime);
+	bool GetBracket(NetTime localTime, GameData &older, GameData &newer, float &alpha);
+	bool GetLatest(GameData &latest);
+	void Clear(void);
+
+	// Inlined Methods
+	bool IsEmpty(void){ return m_snapshots.empty(); }
+	NetTime GetPlayoutDelay(void){ return m_playoutDelay; }
+	double GetJitter(void){ return m_jitter; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int MAX_SNAPSHOTS;			// Most snapshots that will be held at once
+	static const int OFFSET_WINDOW;			// Number of arrivals used to estimate the clock offset
+	static const int MIN_PLAYOUT_DELAY;		// Smallest playout delay, in ms
+	static const int MAX_PLAYOUT_DELAY;		// Largest playout delay, in ms
+	static const float JITTER_MULTIPLIER;	// How many jitters of headroom the playout delay keeps
+
+private:
+
+	// A buffered snapshot and the local time it arrived
+	struct Entry
+	{
+		GameData data;
+		NetTime arrivalTime;
+	};
+
+	void UpdateEstimates(const GameData &snapshot, NetTime arrivalTime);
+
+	// Buffered Snapshots, oldest tick first
+	std::list<Entry> m_snapshots;
+	int m_lastConsumedTick;
+
+	// Jitter Estimate
+	bool m_hasArrival;
+	NetTime m_lastArrivalTime;
+	NetTime m_lastServerTime;
+	double m_jitter;
+	NetTime m_spacing;				// Smoothed server time between snapshots
+	NetTime m_playoutDelay;
+
+	// Clock Offset Estimate (server time - arrival time)
+	std::list<NetTime> m_offsetSamples;
+	NetTime m_clockOffset;
+};
+
+#endif
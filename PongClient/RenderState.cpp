@@ -0,0 +1,88 @@
+// ================================================================================================
+// Filename: "RenderState.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the RenderState and RenderStateBuffer classes. For a
+// class description see the header file "RenderState.h"
+// ================================================================================================
+
+#include "RenderState.h"
+
+// Initialize Static Constants
+const int RenderStateBuffer::INDEX_MASK = 3;
+const int RenderStateBuffer::FRESH = 4;
+
+// ===== RenderState Default Constructor ==========================================================
+// The default constructor will start with nothing on the board, full health and no score.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+RenderState::RenderState(void)
+{
+	publishTime = 0;
+	tickProgress = 0;
+
+	ballPosition = sf::Vector2f(0, 0);
+	previousBall = sf::Vector2f(0, 0);
+	leftPosition = sf::Vector2f(0, 0);
+	previousLeft = sf::Vector2f(0, 0);
+	rightPosition = sf::Vector2f(0, 0);
+	previousRight = sf::Vector2f(0, 0);
+	playerOneHealth = 100;
+	playerTwoHealth = 100;
+	healthPackSpawned = false;
+
+	playerOneScore = 0;
+	playerTwoScore = 0;
+	ticks = 0;
+	skippedTicks = 0;
+}
+
+// ===== Default Constructor ======================================================================
+// The default constructor will allocate the three states, with nothing published yet.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+RenderStateBuffer::RenderStateBuffer(void) : m_states(3)
+{
+	m_back = 0;
+	m_middle = 1;
+	m_front = 2;
+}
+
+// ===== Publish ==================================================================================
+// Method will be called by the engine once it has filled in the back state. The back state becomes
+// the latest, and the engine is given the old middle state to fill in next.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RenderStateBuffer::Publish(void)
+{
+	m_back = (m_middle.exchange(m_back | FRESH) & INDEX_MASK);
+}
+
+// ===== TakeLatest ===============================================================================
+// Method will be called by the renderer before each frame. If a state has been published since
+// the last call it becomes the front state, and the renderer's old front state is handed back.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if the front state is a new one, false if it is the same as last frame
+// ================================================================================================
+bool RenderStateBuffer::TakeLatest(void)
+{
+	if((m_middle.load() & FRESH) == 0)
+	{
+		return false;
+	}
+
+	m_front = (m_middle.exchange(m_front) & INDEX_MASK);
+
+	return true;
+}
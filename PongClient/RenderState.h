@@ -0,0 +1,113 @@
+// ================================================================================================
+// Filename: "RenderState.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The RenderState class is everything the ClientRenderer needs to draw one frame: where the ball
+// and paddles were before and after the last engine tick, the paddles' health, the health pack,
+// the scores, and the readout text. The ClientEngine fills one in after each burst of ticks and
+// publishes it; once published it is never changed, so the renderer can read it without a lock.
+//
+// The RenderStateBuffer class passes RenderStates from the engine's thread to the render thread
+// by triple buffering. It holds three states: the back one the engine is filling, the front one
+// the renderer is drawing, and a middle one, the latest published, waiting to be taken. Publish()
+// swaps the back state with the middle one, and TakeLatest() swaps the middle state with the front
+// one if a newer state has been published since. Each swap is a single atomic exchange of an index,
+// so neither thread ever waits on the other: the engine never waits for a frame to be drawn, and
+// a slow display() never holds up the engine's input sampling or its' paddle updates. If the
+// engine publishes twice between frames the renderer only sees the newer state, and if the
+// renderer draws twice between ticks it draws the same state again.
+//
+// To increase simplicity, the RenderState class will make all members public. A RenderStateBuffer
+// must have exactly one thread calling GetBack() and Publish(), and one calling TakeLatest() and
+// GetFront().
+// ================================================================================================
+
+#ifndef RENDERSTATE_H
+#define RENDERSTATE_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <SFML\System\Vector2.hpp>
+#include "NetTime.h"
+
+// ================================================================================================
+// RenderState - one frame's worth of the game, as the engine left it
+// ================================================================================================
+class RenderState
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	RenderState(void);
+	~RenderState(void){}
+
+	// Timing
+	NetTime publishTime;				// When it was published, on the renderer's clock
+	NetTime tickProgress;				// Time toward the next tick when it was published, in us
+
+	// Game Pieces, before and after the last tick
+	sf::Vector2f ballPosition;
+	sf::Vector2f previousBall;
+	sf::Vector2f leftPosition;
+	sf::Vector2f previousLeft;
+	sf::Vector2f rightPosition;
+	sf::Vector2f previousRight;
+	int playerOneHealth;
+	int playerTwoHealth;
+	bool healthPackSpawned;
+
+	// Readouts
+	int playerOneScore;
+	int playerTwoScore;
+	std::string networkText;			// Round trip, jitter and loss readout
+	int ticks;							// Ticks run since the engine started
+	int skippedTicks;					// Ticks skipped since the engine started
+};
+
+// ================================================================================================
+// RenderStateBuffer
+// ================================================================================================
+class RenderStateBuffer
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	RenderStateBuffer(void);
+	~RenderStateBuffer(void){}
+
+	// Method Prototypes
+	void Publish(void);
+	bool TakeLatest(void);
+
+	// Inlined Methods
+	RenderState& GetBack(void){ return m_states[m_back]; }
+	const RenderState& GetFront(void){ return m_states[m_front]; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int INDEX_MASK;		// Bits of the middle holding its' index
+	static const int FRESH;				// Set in the middle when it hasn't been taken yet
+
+private:
+
+	std::vector<RenderState> m_states;
+	int m_back;							// Only touched by the engine's thread
+	std::atomic<int> m_middle;			// Index of the latest published state, and FRESH
+	int m_front;						// Only touched by the render thread
+};
+
+#endif
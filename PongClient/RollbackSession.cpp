@@ -0,0 +1,232 @@
+// ================================================================================================
+// Filename: "RollbackSession.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the RollbackSession class. For a class description
+// see the header file "RollbackSession.h"
+// ================================================================================================
+
+#include <SFML\System\Clock.hpp>
+#include "RollbackSession.h"
+#include "Paddle.h"
+
+// Initialize Static Constants
+const int RollbackSession::RING_SIZE = 32;
+const int RollbackSession::MAX_ROLLBACK = 15;
+const float RollbackSession::STATE_TOLERANCE = 0.5f;
+
+// ===== Constructor ==============================================================================
+// The constructor will allocate the ring. The session doesn't start until the first Reset().
+//
+// Input:
+//	[IN] int playerNumber	- this client's player number, 1 or 2
+//
+// Output: none
+// ================================================================================================
+RollbackSession::RollbackSession(int playerNumber) : m_frames(RING_SIZE)
+{
+	m_playerNumber = playerNumber;
+	m_started = false;
+	m_lead = 1;
+	m_presentTick = 0;
+	m_opponentDirection = Paddle::STILL;
+}
+
+// ===== Reset ====================================================================================
+// Method will start the session from a snapshot, and simulate ahead of it by the lead with no input
+// from this client and the opponent's direction from the snapshot.
+//
+// Input:
+//	[IN] const GameData &snapshot	- the snapshot to start from
+//	[IN] int lead					- ticks to run ahead of the snapshot, about a round trip
+//
+// Output: none
+// ================================================================================================
+void RollbackSession::Reset(const GameData &snapshot, int lead)
+{
+	m_started = true;
+	m_lead = lead;
+
+	if(m_lead < 0)
+	{
+		m_lead = 0;
+	}
+	else if(m_lead > MAX_ROLLBACK)
+	{
+		m_lead = MAX_ROLLBACK;
+	}
+
+	m_opponentDirection = ((m_playerNumber == 1) ? snapshot.playerTwoDirection : snapshot.playerOneDirection);
+	m_presentTick = snapshot.serverTick;
+
+	Frame &first = GetFrame(m_presentTick);
+
+	first.state = SimState::FromGameData(snapshot);
+	first.localDirection = Paddle::STILL;
+	first.opponentDirection = (sf::Int8)m_opponentDirection;
+	first.sequence = 0;
+
+	for(int i = 0; i < m_lead; i++)
+	{
+		Advance(Paddle::STILL, 0);
+	}
+}
+
+// ===== Advance ==================================================================================
+// Method will simulate the next tick with this client's input and the predicted opponent input.
+//
+// Input:
+//	[IN] int direction			- this client's input, one of the Paddle::Direction values
+//	[IN] sf::Uint32 sequence	- the sequence number the input was sent with
+//
+// Output: none
+// ================================================================================================
+void RollbackSession::Advance(int direction, sf::Uint32 sequence)
+{
+	if(!m_started)
+	{
+		return;
+	}
+
+	const SimState &previous = GetFrame(m_presentTick).state;
+
+	m_presentTick++;
+
+	Frame &frame = GetFrame(m_presentTick);
+
+	frame.localDirection = (sf::Int8)direction;
+	frame.opponentDirection = (sf::Int8)m_opponentDirection;
+	frame.sequence = sequence;
+
+	StepFrame(frame, previous, direction);
+}
+
+// ===== Confirm ==================================================================================
+// Method will check a snapshot from the server against the simulated tick it covers, and roll back
+// and simulate again from it if the prediction was wrong.
+//
+// Input:
+//	[IN] const GameData &snapshot	- the newest snapshot from the server
+//
+// Output:
+//	[OUT] int						- ticks simulated again, 0 if the prediction held, or -1 if the
+//									  session had drifted too far and was started again
+// ================================================================================================
+int RollbackSession::Confirm(const GameData &snapshot)
+{
+	sf::Int32 depth = (sf::Int32)(m_presentTick - snapshot.serverTick);
+
+	if(!m_started || (depth < 0) || (depth > MAX_ROLLBACK))
+	{
+		Reset(snapshot, m_lead);
+		return -1;
+	}
+
+	m_opponentDirection = ((m_playerNumber == 1) ? snapshot.playerTwoDirection : snapshot.playerOneDirection);
+
+	Frame &confirmed = GetFrame(snapshot.serverTick);
+	SimState authoritative = SimState::FromGameData(snapshot);
+	bool mispredicted = !confirmed.state.Matches(authoritative, STATE_TOLERANCE);
+
+	for(sf::Uint32 tick = snapshot.serverTick; (tick != (m_presentTick + 1)) && !mispredicted; tick++)
+	{
+		mispredicted = (GetFrame(tick).opponentDirection != m_opponentDirection);
+	}
+
+	if(!mispredicted)
+	{
+		return 0;
+	}
+
+	confirmed.state = authoritative;
+	confirmed.opponentDirection = (sf::Int8)m_opponentDirection;
+
+	Resimulate(snapshot.serverTick, ((m_playerNumber == 1) ? snapshot.playerOneLastInput : snapshot.playerTwoLastInput));
+
+	return depth;
+}
+
+// ===== Resimulate ===============================================================================
+// Method will step every tick after the restored one again, up to the present. The opponent is
+// given its' confirmed direction throughout. This client's inputs the server has already applied
+// are part of the restored state, so only the ones after the acknowledged sequence are replayed.
+//
+// Input:
+//	[IN] sf::Uint32 fromTick	- the tick that was restored
+//	[IN] sf::Uint32 acked		- the last of this client's inputs the server had applied by then
+//
+// Output: none
+// ================================================================================================
+void RollbackSession::Resimulate(sf::Uint32 fromTick, sf::Uint32 acked)
+{
+	for(sf::Uint32 tick = (fromTick + 1); tick != (m_presentTick + 1); tick++)
+	{
+		Frame &frame = GetFrame(tick);
+		int direction = Paddle::STILL;
+
+		if((frame.sequence != 0) && ((sf::Int32)(frame.sequence - acked) > 0))
+		{
+			direction = frame.localDirection;
+		}
+
+		frame.opponentDirection = (sf::Int8)m_opponentDirection;
+
+		StepFrame(frame, GetFrame(tick - 1).state, direction);
+	}
+}
+
+// ===== StepFrame ================================================================================
+// Method will simulate one tick from the state before it into a frame, using the frame's opponent
+// direction.
+//
+// Input:
+//	[IN/OUT] Frame &frame				- the tick to simulate
+//	[IN] const SimState &previous		- the state after the tick before
+//	[IN] int localDirection				- this client's input for the tick
+//
+// Output: none
+// ================================================================================================
+void RollbackSession::StepFrame(Frame &frame, const SimState &previous, int localDirection)
+{
+	frame.state = previous;
+
+	if(m_playerNumber == 1)
+	{
+		frame.state.Step(localDirection, frame.opponentDirection);
+	}
+	else
+	{
+		frame.state.Step(frame.opponentDirection, localDirection);
+	}
+}
+
+// ===== MeasureRollback ==========================================================================
+// Method will time rollbacks of the given depth on a session of its' own. Every trial confirms a
+// snapshot whose opponent direction differs from the last, so every trial rolls back in full.
+//
+// Input:
+//	[IN] int ticks		- the rollback depth, at most MAX_ROLLBACK
+//	[IN] int trials		- rollbacks to average over
+//
+// Output:
+//	[OUT] NetTime		- the mean time of one rollback, in us
+// ================================================================================================
+NetTime RollbackSession::MeasureRollback(int ticks, int trials)
+{
+	RollbackSession session(1);
+	GameData snapshot;
+
+	session.Reset(snapshot, ticks);
+
+	sf::Clock clock;
+
+	for(int i = 0; i < trials; i++)
+	{
+		snapshot.playerTwoDirection = (((i % 2) == 0) ? Paddle::UP : Paddle::DOWN);
+		session.Confirm(snapshot);
+	}
+
+	return (clock.getElapsedTime().asMicroseconds() / ((trials > 0) ? trials : 1));
+}
@@ -0,0 +1,94 @@
+// ================================================================================================
+// Filename: "RollbackSession.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The RollbackSession class runs the whole game on the client, both paddles and the ball, a few
+// ticks ahead of the server, and corrects it the way GGPO does. It keeps a ring of the last
+// RING_SIZE ticks: the SimState after each one, and the inputs it was stepped with.
+//
+// Each engine cycle, Advance() steps the present tick with this client's input and a prediction of
+// the opponent's, which is simply the last direction the server reported for it. The session runs
+// ahead of the newest snapshot by about a round trip, so this client's input reaches the server in
+// time for the tick it was simulated on.
+//
+// When a snapshot arrives, Confirm() checks it against the ring. If the opponent's direction was
+// predicted right for that tick and every tick after it, and the stored state agrees with the
+// snapshot, nothing is done. Otherwise the snapshot's state is restored in place of the stored one
+// and every tick since is simulated again, with the opponent's corrected direction and this
+// client's inputs the server hasn't applied yet. A snapshot more than MAX_ROLLBACK ticks behind the
+// present, or ahead of it, means the session has drifted too far from the server, and it is started
+// again from the snapshot.
+//
+// MeasureRollback() times a full MAX_ROLLBACK tick rollback, so the engine can check it fits in a
+// frame on this machine.
+// ================================================================================================
+
+#ifndef ROLLBACKSESSION_H
+#define ROLLBACKSESSION_H
+
+#include <vector>
+#include <SFML\Config.hpp>
+#include "GameData.h"
+#include "SimState.h"
+#include "NetTime.h"
+
+class RollbackSession
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	RollbackSession(int playerNumber);
+	~RollbackSession(void){}
+
+	// Method Prototypes
+	void Reset(const GameData &snapshot, int lead);
+	void Advance(int direction, sf::Uint32 sequence);
+	int Confirm(const GameData &snapshot);
+	static NetTime MeasureRollback(int ticks, int trials);
+
+	// Inlined Methods
+	bool IsStarted(void){ return m_started; }
+	const SimState& GetPresent(void){ return GetFrame(m_presentTick).state; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int RING_SIZE;				// Ticks of history kept
+	static const int MAX_ROLLBACK;			// Most ticks simulated again for one snapshot
+	static const float STATE_TOLERANCE;		// Largest difference, in pixels, from a snapshot that isn't corrected
+
+private:
+
+	// A simulated tick, the inputs it was stepped with and the state after it
+	struct Frame
+	{
+		SimState state;
+		sf::Int8 localDirection;
+		sf::Int8 opponentDirection;
+		sf::Uint32 sequence;			// This client's input sequence, 0 if none was sent this tick
+	};
+
+	Frame& GetFrame(sf::Uint32 tick){ return m_frames[tick % RING_SIZE]; }
+	void Resimulate(sf::Uint32 fromTick, sf::Uint32 acked);
+	void StepFrame(Frame &frame, const SimState &previous, int localDirection);
+
+	int m_playerNumber;
+	bool m_started;
+	int m_lead;							// Ticks the present was ahead of the snapshot it started from
+	sf::Uint32 m_presentTick;
+	int m_opponentDirection;			// The opponent's last confirmed direction, used as the prediction
+	std::vector<Frame> m_frames;		// Indexed by tick modulo RING_SIZE
+};
+
+#endif
@@ -0,0 +1,159 @@
+// ================================================================================================
+// Filename: "ShapeBatch.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ShapeBatch class. For a class description see the
+// header file "ShapeBatch.h"
+// ================================================================================================
+
+#include <math.h>
+#include "ShapeBatch.h"
+
+// ===== Default Constructor ======================================================================
+// The default constructor will start the batch empty.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ShapeBatch::ShapeBatch(void) : m_vertices(sf::Triangles)
+{
+}
+
+// ===== AddShape =================================================================================
+// Method will add a shape's fill and outline to the batch, where the shape would draw them, moved
+// by the offset.
+//
+// Input:
+//	[IN] const sf::Shape &shape		- the shape to add
+//	[IN] sf::Vector2f offset		- how far from the shape's own position to draw it
+//
+// Output: none
+// ================================================================================================
+void ShapeBatch::AddShape(const sf::Shape &shape, sf::Vector2f offset)
+{
+	unsigned int count = shape.getPointCount();
+
+	if(count < 3)
+	{
+		return;
+	}
+
+	sf::Transform transform;
+	transform.translate(offset);
+	transform.combine(shape.getTransform());
+
+	// Center of the points, to find which side of each edge is outside
+	sf::Vector2f center(0, 0);
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		center += shape.getPoint(i);
+	}
+
+	center /= (float)count;
+
+	// Fill, a fan of triangles from the first point
+	sf::Vector2f first = transform.transformPoint(shape.getPoint(0));
+
+	for(unsigned int i = 1; (i + 1) < count; i++)
+	{
+		AddTriangle(first, transform.transformPoint(shape.getPoint(i)), transform.transformPoint(shape.getPoint(i + 1)), shape.getFillColor());
+	}
+
+	// Outline, a band along the edges
+	float thickness = shape.getOutlineThickness();
+
+	if(thickness == 0)
+	{
+		return;
+	}
+
+	m_inner.resize(count);
+	m_outer.resize(count);
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		sf::Vector2f before = shape.getPoint((i + count - 1) % count);
+		sf::Vector2f point = shape.getPoint(i);
+		sf::Vector2f after = shape.getPoint((i + 1) % count);
+		sf::Vector2f n1 = EdgeNormal(before, point, center);
+		sf::Vector2f n2 = EdgeNormal(point, after, center);
+		float factor = (1.0f + ((n1.x * n2.x) + (n1.y * n2.y)));
+
+		m_inner[i] = transform.transformPoint(point);
+		m_outer[i] = transform.transformPoint(point + (((n1 + n2) / factor) * thickness));
+	}
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		unsigned int next = ((i + 1) % count);
+
+		AddTriangle(m_inner[i], m_outer[i], m_inner[next], shape.getOutlineColor());
+		AddTriangle(m_inner[next], m_outer[i], m_outer[next], shape.getOutlineColor());
+	}
+}
+
+// ===== Draw =====================================================================================
+// Method will draw everything in the batch with one draw call.
+//
+// Input:
+//	[IN/OUT] sf::RenderTarget &target	- the target to draw to
+//
+// Output: none
+// ================================================================================================
+void ShapeBatch::Draw(sf::RenderTarget &target)
+{
+	if(m_vertices.getVertexCount() > 0)
+	{
+		target.draw(m_vertices);
+	}
+}
+
+// ===== AddTriangle ==============================================================================
+// Method will add one solid triangle to the batch.
+//
+// Input:
+//	[IN] sf::Vector2f a, b, c	- the corners
+//	[IN] sf::Color color		- the color
+//
+// Output: none
+// ================================================================================================
+void ShapeBatch::AddTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color)
+{
+	m_vertices.append(sf::Vertex(a, color));
+	m_vertices.append(sf::Vertex(b, color));
+	m_vertices.append(sf::Vertex(c, color));
+}
+
+// ===== EdgeNormal ===============================================================================
+// Method will find the unit normal of an edge that points away from the shape's center.
+//
+// Input:
+//	[IN] sf::Vector2f from		- the start of the edge
+//	[IN] sf::Vector2f to		- the end of the edge
+//	[IN] sf::Vector2f center	- the center of the shape's points
+//
+// Output:
+//	[OUT] sf::Vector2f			- the outward normal
+// ================================================================================================
+sf::Vector2f ShapeBatch::EdgeNormal(sf::Vector2f from, sf::Vector2f to, sf::Vector2f center)
+{
+	sf::Vector2f normal((from.y - to.y), (to.x - from.x));
+	float length = sqrt((normal.x * normal.x) + (normal.y * normal.y));
+
+	if(length == 0)
+	{
+		return sf::Vector2f(0, 0);
+	}
+
+	normal /= length;
+
+	if((((from.x - center.x) * normal.x) + ((from.y - center.y) * normal.y)) < 0)
+	{
+		normal = -normal;
+	}
+
+	return normal;
+}
@@ -0,0 +1,59 @@
+// ================================================================================================
+// Filename: "ShapeBatch.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ShapeBatch class collects the untextured shapes of a frame, the paddles, health pack and
+// ball, into one sf::VertexArray of triangles, so they are drawn with a single draw() call instead
+// of one call, with its' own vertex buffer and state changes, per shape.
+//
+// AddShape() copies a shape in as it would draw itself: its' fill as a fan of triangles from its'
+// points, then its' outline as a band of quads along its' edges, both put through the shape's
+// transform plus an offset. The outline band is built the way SFML builds it, each point moved
+// along the average of its' two edge normals by the outline thickness, so a negative thickness
+// draws inside the shape, as the Paddle's health outline does.
+//
+// The batch is cleared and refilled every frame. Clearing keeps the vertex array's storage, so
+// after the first few frames no memory is allocated.
+// ================================================================================================
+
+#ifndef SHAPEBATCH_H
+#define SHAPEBATCH_H
+
+#include <vector>
+#include <SFML\Graphics.hpp>
+
+class ShapeBatch
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ShapeBatch(void);
+	~ShapeBatch(void){}
+
+	// Method Prototypes
+	void AddShape(const sf::Shape &shape, sf::Vector2f offset);
+	void Draw(sf::RenderTarget &target);
+
+	// Inlined Methods
+	void Clear(void){ m_vertices.clear(); }
+
+private:
+
+	void AddTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color);
+	static sf::Vector2f EdgeNormal(sf::Vector2f from, sf::Vector2f to, sf::Vector2f center);
+
+	sf::VertexArray m_vertices;
+	std::vector<sf::Vector2f> m_inner;		// Outline points being built, kept between shapes
+	std::vector<sf::Vector2f> m_outer;
+};
+
+#endif
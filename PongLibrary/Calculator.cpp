@@ -105,6 +105,35 @@ double Calculator::GetDistanceTo(double firstX, double firstY, double secondX, d
 	return totalDist;
 }
 
+// ==== Calculator::Hermite =======================================================================
+// This method is used to find a point on the cubic Hermite curve between two points, given the
+// rate of change at each end. Unlike a straight line, the curve leaves the start and arrives at the
+// end moving the way the object actually was, so motion drawn along it doesn't kink at each point.
+// The tangents must be scaled to the whole span, so a velocity per tick is multiplied by the number
+// of ticks between the points.
+//
+//	Input:
+//		[IN] double startPos		- the position at the start of the span
+//		[IN] double startTangent	- the rate of change at the start, over the whole span
+//		[IN] double endPos			- the position at the end of the span
+//		[IN] double endTangent		- the rate of change at the end, over the whole span
+//		[IN] double t				- how far along the span, 0 to 1
+//
+//	Output:
+//		[OUT] double position		- the position at t
+//
+// ================================================================================================
+double Calculator::Hermite(double startPos, double startTangent, double endPos, double endTangent, double t)
+{
+	double t2 = (t * t);
+	double t3 = (t2 * t);
+
+	double position = ((((2 * t3) - (3 * t2) + 1) * startPos) + ((t3 - (2 * t2) + t) * startTangent) +
+					   ((((-2) * t3) + (3 * t2)) * endPos) + ((t3 - t2) * endTangent));
+
+	return position;
+}
+
 // ==== Calculator::CheckCollision ================================================================
 // Method should be called to check if the game ball and a paddle have collided or not. The method
 // will use the bounding rectangles of both objects and determine if they intersect one another.
@@ -28,6 +28,7 @@ public:
 
 	static double GetAngleTo(double originX, double originY, double destX, double destY);
 	static double GetDistanceTo(double firstX, double firstY, double secondX, double secondY);
+	static double Hermite(double startPos, double startTangent, double endPos, double endTangent, double t);
 	static bool Calculator::CheckCollision(Ball ball, Paddle paddle);
 	static bool Calculator::CheckCollision(Ball ball, HealthPack hPack);
 	
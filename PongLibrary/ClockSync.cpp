@@ -0,0 +1,257 @@
+// ================================================================================================
+// Filename: "ClockSync.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ClockSync class. For a class description see the
+// header file "ClockSync.h"
+// ================================================================================================
+
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "ClockSync.h"
+
+// Initialize Static Constants
+const unsigned int ClockSync::WINDOW_SIZE = 16;
+const unsigned int ClockSync::HISTORY_SIZE = 64;
+const float ClockSync::SMOOTHING = 0.25f;
+const NetTime ClockSync::MIN_SKEW_SPAN = 10000000;		// 10 seconds
+const unsigned int ClockSync::MIN_FIT_SAMPLES = 4;
+const double ClockSync::MAX_SKEW = 0.0005;				// 500 ppm
+
+// ===== Constructor ==============================================================================
+// The constructor will start with no samples.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ClockSync::ClockSync(void)
+{
+	Reset();
+}
+
+// ===== Reset ====================================================================================
+// Method will forget every sample and the current estimate.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClockSync::Reset(void)
+{
+	m_samples.clear();
+	m_history.clear();
+	m_sampleCount = 0;
+	m_offset = 0;
+
+	m_estimate.offset = 0;
+	m_estimate.uncertainty = 0;
+	m_estimate.roundTripTime = 0;
+	m_estimate.reference = 0;
+	m_estimate.skew = 0;
+	m_estimate.valid = false;
+}
+
+// ===== AddSample ================================================================================
+// Method will add a completed TimeSync round to the windows and update the estimate. The offset is
+// taken from the skew fit once there is one, and from the sample in the short window with the
+// lowest round trip time until then.
+//
+// Before the estimate is updated the sample is checked against it: a sample agrees if the offset
+// predicted for its' client time is within the sample's own error bound plus the estimate's
+// uncertainty. A caller can use that to decide how soon the next round is needed.
+//
+// Input:
+//	[IN] const TimeSync &timeSync	- a round with all four times stamped
+//
+// Output:
+//	[OUT] bool						- true if the sample agreed with the previous estimate, or if
+//									  there was no previous estimate
+// ================================================================================================
+bool ClockSync::AddSample(const TimeSync &timeSync)
+{
+	Sample sample;
+
+	NetTime clientProcessTime = (timeSync.clientSendTime - timeSync.clientRecieveTime);
+	sample.clientTime = (timeSync.clientRecieveTime + (clientProcessTime / 2));
+	sample.roundTripTime = ((timeSync.serverReceivedTime - timeSync.serverSendTime) - clientProcessTime);
+	sample.offset = (((timeSync.serverSendTime - timeSync.clientRecieveTime) +
+					  (timeSync.serverReceivedTime - timeSync.clientSendTime)) / 2);
+
+	if(sample.roundTripTime < 0)
+	{
+		sample.roundTripTime = 0;	// Clock resolution can make a very short round look negative
+	}
+
+	// Check the sample against the estimate it is about to update
+	bool agreed = true;
+
+	if(m_estimate.valid)
+	{
+		NetTime predicted = (m_estimate.ToServerTime(sample.clientTime) - sample.clientTime);
+
+		agreed = (std::llabs(sample.offset - predicted) <= ((sample.roundTripTime / 2) + m_estimate.uncertainty));
+	}
+
+	m_samples.push_back(sample);
+	m_history.push_back(sample);
+	m_sampleCount++;
+
+	if(m_samples.size() > WINDOW_SIZE)
+	{
+		m_samples.pop_front();
+	}
+
+	if(m_history.size() > HISTORY_SIZE)
+	{
+		m_history.pop_front();
+	}
+
+	// Trust the lowest round trip in the window
+	const Sample *best = &m_samples.front();
+
+	for(std::deque<Sample>::const_iterator it = m_samples.begin(); it != m_samples.end(); it++)
+	{
+		if(it->roundTripTime < best->roundTripTime)
+		{
+			best = &(*it);
+		}
+	}
+
+	// Where the offset should be now
+	NetTime target;
+	double skew;
+
+	if(!FitSkew(sample.clientTime, target, skew))
+	{
+		target = best->offset;
+		skew = 0;
+	}
+
+	if(!m_estimate.valid)
+	{
+		m_offset = (double)target;
+		m_estimate.valid = true;
+	}
+	else
+	{
+		m_offset += (m_estimate.skew * (sample.clientTime - m_estimate.reference));	// Carry along the old line
+		m_offset += (((double)target - m_offset) * SMOOTHING);
+	}
+
+	m_estimate.offset = (NetTime)m_offset;
+	m_estimate.reference = sample.clientTime;
+	m_estimate.skew = skew;
+	m_estimate.roundTripTime = best->roundTripTime;
+	m_estimate.uncertainty = ((best->roundTripTime / 2) + std::llabs(target - m_estimate.offset));
+
+	return agreed;
+}
+
+// ===== FitSkew ==================================================================================
+// Method will fit a least squares line of offset against client time through the half of the
+// history with the lowest round trip times. Samples that were queued on the way have skewed offsets
+// and would drag the line around.
+//
+// Input:
+//	[IN] NetTime reference	- the client time to evaluate the line at
+//	[IN/OUT] NetTime &offset	- receives the line's offset at the reference time
+//	[IN/OUT] double &skew		- receives the line's slope
+//
+// Output:
+//	[OUT] bool				- true if a line was fit, false if the history is too short
+// ================================================================================================
+bool ClockSync::FitSkew(NetTime reference, NetTime &offset, double &skew)
+{
+	if((m_history.size() < MIN_FIT_SAMPLES) ||
+	   ((m_history.back().clientTime - m_history.front().clientTime) < MIN_SKEW_SPAN))
+	{
+		return false;
+	}
+
+	// Only the faster half of the history is used
+	std::vector<NetTime> roundTrips;
+
+	for(std::deque<Sample>::const_iterator it = m_history.begin(); it != m_history.end(); it++)
+	{
+		roundTrips.push_back(it->roundTripTime);
+	}
+
+	std::nth_element(roundTrips.begin(), (roundTrips.begin() + (roundTrips.size() / 2)), roundTrips.end());
+	NetTime limit = roundTrips[roundTrips.size() / 2];
+
+	// Times are taken relative to the reference to keep the sums small
+	unsigned int count = 0;
+	double sumX = 0;
+	double sumY = 0;
+	double sumXX = 0;
+	double sumXY = 0;
+	NetTime first = 0;
+	NetTime last = 0;
+
+	for(std::deque<Sample>::const_iterator it = m_history.begin(); it != m_history.end(); it++)
+	{
+		if(it->roundTripTime > limit)
+		{
+			continue;
+		}
+
+		double x = (double)(it->clientTime - reference);
+		double y = (double)it->offset;
+
+		if(count == 0)
+		{
+			first = it->clientTime;
+		}
+
+		last = it->clientTime;
+		count++;
+		sumX += x;
+		sumY += y;
+		sumXX += (x * x);
+		sumXY += (x * y);
+	}
+
+	if((count < MIN_FIT_SAMPLES) || ((last - first) < MIN_SKEW_SPAN))
+	{
+		return false;
+	}
+
+	double meanX = (sumX / count);
+	double meanY = (sumY / count);
+	double varianceX = ((sumXX / count) - (meanX * meanX));
+
+	if(varianceX <= 0)
+	{
+		return false;
+	}
+
+	skew = (((sumXY / count) - (meanX * meanY)) / varianceX);
+
+	if(skew > MAX_SKEW)
+	{
+		skew = MAX_SKEW;
+	}
+	else if(skew < -MAX_SKEW)
+	{
+		skew = -MAX_SKEW;
+	}
+
+	offset = (NetTime)(meanY - (skew * meanX));
+
+	return true;
+}
+
+// ===== GetEstimate ==============================================================================
+// Method will return the current offset estimate and its' confidence bound.
+//
+// Input: none
+//
+// Output:
+//	[OUT] ClockEstimate	- the estimate; valid is false until a sample has been added
+// ================================================================================================
+ClockEstimate ClockSync::GetEstimate(void)
+{
+	return m_estimate;
+}
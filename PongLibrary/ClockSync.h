@@ -0,0 +1,114 @@
+// ================================================================================================
+// Filename: "ClockSync.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ClockSync class estimates the difference between the server clock and a client clock from
+// the TimeSync rounds exchanged between them, the same way NTP does.
+//
+// Each round gives one sample. The round trip time is the time the request and reply spent on the
+// network, with the client's own processing time removed. The offset is the midpoint estimate of
+// server time minus client time. A sample's offset can be wrong by at most half its' round trip
+// time, and samples whose packets were held up in a queue have both a long round trip and a skewed
+// offset, so the class keeps a window of recent samples and trusts the one with the lowest round
+// trip time. The offset it reports moves towards that sample's offset a step at a time rather
+// than jumping, so a single good sample can't make the clock lurch.
+//
+// Two oscillators never run at exactly the same rate, so over a long session the offset drifts by
+// tens of microseconds every second. The class also keeps a longer history of samples, and once
+// those cover MIN_SKEW_SPAN it fits a line through the half of them with the lowest round trips:
+// offset against client time. The slope of that line is the skew, the rate the client clock gains
+// on the server clock, and the offset is then tracked along the line instead of being held flat.
+// ToServerTime() maps a client time to server time through the line, so it stays accurate between
+// rounds even when rounds are far apart.
+//
+// The estimate comes with a confidence bound: the error bound of the sample being trusted, plus
+// however much of the latest correction has not been applied yet. The true offset lies within
+// offset +/- uncertainty.
+// ================================================================================================
+
+#ifndef CLOCKSYNC_H
+#define CLOCKSYNC_H
+
+#include <deque>
+#include "NetTime.h"
+#include "TimeSync.h"
+
+// An offset estimate and its' confidence bound
+struct ClockEstimate
+{
+	NetTime offset;			// Server time minus client time, at the reference time
+	NetTime uncertainty;	// The true offset is within offset +/- uncertainty
+	NetTime roundTripTime;	// Lowest round trip time in the sample window
+	NetTime reference;		// Client time the offset was measured at
+	double skew;			// Change in offset per unit of client time
+	bool valid;				// False until the first sample has been added
+
+	// Maps a client clock time to the server clock
+	NetTime ToServerTime(NetTime clientTime) const
+	{
+		return (clientTime + offset + (NetTime)(skew * (clientTime - reference)));
+	}
+};
+
+class ClockSync
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ClockSync(void);
+	~ClockSync(void){}
+
+	// Method Prototypes
+	bool AddSample(const TimeSync &timeSync);
+	void Reset(void);
+	ClockEstimate GetEstimate(void);
+
+	// Inlined Methods
+	int GetSampleCount(void){ return m_sampleCount; }
+	NetTime ToServerTime(NetTime clientTime){ return m_estimate.ToServerTime(clientTime); }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const unsigned int WINDOW_SIZE;	// Samples kept to pick the lowest round trip from
+	static const unsigned int HISTORY_SIZE;	// Samples kept to fit the skew over
+	static const float SMOOTHING;			// Fraction of the remaining correction applied per sample
+	static const NetTime MIN_SKEW_SPAN;		// Client time the history must cover before a skew is fit
+	static const unsigned int MIN_FIT_SAMPLES;	// Fewest samples a skew is fit through
+	static const double MAX_SKEW;			// Largest believable skew, anything more is noise
+
+private:
+
+	// A single round's measurements
+	struct Sample
+	{
+		NetTime clientTime;		// Midpoint of the client's receive and send times
+		NetTime offset;
+		NetTime roundTripTime;
+	};
+
+	bool FitSkew(NetTime reference, NetTime &offset, double &skew);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	std::deque<Sample> m_samples;		// Short window, newest last
+	std::deque<Sample> m_history;		// Long window for the skew fit, newest last
+	int m_sampleCount;
+	double m_offset;		// Unrounded estimate, so small corrections still add up
+	ClockEstimate m_estimate;
+};
+
+#endif
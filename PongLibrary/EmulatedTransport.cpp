@@ -0,0 +1,260 @@
+// ================================================================================================
+// Filename: "EmulatedTransport.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the EmulatedTransport class. For a class description
+// see the header file "EmulatedTransport.h"
+// ================================================================================================
+
+#include <cmath>
+#include <SFML\System\Clock.hpp>
+#include <SFML\System\Sleep.hpp>
+#include "EmulatedTransport.h"
+
+// Initialize Static Constants
+const int EmulatedTransport::RETRANSMIT_TIMEOUT = 200;
+
+// ===== Constructor ==============================================================================
+// The constructor will wrap a transport with a link. The EmulatedTransport takes ownership of the
+// wrapped transport.
+//
+// Input:
+//	[IN] Transport *transport		- the transport to wrap
+//	[IN] const LinkProfile &link	- the link to emulate on received packets
+//	[IN] unsigned int seed			- seed for the random choices
+//	[IN] const std::vector<TraceSample> *trace	- trace to replay in place of the link's latency
+//												  and loss, must outlive the transport
+//
+// Output: none
+// ================================================================================================
+EmulatedTransport::EmulatedTransport(Transport *transport, const LinkProfile &link, unsigned int seed,
+									 const std::vector<TraceSample> *trace)
+	: m_link(link), m_random(seed), m_queue(new DeliveryQueue)
+{
+	m_transport = transport;
+	m_wheel = TimingWheel::Shared();
+	m_trace = (((trace != NULL) && !trace->empty()) ? trace : NULL);
+	m_traceStart = m_wheel->Now();
+	m_lastDue = 0;
+	m_linkFreeAt = 0;
+	m_closed = false;
+	m_closeStatus = sf::Socket::Disconnected;
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will release the wrapped transport. Packets still on the wheel keep the delivery
+// queue alive until they are due and are then released with it.
+// ================================================================================================
+EmulatedTransport::~EmulatedTransport(void)
+{
+	delete m_transport;
+}
+
+// ===== Send =====================================================================================
+// Method will send the packet on the wrapped transport. The other end emulates this direction.
+//
+// Input:
+//	[IN] sf::Packet &packet		- the packet to send
+//
+// Output:
+//	[OUT] sf::Socket::Status	- the wrapped transport's status
+// ================================================================================================
+sf::Socket::Status EmulatedTransport::Send(sf::Packet &packet)
+{
+	return m_transport->Send(packet);
+}
+
+// ===== Receive ==================================================================================
+// Method will return the next packet that is due, pulling new arrivals off the wrapped transport
+// while it waits.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//	[IN] sf::Time timeout		- the longest to wait, sf::Time::Zero to wait forever
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done, NotReady on timeout, or the wrapped transport's status once
+//								  it has closed and everything before the close has been delivered
+// ================================================================================================
+sf::Socket::Status EmulatedTransport::Receive(sf::Packet &packet, sf::Time timeout)
+{
+	sf::Clock waitClock;
+	sf::Packet arrived;
+	sf::Time tick = sf::microseconds((sf::Int64)TimingWheel::TICK);
+
+	while(true)
+	{
+		if(m_queue->Pop(packet))
+		{
+			return sf::Socket::Done;
+		}
+
+		// Once closed, report it only after everything that arrived before the close is delivered
+		if(m_closed && m_queue->IsIdle())
+		{
+			return (m_queue->Pop(packet) ? sf::Socket::Done : m_closeStatus);
+		}
+
+		sf::Time wait = tick;
+
+		if(timeout != sf::Time::Zero)
+		{
+			sf::Time remaining = (timeout - waitClock.getElapsedTime());
+
+			if(remaining <= sf::Time::Zero)
+			{
+				return sf::Socket::NotReady;
+			}
+			else if(remaining < wait)
+			{
+				wait = remaining;
+			}
+		}
+
+		if(m_closed)
+		{
+			sf::sleep(wait);
+			continue;
+		}
+
+		sf::Socket::Status status = m_transport->Receive(arrived, wait);
+
+		if(status == sf::Socket::Done)
+		{
+			Admit(arrived);
+		}
+		else if((status == sf::Socket::Disconnected) || (status == sf::Socket::Error))
+		{
+			m_closed = true;
+			m_closeStatus = status;
+		}
+	}
+}
+
+// ===== Disconnect ===============================================================================
+// Method will disconnect the wrapped transport, which wakes a Receive() blocked on it.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void EmulatedTransport::Disconnect(void)
+{
+	m_transport->Disconnect();
+}
+
+// ===== Admit ====================================================================================
+// Method will work out when a newly arrived packet should be delivered and schedule it. The packet
+// first waits for the bandwidth cap to let it onto the link, then takes the link's latency, or the
+// delay from the trace when one is being replayed. A lost packet is retransmitted after
+// RETRANSMIT_TIMEOUT. Packets stay in order, so a late one holds back those behind it.
+//
+// Input:
+//	[IN] const sf::Packet &packet	- the packet that arrived
+//
+// Output: none
+// ================================================================================================
+void EmulatedTransport::Admit(const sf::Packet &packet)
+{
+	NetTime now = m_wheel->Now();
+	NetTime departure = now;
+
+	if(m_link.bandwidth > 0)
+	{
+		if(m_linkFreeAt < now)
+		{
+			m_linkFreeAt = now;
+		}
+
+		// bits / (kbit/s) = ms, so bits * 1000 / kbit/s = us
+		m_linkFreeAt += (((NetTime)packet.getDataSize() * 8 * 1000) / m_link.bandwidth);
+		departure = m_linkFreeAt;
+	}
+
+	NetTime due = departure;
+	bool lost = false;
+
+	if(m_trace != NULL)
+	{
+		const TraceSample &sample = NetworkTrace::Lookup(*m_trace, (now - m_traceStart));
+
+		due += sample.delay;
+		lost = sample.lost;
+	}
+	else
+	{
+		due += SampleLatency();
+		lost = Chance(m_link.loss);
+	}
+
+	if(lost)
+	{
+		due += TimeBase::FromMilliseconds(RETRANSMIT_TIMEOUT);
+	}
+
+	if(due < m_lastDue)
+	{
+		due = m_lastDue;	// In order behind the packet before it
+	}
+
+	m_lastDue = due;
+
+	m_wheel->Schedule(m_queue, packet, due);
+}
+
+// ===== SampleLatency ============================================================================
+// Method will draw the latency of one packet from the link's distribution.
+//
+// Input: none
+//
+// Output:
+//	[OUT] NetTime	- the time the packet takes to cross the link
+// ================================================================================================
+NetTime EmulatedTransport::SampleLatency(void)
+{
+	double extra = 0;		// ms
+
+	if(m_link.jitter > 0)
+	{
+		if(m_link.distribution == LinkProfile::UNIFORM)
+		{
+			std::uniform_real_distribution<double> uniform(0, m_link.jitter);
+			extra = uniform(m_random);
+		}
+		else if(m_link.distribution == LinkProfile::NORMAL)
+		{
+			std::normal_distribution<double> normal(0, m_link.jitter);
+			extra = std::fabs(normal(m_random));
+		}
+		else if(m_link.distribution == LinkProfile::PARETO)
+		{
+			// Pareto with shape 2.5 and minimum jitter, shifted so the least extra delay is 0
+			std::uniform_real_distribution<double> uniform(0, 1);
+			extra = (m_link.jitter * (std::pow((1.0 - uniform(m_random)), (-1.0 / 2.5)) - 1.0));
+		}
+	}
+
+	return (TimeBase::FromMilliseconds(m_link.latency) + (NetTime)(extra * 1000));
+}
+
+// ===== Chance ===================================================================================
+// Method will return true with the given probability.
+//
+// Input:
+//	[IN] float probability	- the chance, 0 to 1
+//
+// Output:
+//	[OUT] bool				- true if the event happens
+// ================================================================================================
+bool EmulatedTransport::Chance(float probability)
+{
+	if(probability <= 0)
+	{
+		return false;
+	}
+
+	std::uniform_real_distribution<float> uniform(0, 1);
+
+	return (uniform(m_random) < probability);
+}
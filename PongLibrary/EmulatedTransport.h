@@ -0,0 +1,93 @@
+// ================================================================================================
+// Filename: "EmulatedTransport.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The EmulatedTransport class wraps another Transport and makes the packets it receives behave as
+// if they had crossed the network described by a LinkProfile: delayed, jittered, retransmitted,
+// and held to a bandwidth cap. Like any Transport it delivers every packet exactly once and in
+// order. It lets a server and a client on the same machine reproduce the conditions of a real
+// connection.
+//
+// Each end emulates only the direction it receives, so the server applies the profile's up link
+// and the client applies its' down link. Sends pass straight through to the wrapped Transport.
+//
+// When the listening thread calls Receive(), the EmulatedTransport pulls whatever has arrived on
+// the wrapped Transport, works out when each packet should be delivered, and schedules it on the
+// shared TimingWheel. The wheel moves the packet onto this transport's DeliveryQueue when it is
+// due, and Receive() returns it from there. While it waits, Receive() keeps pulling from the
+// wrapped Transport one wheel tick at a time. A disconnect is only reported once every packet
+// that arrived before it has been delivered.
+//
+// The random choices come from a generator seeded by the caller, so a run can be repeated.
+//
+// An EmulatedTransport can also be given one direction of a NetworkTrace to replay. Each packet
+// then takes the delay, and the loss, of the trace sample in effect at the time since the
+// transport was created, in place of the link's latency, jitter and loss. The bandwidth cap still
+// comes from the link.
+// ================================================================================================
+
+#ifndef EMULATEDTRANSPORT_H
+#define EMULATEDTRANSPORT_H
+
+#include <memory>
+#include <random>
+#include "Transport.h"
+#include "NetTime.h"
+#include "NetworkProfile.h"
+#include "NetworkTrace.h"
+#include "TimingWheel.h"
+
+class EmulatedTransport: public Transport
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	EmulatedTransport(Transport *transport, const LinkProfile &link, unsigned int seed,
+					  const std::vector<TraceSample> *trace = NULL);
+	~EmulatedTransport(void);
+
+	// Transport Prototypes
+	sf::Socket::Status Send(sf::Packet &packet);
+	sf::Socket::Status Receive(sf::Packet &packet, sf::Time timeout);
+	void Disconnect(void);
+	sf::IpAddress GetRemoteAddress(void){ return m_transport->GetRemoteAddress(); }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int RETRANSMIT_TIMEOUT;	// Time, in ms, a lost packet waits to be sent again
+
+private:
+
+	void Admit(const sf::Packet &packet);
+	NetTime SampleLatency(void);
+	bool Chance(float probability);
+
+	// Link Data
+	Transport *m_transport;			// The wrapped transport, owned
+	LinkProfile m_link;
+	std::mt19937 m_random;
+	const std::vector<TraceSample> *m_trace;	// Trace to replay, NULL or empty for none; not owned
+	NetTime m_traceStart;					// When replay of the trace started
+
+	// Scheduling Data, only touched by the listening thread
+	TimingWheel *m_wheel;
+	std::shared_ptr<DeliveryQueue> m_queue;
+	NetTime m_lastDue;				// Delivery time of the packet before, which no later packet may beat
+	NetTime m_linkFreeAt;			// When the bandwidth cap lets the next packet onto the link
+	bool m_closed;
+	sf::Socket::Status m_closeStatus;
+};
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "GameData.h"
 #include "Paddle.h"
+#include <cmath>
 
 // Set Constants
 const int GameData::ENGINE_SPEED = 17;
@@ -18,6 +19,7 @@ const int GameData::BOARD_HEIGHT = 600;
 const int GameData::MAX_POINTS = 3;
 const int GameData::LEFT_GOAL_LINE = 20;
 const int GameData::RIGHT_GOAL_LINE = (BOARD_WIDTH - 20);
+const float GameData::COMPACT_SCALE = 8;
 
 // ===== Default Constructor ======================================================================
 // The default constructor will be used to zero all values prior to the GameState being used by 
@@ -33,12 +35,14 @@ GameData::GameData(void)
 	playerOnePaddlePosition = (BOARD_HEIGHT / 2);
 	playerOneDirection = Paddle::STILL;
 	playerOneHealth = 100;
+	playerOneLastInput = 0;
 
 	// Zero Player Two Data
 	playerTwoScore = 0;
 	playerTwoPaddlePosition = (BOARD_HEIGHT / 2);
 	playerTwoDirection = Paddle::STILL;
 	playerTwoHealth = 100;
+	playerTwoLastInput = 0;
 
 	// Zero Ball Data
 	ballX = (BOARD_WIDTH / 2);			
@@ -52,6 +56,10 @@ GameData::GameData(void)
 	winningPlayer = 0;		
 	startGame = false;			
 	healthPackSpawned = false;
+
+	// Zero Snapshot Data
+	serverTick = 0;
+	serverTime = 0;
 }
 
 // ===== Packet Input Overload ====================================================================
@@ -71,7 +79,9 @@ sf::Packet& operator<<(sf::Packet& packet, GameData& gameData)
 			<< gameData.playerTwoScore << gameData.playerTwoPaddlePosition << gameData.playerTwoDirection << gameData.playerTwoHealth
 			<< gameData.ballX << gameData.ballY << gameData.ballAngle << gameData.playerScored
 			<< gameData.scoringPlayer << gameData.gameWon << gameData.winningPlayer << gameData.startGame
-			<< gameData.healthPackSpawned;
+			<< gameData.healthPackSpawned << gameData.serverTick << gameData.playerOneLastInput << gameData.playerTwoLastInput;
+
+	TimeBase::WriteCompact(packet, gameData.serverTime);
 
 	return packet;
 }
@@ -93,8 +103,131 @@ sf::Packet& operator>>(sf::Packet& packet, GameData& gameData)
 			>> gameData.playerTwoScore >> gameData.playerTwoPaddlePosition >> gameData.playerTwoDirection >> gameData.playerTwoHealth
 			>> gameData.ballX >> gameData.ballY >> gameData.ballAngle >> gameData.playerScored 
 			>> gameData.scoringPlayer >> gameData.gameWon >> gameData.winningPlayer >> gameData.startGame
-			>> gameData.healthPackSpawned;
+			>> gameData.healthPackSpawned >> gameData.serverTick >> gameData.playerOneLastInput >> gameData.playerTwoLastInput;
 
+	TimeBase::ReadCompact(packet, gameData.serverTime);
 
 	return packet;
-}
\ No newline at end of file
+}
+
+// ===== Compact Helpers ==========================================================================
+// Fixed point conversions used by compact precision. Positions are clamped to what 16 bits hold.
+// ================================================================================================
+static sf::Uint16 ToFixed(float value)
+{
+	float scaled = ((value * GameData::COMPACT_SCALE) + 0.5f);
+
+	if(scaled < 0)
+	{
+		return 0;
+	}
+	else if(scaled > 65535)
+	{
+		return 65535;
+	}
+
+	return (sf::Uint16)scaled;
+}
+
+static float FromFixed(sf::Uint16 value)
+{
+	return (value / GameData::COMPACT_SCALE);
+}
+
+static sf::Uint16 ToTurn(double angle)
+{
+	const double turn = (2.0 * 3.14159265358979323846);
+	double fraction = std::fmod(angle, turn) / turn;
+
+	if(fraction < 0)
+	{
+		fraction += 1.0;
+	}
+
+	return (sf::Uint16)((sf::Uint32)((fraction * 65536.0) + 0.5) & 0xFFFF);
+}
+
+static double FromTurn(sf::Uint16 value)
+{
+	return ((value / 65536.0) * (2.0 * 3.14159265358979323846));
+}
+
+// ===== Write ====================================================================================
+// Method will put a GameData into a packet at the given precision.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet		- the packet to receive the GameData
+//	[IN] GameData &gameData			- a reference to the GameData
+//	[IN] sf::Uint8 precision		- one of the Precision values
+//
+// Output: none
+// ================================================================================================
+void GameData::Write(sf::Packet &packet, GameData &gameData, sf::Uint8 precision)
+{
+	if(precision != COMPACT_PRECISION)
+	{
+		packet << gameData;
+		return;
+	}
+
+	sf::Uint8 flags = ((gameData.playerScored ? 0x01 : 0) | (gameData.gameWon ? 0x02 : 0) |
+					   (gameData.startGame ? 0x04 : 0) | (gameData.healthPackSpawned ? 0x08 : 0));
+
+	packet	<< (sf::Uint8)gameData.playerOneScore << ToFixed(gameData.playerOnePaddlePosition)
+			<< (sf::Int8)gameData.playerOneDirection << (sf::Uint8)gameData.playerOneHealth
+			<< (sf::Uint8)gameData.playerTwoScore << ToFixed(gameData.playerTwoPaddlePosition)
+			<< (sf::Int8)gameData.playerTwoDirection << (sf::Uint8)gameData.playerTwoHealth
+			<< ToFixed(gameData.ballX) << ToFixed(gameData.ballY) << ToTurn(gameData.ballAngle) << flags
+			<< (sf::Uint8)gameData.scoringPlayer << (sf::Uint8)gameData.winningPlayer << gameData.serverTick
+			<< gameData.playerOneLastInput << gameData.playerTwoLastInput;
+	TimeBase::WriteCompact(packet, gameData.serverTime);
+}
+
+// ===== Read =====================================================================================
+// Method will extract a GameData from a packet that was written at the given precision.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet		- the packet that contains the GameData
+//	[IN/OUT] GameData &gameData		- a reference to the GameData that will receive the data
+//	[IN] sf::Uint8 precision		- one of the Precision values
+//
+// Output: none
+// ================================================================================================
+void GameData::Read(sf::Packet &packet, GameData &gameData, sf::Uint8 precision)
+{
+	if(precision != COMPACT_PRECISION)
+	{
+		packet >> gameData;
+		return;
+	}
+
+	sf::Uint8 playerOneScore = 0, playerOneHealth = 0, playerTwoScore = 0, playerTwoHealth = 0;
+	sf::Int8 playerOneDirection = 0, playerTwoDirection = 0;
+	sf::Uint16 playerOnePosition = 0, playerTwoPosition = 0, ballX = 0, ballY = 0, ballAngle = 0;
+	sf::Uint8 flags = 0, scoringPlayer = 0, winningPlayer = 0;
+
+	packet	>> playerOneScore >> playerOnePosition >> playerOneDirection >> playerOneHealth
+			>> playerTwoScore >> playerTwoPosition >> playerTwoDirection >> playerTwoHealth
+			>> ballX >> ballY >> ballAngle >> flags
+			>> scoringPlayer >> winningPlayer >> gameData.serverTick
+			>> gameData.playerOneLastInput >> gameData.playerTwoLastInput;
+	TimeBase::ReadCompact(packet, gameData.serverTime);
+
+	gameData.playerOneScore = playerOneScore;
+	gameData.playerOnePaddlePosition = FromFixed(playerOnePosition);
+	gameData.playerOneDirection = playerOneDirection;
+	gameData.playerOneHealth = playerOneHealth;
+	gameData.playerTwoScore = playerTwoScore;
+	gameData.playerTwoPaddlePosition = FromFixed(playerTwoPosition);
+	gameData.playerTwoDirection = playerTwoDirection;
+	gameData.playerTwoHealth = playerTwoHealth;
+	gameData.ballX = FromFixed(ballX);
+	gameData.ballY = FromFixed(ballY);
+	gameData.ballAngle = FromTurn(ballAngle);
+	gameData.playerScored = ((flags & 0x01) != 0);
+	gameData.gameWon = ((flags & 0x02) != 0);
+	gameData.startGame = ((flags & 0x04) != 0);
+	gameData.healthPackSpawned = ((flags & 0x08) != 0);
+	gameData.scoringPlayer = scoringPlayer;
+	gameData.winningPlayer = winningPlayer;
+}
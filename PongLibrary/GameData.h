@@ -14,6 +14,12 @@
 // The class will also maintain constants that are used to define certain game rules, bounds, or
 // keywords used throughout the game.
 //
+// A GameData can be put into a packet at full precision, with the packet stream operators, or at
+// compact precision with Write() and Read(). Compact precision sends positions as 16-bit fixed
+// point to an eighth of a pixel, the ball angle as a 16-bit fraction of a turn, and the small
+// counters and flags as single bytes; it is a little under half the size, and is used for clients
+// whose link can't keep up with full snapshots.
+//
 // To increase simplicity, the GameData class will make all members public.
 // ================================================================================================
 
@@ -21,6 +27,7 @@
 #define GAMEDATA_H
 
 #include <SFML\Network\Packet.hpp>
+#include "NetTime.h"
 
 class GameData
 {
@@ -28,7 +35,13 @@ class GameData
 public:
 
 	// Command Code Enum
-	enum CommandCode {INITIALIZE, TIME_SYNC, GAME_UPDATE, PADDLE_UPDATE};
+	enum CommandCode {INITIALIZE, TIME_SYNC, GAME_UPDATE, PADDLE_UPDATE, HEARTBEAT, JOIN, RESUME, REJECT, NET_TRACE};
+
+	// Snapshot Precision Enum, sent with a GAME_UPDATE
+	enum Precision {FULL_PRECISION, COMPACT_PRECISION};
+
+	// Reject Reason Enum, sent with a REJECT
+	enum RejectReason {SERVER_FULL, RATE_LIMITED, TOO_MANY_PENDING, HANDSHAKE_FAILED, UNKNOWN_SESSION, REJECT_REASON_COUNT};
 
 	// ============================================================================================
 	// Methods
@@ -38,6 +51,10 @@ public:
 	GameData(void);
 	~GameData(void){}
 
+	// Static Methods
+	static void Write(sf::Packet &packet, GameData &gameData, sf::Uint8 precision);
+	static void Read(sf::Packet &packet, GameData &gameData, sf::Uint8 precision);
+
 	// ============================================================================================
 	// Class Data Members
 	// ============================================================================================
@@ -49,18 +66,21 @@ public:
 	static const int MAX_POINTS;		// Amount of points needed to win
 	static const int LEFT_GOAL_LINE;	// X-Value that represents the left side goal
 	static const int RIGHT_GOAL_LINE;	// X-Value that represents the right side goal
+	static const float COMPACT_SCALE;	// Fixed point steps per pixel at compact precision
 
 	// Player One Data
 	int playerOneScore;
 	float playerOnePaddlePosition;		// This is the y-coordinate of the center of the paddle
 	int playerOneDirection;		
 	int playerOneHealth;
+	sf::Uint32 playerOneLastInput;		// Sequence of the last paddle update the server applied
 
 	// Player Two Data
 	int playerTwoScore;
 	float playerTwoPaddlePosition;		// This is the y-coordinate of the center of the paddle
 	int playerTwoDirection;		
 	int playerTwoHealth;
+	sf::Uint32 playerTwoLastInput;
 
 	// Ball Data
 	float ballX;						// Current x-coordinate of the ball
@@ -75,6 +95,11 @@ public:
 	bool startGame;						// Tells the client to start their game
 	bool healthPackSpawned;				// If the healthpack is active
 
+	// Snapshot Data
+	int serverTick;						// The engine cycle that produced this GameData
+	NetTime serverTime;					// Server clock time when this GameData was sent. Sent compact,
+										// the receiver must TimeBase::Expand() it
+
 private:
 
 };
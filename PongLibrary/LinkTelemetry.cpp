@@ -0,0 +1,364 @@
+// ================================================================================================
+// Filename: "LinkTelemetry.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the LinkStats and LinkTelemetry classes. For a class
+// description see the header file "LinkTelemetry.h"
+// ================================================================================================
+
+#include <cmath>
+#include "LinkTelemetry.h"
+
+// Initialize Static Constants
+const double LinkTelemetry::RTT_GAIN = 0.125;
+const double LinkTelemetry::VARIANCE_GAIN = 0.25;
+const double LinkTelemetry::JITTER_GAIN = (1.0 / 16.0);
+const double LinkTelemetry::LATE_JITTERS = 4.0;
+const NetTime LinkTelemetry::LATE_MINIMUM = 5000;	// 5 ms
+const NetTime LinkTelemetry::MIN_RTT_WINDOW = 10000000;	// 10 s
+
+// A hold time that marks a trailer with nothing to echo
+static const sf::Uint32 NO_ECHO = 0xFFFFFFFF;
+
+// ===== LinkStats Default Constructor ============================================================
+// The default constructor will start with nothing measured.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+LinkStats::LinkStats(void)
+{
+	rttValid = false;
+	lastRtt = 0;
+	smoothedRtt = 0;
+	rttVariance = 0;
+	minRtt = 0;
+	oneWayValid = false;
+	oneWayDelay = 0;
+	jitter = 0;
+	received = 0;
+	lost = 0;
+	reordered = 0;
+	late = 0;
+}
+
+// ===== LinkStats::Print =========================================================================
+// Method will write the measurements on one line, in ms.
+//
+// Input:
+//	[IN/OUT] std::ostream &out	- the stream to write to
+//
+// Output: none
+// ================================================================================================
+void LinkStats::Print(std::ostream &out) const
+{
+	out << "RTT: ";
+
+	if(rttValid)
+	{
+		out << (smoothedRtt / 1000.0) << "ms (+/- " << (rttVariance / 1000.0) << ", min " << (minRtt / 1000.0) << ")";
+	}
+	else
+	{
+		out << "-";
+	}
+
+	out << "  One-Way: ";
+
+	if(oneWayValid)
+	{
+		out << (oneWayDelay / 1000.0) << "ms";
+	}
+	else
+	{
+		out << "-";
+	}
+
+	out << "  Jitter: " << (jitter / 1000.0) << "ms  Received: " << received << "  Lost: " << lost
+		<< "  Reordered: " << reordered << "  Late: " << late;
+}
+
+// ===== Default Constructor ======================================================================
+// The default constructor will start the telemetry with nothing sent or received.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+LinkTelemetry::LinkTelemetry(void)
+{
+	m_nextSequence = 0;
+	m_haveEcho = false;
+	m_echoTime = 0;
+	m_echoReceived = 0;
+	m_haveEchoed = false;
+	m_echoedSendTime = 0;
+	m_echoedArrival = 0;
+	m_minRttTime = 0;
+	m_haveSequence = false;
+	m_expectedSequence = 0;
+	m_haveTransit = false;
+	m_lastTransit = 0;
+	m_meanTransit = 0;
+}
+
+// ===== Stamp ====================================================================================
+// Method will add the telemetry trailer to an outgoing packet, after everything else in it. The
+// latest received send time is echoed, if it hasn't been already.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- the packet to stamp
+//	[IN] NetTime now			- the current time on this end's clock
+//
+// Output: none
+// ================================================================================================
+void LinkTelemetry::Stamp(sf::Packet &packet, NetTime now)
+{
+	m_lock.lock();
+
+	sf::Uint16 sequence = m_nextSequence++;
+	NetTime echoTime = m_echoTime;
+	sf::Uint32 holdTime = NO_ECHO;
+
+	if(m_haveEcho)
+	{
+		holdTime = (sf::Uint32)(now - m_echoReceived);
+		m_haveEcho = false;
+	}
+
+	m_lock.unlock();
+
+	packet << sequence;
+	TimeBase::WriteCompact(packet, now);
+	TimeBase::WriteCompact(packet, echoTime);
+	packet << holdTime;
+}
+
+// ===== Read =====================================================================================
+// Method will take the telemetry trailer off an incoming packet, whose other contents have already
+// been read, and update the measurements.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet		- the packet, read up to the trailer
+//	[IN] NetTime now				- when the packet arrived, on this end's clock
+//	[IN] NetTime syncPoint			- the latest full time received from the other end, used to
+//									  expand its' compact send time
+//	[IN/OUT] NetTime &remoteSendTime	- receives the other end's send time
+//
+// Output:
+//	[OUT] bool						- true if the packet had a trailer, false otherwise
+// ================================================================================================
+bool LinkTelemetry::Read(sf::Packet &packet, NetTime now, NetTime syncPoint, NetTime &remoteSendTime)
+{
+	sf::Uint16 sequence = 0;
+	NetTime sendTime = 0;
+	NetTime echoTime = 0;
+	sf::Uint32 holdTime = NO_ECHO;
+
+	packet >> sequence;
+	TimeBase::ReadCompact(packet, sendTime);
+	TimeBase::ReadCompact(packet, echoTime);
+	packet >> holdTime;
+
+	if(!packet)
+	{
+		return false;
+	}
+
+	remoteSendTime = TimeBase::Expand(sendTime, syncPoint);
+
+	m_lock.lock();
+
+	m_stats.received++;
+
+	// Sequence
+	if(!m_haveSequence)
+	{
+		m_haveSequence = true;
+		m_expectedSequence = (sequence + 1);
+	}
+	else
+	{
+		sf::Int16 gap = (sf::Int16)(sequence - m_expectedSequence);
+
+		if(gap >= 0)
+		{
+			m_stats.lost += gap;
+			m_expectedSequence = (sequence + 1);
+		}
+		else
+		{
+			m_stats.reordered++;	// Filled a gap counted as lost
+
+			if(m_stats.lost > 0)
+			{
+				m_stats.lost--;
+			}
+		}
+	}
+
+	// Round Trip
+	if(holdTime != NO_ECHO)
+	{
+		NetTime echoedSendTime = TimeBase::Expand(echoTime, now);
+		NetTime rtt = ((now - echoedSendTime) - holdTime);
+
+		m_haveEchoed = true;
+		m_echoedSendTime = echoedSendTime;
+		m_echoedArrival = (remoteSendTime - holdTime);
+
+		if(rtt >= 0)
+		{
+			if(!m_stats.rttValid)
+			{
+				m_stats.rttValid = true;
+				m_stats.smoothedRtt = rtt;
+				m_stats.rttVariance = (rtt / 2);
+				m_stats.minRtt = rtt;
+				m_minRttTime = now;
+			}
+			else
+			{
+				NetTime deviation = ((rtt > m_stats.smoothedRtt) ? (rtt - m_stats.smoothedRtt) : (m_stats.smoothedRtt - rtt));
+
+				m_stats.rttVariance += (NetTime)((deviation - m_stats.rttVariance) * VARIANCE_GAIN);
+				m_stats.smoothedRtt += (NetTime)((rtt - m_stats.smoothedRtt) * RTT_GAIN);
+
+				// A minimum that has gone a window without being matched has expired
+				if((rtt <= m_stats.minRtt) || ((now - m_minRttTime) > MIN_RTT_WINDOW))
+				{
+					m_stats.minRtt = rtt;
+					m_minRttTime = now;
+				}
+			}
+
+			m_stats.lastRtt = rtt;
+		}
+	}
+
+	// Transit, jitter and lateness
+	NetTime transit = (now - remoteSendTime);
+
+	if(!m_haveTransit)
+	{
+		m_haveTransit = true;
+		m_meanTransit = (double)transit;
+	}
+	else
+	{
+		double change = std::fabs((double)(transit - m_lastTransit));
+		double lateness = (transit - m_meanTransit);
+
+		m_stats.jitter += ((change - m_stats.jitter) * JITTER_GAIN);
+
+		if((lateness > (LATE_JITTERS * m_stats.jitter)) && (lateness > LATE_MINIMUM))
+		{
+			m_stats.late++;
+		}
+
+		m_meanTransit += ((transit - m_meanTransit) * JITTER_GAIN);
+	}
+
+	m_lastTransit = transit;
+
+	// Echo it on the next stamped packet
+	m_haveEcho = true;
+	m_echoTime = remoteSendTime;
+	m_echoReceived = now;
+
+	m_lock.unlock();
+
+	return true;
+}
+
+// ===== AddOneWayDelay ===========================================================================
+// Method will add the one-way delay of a packet from the other end, worked out by the caller from
+// the clock estimate. It is smoothed with the same gain as the round trip time.
+//
+// Input:
+//	[IN] NetTime delay	- the packet's one-way delay
+//
+// Output: none
+// ================================================================================================
+void LinkTelemetry::AddOneWayDelay(NetTime delay)
+{
+	m_lock.lock();
+
+	if(!m_stats.oneWayValid)
+	{
+		m_stats.oneWayValid = true;
+		m_stats.oneWayDelay = delay;
+	}
+	else
+	{
+		m_stats.oneWayDelay += (NetTime)((delay - m_stats.oneWayDelay) * RTT_GAIN);
+	}
+
+	m_lock.unlock();
+}
+
+// ===== TakeEchoedArrival ========================================================================
+// Method will give the latest of this end's packets the other end has echoed, once: when it was
+// sent, and when it arrived at the other end, on the other end's clock.
+//
+// Input:
+//	[IN/OUT] NetTime &sendTime		- receives when this end sent the packet
+//	[IN/OUT] NetTime &remoteArrival	- receives when it arrived, on the other end's clock
+//
+// Output:
+//	[OUT] bool						- true if a packet was echoed since the last call, false otherwise
+// ================================================================================================
+bool LinkTelemetry::TakeEchoedArrival(NetTime &sendTime, NetTime &remoteArrival)
+{
+	m_lock.lock();
+
+	bool echoed = m_haveEchoed;
+
+	sendTime = m_echoedSendTime;
+	remoteArrival = m_echoedArrival;
+	m_haveEchoed = false;
+
+	m_lock.unlock();
+
+	return echoed;
+}
+
+// ===== Restart ==================================================================================
+// Method will forget the sequence, transit, and echo state after the connection is replaced, so
+// the packets lost with the old connection aren't counted and its' transit times aren't compared
+// with the new one's. The measurements so far are kept.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void LinkTelemetry::Restart(void)
+{
+	m_lock.lock();
+
+	m_haveSequence = false;
+	m_haveTransit = false;
+	m_haveEcho = false;
+	m_haveEchoed = false;
+
+	m_lock.unlock();
+}
+
+// ===== GetStats =================================================================================
+// Method will return a copy of the measurements.
+//
+// Input: none
+//
+// Output:
+//	[OUT] LinkStats	- the current measurements
+// ================================================================================================
+LinkStats LinkTelemetry::GetStats(void)
+{
+	m_lock.lock();
+
+	LinkStats stats = m_stats;
+
+	m_lock.unlock();
+
+	return stats;
+}
@@ -0,0 +1,145 @@
+// ================================================================================================
+// Filename: "LinkTelemetry.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The LinkTelemetry class measures a connection from the packets the game already sends, without
+// any packets of its' own. Each end keeps one. Stamp() adds a small trailer to an outgoing
+// GAME_UPDATE or PADDLE_UPDATE, and Read() takes the trailer off an incoming one.
+//
+// The trailer carries:
+//	sequence	- counts up by one for every stamped packet, 16 bits
+//	send time	- the sender's clock when the packet was stamped, compact
+//	echo time	- the send time of the latest stamped packet the sender has received, compact
+//	hold time	- how long, in us, the sender held that packet before echoing it
+//
+// When a trailer echoes one of this end's own send times, the round trip time is the time since
+// it was sent, less the time the other end held it. Round trips are smoothed the way TCP smooths
+// its' retransmission timer: a smoothed RTT with gain 1/8 and an RTT variance with gain 1/4.
+// The least round trip is windowed: a minimum older than MIN_RTT_WINDOW is replaced by the next
+// sample, so a route that has lastingly grown longer becomes the link's new base round trip
+// instead of leaving every later round trip measured against one that no longer exists.
+// Each packet is echoed at most once, so every sample is a fresh round trip.
+//
+// Gaps in the sequence are counted as lost packets, and a packet that fills an earlier gap counts
+// as reordered instead. The connections the game runs over are usually reliable, so trouble more
+// often shows up as lateness: the transit time of each packet, arrival time less send time, is
+// tracked against its' running mean, and a packet that arrives more than four times the jitter
+// behind it counts as late. Jitter is the interarrival jitter of RTP (RFC 3550), which compares
+// transit times with each other and so needs no clock sync. The unknown clock offset cancels out
+// the same way in the late check.
+//
+// The one-way delay does need the clocks mapped onto each other. The caller has the clock
+// estimate, so it works out each packet's one-way delay and passes it to AddOneWayDelay(). The
+// echo also tells when one of this end's packets arrived at the other end, on the other end's
+// clock: its' send time less the hold time. TakeEchoedArrival() gives the latest one, so the
+// caller can work out the one-way delay of this end's own packets too.
+//
+// Stamp() and Read() are called from different threads, so every method takes the telemetry lock.
+// ================================================================================================
+
+#ifndef LINKTELEMETRY_H
+#define LINKTELEMETRY_H
+
+#include <mutex>
+#include <ostream>
+#include <SFML\Network\Packet.hpp>
+#include "NetTime.h"
+
+// ================================================================================================
+// LinkStats - a snapshot of the measurements
+// ================================================================================================
+class LinkStats
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	LinkStats(void);
+	~LinkStats(void){}
+
+	// Method Prototypes
+	void Print(std::ostream &out) const;
+
+	// Round Trip Data, valid once rttValid is set
+	bool rttValid;
+	NetTime lastRtt;			// The latest round trip
+	NetTime smoothedRtt;		// Smoothed round trip time
+	NetTime rttVariance;		// Mean deviation of the round trip time
+	NetTime minRtt;				// Least round trip of the last MIN_RTT_WINDOW
+
+	// One-Way Data, valid once oneWayValid is set
+	bool oneWayValid;
+	NetTime oneWayDelay;		// Smoothed one-way delay of packets from the other end
+	double jitter;				// Interarrival jitter, in us
+
+	// Counters of packets from the other end
+	sf::Uint32 received;
+	sf::Uint32 lost;			// Sequence numbers never received
+	sf::Uint32 reordered;		// Arrived after a later packet
+	sf::Uint32 late;			// Arrived more than four times the jitter behind the mean
+};
+
+// ================================================================================================
+// LinkTelemetry
+// ================================================================================================
+class LinkTelemetry
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	LinkTelemetry(void);
+	~LinkTelemetry(void){}
+
+	// Method Prototypes
+	void Stamp(sf::Packet &packet, NetTime now);
+	bool Read(sf::Packet &packet, NetTime now, NetTime syncPoint, NetTime &remoteSendTime);
+	void AddOneWayDelay(NetTime delay);
+	bool TakeEchoedArrival(NetTime &sendTime, NetTime &remoteArrival);
+	void Restart(void);
+	LinkStats GetStats(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const double RTT_GAIN;			// Gain of the smoothed round trip time
+	static const double VARIANCE_GAIN;		// Gain of the round trip variance
+	static const double JITTER_GAIN;		// Gain of the interarrival jitter and mean transit
+	static const double LATE_JITTERS;		// Jitters behind the mean transit a packet counts as late
+	static const NetTime LATE_MINIMUM;		// Least lateness counted, so a quiet link isn't all late
+	static const NetTime MIN_RTT_WINDOW;	// Time a least round trip is kept before it expires
+
+private:
+
+	std::mutex m_lock;
+	LinkStats m_stats;
+
+	// Outgoing Data
+	sf::Uint16 m_nextSequence;
+	bool m_haveEcho;				// A received send time is waiting to be echoed
+	NetTime m_echoTime;				// The other end's send time to echo
+	NetTime m_echoReceived;			// When that packet arrived
+	bool m_haveEchoed;				// One of this end's packets was echoed, not yet taken
+	NetTime m_echoedSendTime;		// When this end sent it
+	NetTime m_echoedArrival;		// When it arrived, on the other end's clock
+
+	// Incoming Data
+	NetTime m_minRttTime;			// When the least round trip was sampled
+	bool m_haveSequence;			// False until the first packet, and after Restart()
+	sf::Uint16 m_expectedSequence;
+	bool m_haveTransit;
+	NetTime m_lastTransit;
+	double m_meanTransit;
+};
+
+#endif
@@ -0,0 +1,223 @@
+// ================================================================================================
+// Filename: "LoopbackTransport.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the LoopbackTransport class. For a class description
+// see the header file "LoopbackTransport.h"
+// ================================================================================================
+
+#include <thread>
+#include <SFML\System\Sleep.hpp>
+#include <SFML\System\Clock.hpp>
+#include "LoopbackTransport.h"
+
+// Initialize Static Constants
+const int LoopbackTransport::SPIN_COUNT = 64;
+const int LoopbackTransport::YIELD_COUNT = 1024;
+
+// ===== PacketRing Constructor ===================================================================
+// The constructor will start the ring empty.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+PacketRing::PacketRing(void)
+{
+	m_head.store(0);
+	m_tail.store(0);
+}
+
+// ===== PacketRing::Push =========================================================================
+// Method will copy the packet into the next free slot. Must only be called by the producer.
+//
+// Input:
+//	[IN] const sf::Packet &packet	- the packet to queue
+//
+// Output:
+//	[OUT] bool						- true if queued, false if the ring is full
+// ================================================================================================
+bool PacketRing::Push(const sf::Packet &packet)
+{
+	unsigned int tail = m_tail.load(std::memory_order_relaxed);
+
+	if((tail - m_head.load(std::memory_order_acquire)) >= CAPACITY)
+	{
+		return false;
+	}
+
+	m_slots[tail % CAPACITY] = packet;
+	m_tail.store((tail + 1), std::memory_order_release);
+
+	return true;
+}
+
+// ===== PacketRing::Pop ==========================================================================
+// Method will copy the oldest packet out of the ring. Must only be called by the consumer.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//
+// Output:
+//	[OUT] bool					- true if a packet was read, false if the ring is empty
+// ================================================================================================
+bool PacketRing::Pop(sf::Packet &packet)
+{
+	unsigned int head = m_head.load(std::memory_order_relaxed);
+
+	if(head == m_tail.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	packet = m_slots[head % CAPACITY];
+	m_slots[head % CAPACITY].clear();
+	m_head.store((head + 1), std::memory_order_release);
+
+	return true;
+}
+
+// ===== Constructor ==============================================================================
+// The constructor will attach this transport to one end of a shared channel.
+//
+// Input:
+//	[IN] std::shared_ptr<LoopbackChannel> channel	- the channel shared with the other end
+//	[IN] int end									- which end this transport is, 0 or 1
+//
+// Output: none
+// ================================================================================================
+LoopbackTransport::LoopbackTransport(std::shared_ptr<LoopbackChannel> channel, int end) : m_channel(channel)
+{
+	m_end = end;
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will close the channel so the other end sees a disconnect. The channel itself is
+// released when both ends are gone.
+// ================================================================================================
+LoopbackTransport::~LoopbackTransport(void)
+{
+	Disconnect();
+}
+
+// ===== CreatePair ===============================================================================
+// Method will create a channel and the two transports attached to it. The caller takes ownership
+// of both transports.
+//
+// Input:
+//	[IN/OUT] Transport *&serverEnd	- receives the end to hand to the server
+//	[IN/OUT] Transport *&clientEnd	- receives the end to hand to the client
+//
+// Output: none
+// ================================================================================================
+void LoopbackTransport::CreatePair(Transport *&serverEnd, Transport *&clientEnd)
+{
+	std::shared_ptr<LoopbackChannel> channel(new LoopbackChannel);
+	channel->closed.store(false);
+
+	serverEnd = new LoopbackTransport(channel, 0);
+	clientEnd = new LoopbackTransport(channel, 1);
+}
+
+// ===== Backoff ==================================================================================
+// Method will wait a little longer each time it is called: spin first, then yield the thread, and
+// finally sleep for a millisecond between polls.
+//
+// Input:
+//	[IN/OUT] int &attempts	- how many times the caller has polled so far
+//
+// Output: none
+// ================================================================================================
+void LoopbackTransport::Backoff(int &attempts)
+{
+	attempts++;
+
+	if(attempts < SPIN_COUNT)
+	{
+		return;
+	}
+	else if(attempts < YIELD_COUNT)
+	{
+		std::this_thread::yield();
+	}
+	else
+	{
+		sf::sleep(sf::milliseconds(1));
+	}
+}
+
+// ===== Send =====================================================================================
+// Method will queue the packet for the other end, waiting for room if the ring is full.
+//
+// Input:
+//	[IN] sf::Packet &packet		- the packet to send
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done, or Disconnected if the channel was closed
+// ================================================================================================
+sf::Socket::Status LoopbackTransport::Send(sf::Packet &packet)
+{
+	int attempts = 0;
+
+	while(!m_channel->closed.load())
+	{
+		if(m_channel->rings[m_end].Push(packet))
+		{
+			return sf::Socket::Done;
+		}
+
+		Backoff(attempts);
+	}
+
+	return sf::Socket::Disconnected;
+}
+
+// ===== Receive ==================================================================================
+// Method will wait until the other end sends a packet. Packets already queued are still delivered
+// after the channel closes.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//	[IN] sf::Time timeout		- the longest to wait, sf::Time::Zero to wait forever
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done, NotReady on timeout, or Disconnected if the channel was closed
+// ================================================================================================
+sf::Socket::Status LoopbackTransport::Receive(sf::Packet &packet, sf::Time timeout)
+{
+	int attempts = 0;
+	sf::Clock waitClock;
+
+	while(true)
+	{
+		if(m_channel->rings[1 - m_end].Pop(packet))
+		{
+			return sf::Socket::Done;
+		}
+
+		// The other end may have sent and then closed since the Pop() above
+		if(m_channel->closed.load())
+		{
+			return (m_channel->rings[1 - m_end].Pop(packet) ? sf::Socket::Done : sf::Socket::Disconnected);
+		}
+
+		if((timeout != sf::Time::Zero) && (waitClock.getElapsedTime() >= timeout))
+		{
+			return sf::Socket::NotReady;
+		}
+
+		Backoff(attempts);
+	}
+}
+
+// ===== Disconnect ===============================================================================
+// Method will close the channel for both ends.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void LoopbackTransport::Disconnect(void)
+{
+	m_channel->closed.store(true);
+}
@@ -0,0 +1,104 @@
+// ================================================================================================
+// Filename: "LoopbackTransport.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The LoopbackTransport class connects a server and a client that live in the same process. A
+// pair of transports is created together with CreatePair(); whatever one end sends, the other end
+// receives. No sockets are involved, so whole server plus client matches can be run without
+// touching the kernel's network stack. The server's ShardBenchmark connects its' clients this way.
+//
+// Each direction is a single-producer/single-consumer ring of packets. The ring is lock-free: the
+// outgoing thread on one end only moves the tail and the listening thread on the other end only
+// moves the head. A Receive() on an empty ring spins, then yields, then sleeps until a packet
+// arrives or either end disconnects.
+// ================================================================================================
+
+#ifndef LOOPBACKTRANSPORT_H
+#define LOOPBACKTRANSPORT_H
+
+#include <atomic>
+#include <memory>
+#include "Transport.h"
+
+// ================================================================================================
+// PacketRing - a fixed size, lock-free, single-producer/single-consumer queue of packets
+// ================================================================================================
+class PacketRing
+{
+
+public:
+
+	// Constructor Prototype
+	PacketRing(void);
+
+	// Method Prototypes
+	bool Push(const sf::Packet &packet);
+	bool Pop(sf::Packet &packet);
+
+	// Constants
+	static const unsigned int CAPACITY = 256;
+
+private:
+
+	sf::Packet m_slots[CAPACITY];
+	std::atomic<unsigned int> m_head;	// Next slot to read, only moved by the consumer
+	std::atomic<unsigned int> m_tail;	// Next slot to write, only moved by the producer
+};
+
+// ================================================================================================
+// LoopbackChannel - the state shared by both ends of a loopback pair
+// ================================================================================================
+struct LoopbackChannel
+{
+	PacketRing rings[2];				// rings[n] carries packets sent by end n
+	std::atomic<bool> closed;
+};
+
+// ================================================================================================
+// LoopbackTransport
+// ================================================================================================
+class LoopbackTransport: public Transport
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Destructor
+	~LoopbackTransport(void);
+
+	// Static Factory
+	static void CreatePair(Transport *&serverEnd, Transport *&clientEnd);
+
+	// Transport Prototypes
+	sf::Socket::Status Send(sf::Packet &packet);
+	sf::Socket::Status Receive(sf::Packet &packet, sf::Time timeout);
+	void Disconnect(void);
+	sf::IpAddress GetRemoteAddress(void){ return sf::IpAddress::LocalHost; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int SPIN_COUNT;		// Empty/full polls before yielding the thread
+	static const int YIELD_COUNT;		// Yields before sleeping between polls
+
+private:
+
+	// Private Constructor, use CreatePair()
+	LoopbackTransport(std::shared_ptr<LoopbackChannel> channel, int end);
+
+	static void Backoff(int &attempts);
+
+	std::shared_ptr<LoopbackChannel> m_channel;
+	int m_end;
+};
+
+#endif
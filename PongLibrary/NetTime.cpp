@@ -0,0 +1,142 @@
+// ================================================================================================
+// Filename: "NetTime.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the implementation file for the TimeBase class. For a class description see the header
+// file "NetTime.h"
+// ================================================================================================
+
+#include "NetTime.h"
+
+// ===== Now ======================================================================================
+// Method will return the elapsed time of a clock.
+//
+// Input:
+//	[IN] const sf::Clock *clock	- the clock to read
+//
+// Output:
+//	[OUT] NetTime				- the clock's elapsed time, in us
+// ================================================================================================
+NetTime TimeBase::Now(const sf::Clock *clock)
+{
+	return clock->getElapsedTime().asMicroseconds();
+}
+
+// ===== FromMilliseconds =========================================================================
+// Method will convert a millisecond value, such as a timeout option, to a NetTime.
+//
+// Input:
+//	[IN] int milliseconds	- the time in ms
+//
+// Output:
+//	[OUT] NetTime			- the same time in us
+// ================================================================================================
+NetTime TimeBase::FromMilliseconds(int milliseconds)
+{
+	return ((NetTime)milliseconds * 1000);
+}
+
+// ===== ToMilliseconds ===========================================================================
+// Method will convert a NetTime to whole milliseconds, for printing.
+//
+// Input:
+//	[IN] NetTime time	- the time in us
+//
+// Output:
+//	[OUT] int			- the same time in ms, rounded towards zero
+// ================================================================================================
+int TimeBase::ToMilliseconds(NetTime time)
+{
+	return (int)(time / 1000);
+}
+
+// ===== Write ====================================================================================
+// Method will put a full NetTime into a packet, high half first.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- the packet to receive the time
+//	[IN] NetTime time			- the time to write
+//
+// Output: none
+// ================================================================================================
+void TimeBase::Write(sf::Packet &packet, NetTime time)
+{
+	sf::Uint32 high = (sf::Uint32)((sf::Uint64)time >> 32);
+	sf::Uint32 low = (sf::Uint32)((sf::Uint64)time & 0xFFFFFFFF);
+
+	packet << high << low;
+}
+
+// ===== Read =====================================================================================
+// Method will extract a full NetTime written by Write().
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- the packet that contains the time
+//	[IN/OUT] NetTime &time		- receives the time
+//
+// Output: none
+// ================================================================================================
+void TimeBase::Read(sf::Packet &packet, NetTime &time)
+{
+	sf::Uint32 high = 0;
+	sf::Uint32 low = 0;
+
+	packet >> high >> low;
+
+	time = (NetTime)(((sf::Uint64)high << 32) | low);
+}
+
+// ===== WriteCompact =============================================================================
+// Method will put the low 32 bits of a NetTime into a packet.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- the packet to receive the time
+//	[IN] NetTime time			- the time to write
+//
+// Output: none
+// ================================================================================================
+void TimeBase::WriteCompact(sf::Packet &packet, NetTime time)
+{
+	sf::Uint32 low = (sf::Uint32)((sf::Uint64)time & 0xFFFFFFFF);
+
+	packet << low;
+}
+
+// ===== ReadCompact ==============================================================================
+// Method will extract a time written by WriteCompact(). Only the low 32 bits are known until the
+// time is passed through Expand() with the receiver's sync point.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- the packet that contains the time
+//	[IN/OUT] NetTime &time		- receives the compact time
+//
+// Output: none
+// ================================================================================================
+void TimeBase::ReadCompact(sf::Packet &packet, NetTime &time)
+{
+	sf::Uint32 low = 0;
+
+	packet >> low;
+
+	time = low;
+}
+
+// ===== Expand ===================================================================================
+// Method will recover a full NetTime from its' low 32 bits, using the closest time to the sync
+// point that has those bits.
+//
+// Input:
+//	[IN] NetTime compact	- the compact time, as read by ReadCompact()
+//	[IN] NetTime syncPoint	- the latest full time received from the same clock
+//
+// Output:
+//	[OUT] NetTime			- the full time
+// ================================================================================================
+NetTime TimeBase::Expand(NetTime compact, NetTime syncPoint)
+{
+	sf::Int32 delta = (sf::Int32)((sf::Uint32)compact - (sf::Uint32)syncPoint);
+
+	return (syncPoint + delta);
+}
@@ -0,0 +1,62 @@
+// ================================================================================================
+// Filename: "NetTime.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// NetTime is the one time type shared by the client, the server, and the protocol between them: a
+// signed 64-bit count of microseconds on a monotonic clock. An sf::Clock is already monotonic and
+// counts in microseconds, so a NetTime is simply its' elapsed time, without the millisecond
+// rounding and without wrapping for as long as anyone could keep a server up.
+//
+// The TimeBase class holds the static helpers for reading a clock, converting to and from the
+// millisecond values used in the options and game constants, and putting NetTimes into packets.
+// sf::Packet has no 64-bit overloads, so a full NetTime is written as two 32-bit halves.
+//
+// Most timestamps don't need all 64 bits on the wire. The TimeSync rounds carry full NetTimes, and
+// each end keeps the latest one it has received from the other as its' sync point. Every other
+// timestamp is sent compact, as its' low 32 bits only. The receiver takes the difference between
+// those bits and the low bits of its' sync point as a signed 32-bit delta, and adds it to the sync
+// point. That recovers the full time as long as it lies within about 35 minutes of the sync point,
+// and sync points are refreshed every second. Because the delta is worked out by the receiver, the
+// sender never has to know which sync point the other end has seen, and packets that are queued
+// before a sync round but sent after it still decode correctly.
+// ================================================================================================
+
+#ifndef NETTIME_H
+#define NETTIME_H
+
+#include <SFML\Config.hpp>
+#include <SFML\System\Clock.hpp>
+#include <SFML\Network\Packet.hpp>
+
+// Microseconds on a monotonic clock, or a span of microseconds
+typedef sf::Int64 NetTime;
+
+class TimeBase
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Clock Methods
+	static NetTime Now(const sf::Clock *clock);
+	static NetTime FromMilliseconds(int milliseconds);
+	static int ToMilliseconds(NetTime time);
+
+	// Full Packet Methods
+	static void Write(sf::Packet &packet, NetTime time);
+	static void Read(sf::Packet &packet, NetTime &time);
+
+	// Compact Packet Methods
+	static void WriteCompact(sf::Packet &packet, NetTime time);
+	static void ReadCompact(sf::Packet &packet, NetTime &time);
+	static NetTime Expand(NetTime compact, NetTime syncPoint);
+};
+
+#endif
@@ -0,0 +1,180 @@
+// ================================================================================================
+// Filename: "NetworkProfile.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the LinkProfile and NetworkProfile classes. For a
+// class description see the header file "NetworkProfile.h"
+// ================================================================================================
+
+#include "NetworkProfile.h"
+
+// ===== Built-In Profiles ========================================================================
+// Each entry is a name, then the up link and the down link as: latency, jitter, distribution,
+// loss, and bandwidth.
+// ================================================================================================
+struct ProfileEntry
+{
+	const char *name;
+	LinkProfile up;
+	LinkProfile down;
+};
+
+static const ProfileEntry PROFILES[] =
+{
+	{"off",			LinkProfile(),
+					LinkProfile()},
+	{"lan",			LinkProfile(1, 1, LinkProfile::UNIFORM, 0, 0),
+					LinkProfile(1, 1, LinkProfile::UNIFORM, 0, 0)},
+	{"broadband",	LinkProfile(15, 4, LinkProfile::NORMAL, 0.001f, 5000),
+					LinkProfile(15, 4, LinkProfile::NORMAL, 0.001f, 25000)},
+	{"wifi",		LinkProfile(5, 12, LinkProfile::PARETO, 0.01f, 0),
+					LinkProfile(5, 12, LinkProfile::PARETO, 0.01f, 0)},
+	{"mobile",		LinkProfile(50, 25, LinkProfile::NORMAL, 0.02f, 1000),
+					LinkProfile(50, 25, LinkProfile::NORMAL, 0.02f, 4000)},
+	{"overseas",	LinkProfile(120, 8, LinkProfile::NORMAL, 0.005f, 0),
+					LinkProfile(120, 8, LinkProfile::NORMAL, 0.005f, 0)},
+	{"legacy",		LinkProfile(200, 300, LinkProfile::UNIFORM, 0, 0),
+					LinkProfile(200, 300, LinkProfile::UNIFORM, 0, 0)}
+};
+
+static const int PROFILE_COUNT = (sizeof(PROFILES) / sizeof(PROFILES[0]));
+
+// ===== LinkProfile Default Constructor ==========================================================
+// The default constructor will create a link that passes packets straight through.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+LinkProfile::LinkProfile(void)
+{
+	latency = 0;
+	jitter = 0;
+	distribution = CONSTANT;
+	loss = 0;
+	bandwidth = 0;
+}
+
+// ===== LinkProfile Constructor ==================================================================
+// The constructor will create a link with every value given.
+//
+// Input:
+//	[IN] int latency				- least time, in ms, a packet takes to cross the link
+//	[IN] int jitter					- scale, in ms, of the extra latency
+//	[IN] sf::Uint8 distribution		- how the extra latency is distributed
+//	[IN] float loss					- chance a packet has to be retransmitted
+//	[IN] int bandwidth				- link speed in kbit/s, 0 for no cap
+//
+// Output: none
+// ================================================================================================
+LinkProfile::LinkProfile(int latency, int jitter, sf::Uint8 distribution, float loss, int bandwidth)
+{
+	this->latency = latency;
+	this->jitter = jitter;
+	this->distribution = distribution;
+	this->loss = loss;
+	this->bandwidth = bandwidth;
+}
+
+// ===== LinkProfile::IsActive ====================================================================
+// Method will check if the link changes packets at all.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if any packet would be delayed or lost
+// ================================================================================================
+bool LinkProfile::IsActive(void) const
+{
+	return ((latency > 0) || (jitter > 0) || (loss > 0) || (bandwidth > 0));
+}
+
+// ===== LinkProfile Packet Input Overload ========================================================
+// This method overloads the stream operator used with the sf::Packet class so that a LinkProfile
+// can be sent to the client.
+//
+// Input:
+//	[IN/OUT] sf::Packet& packet		- the packet to receive the link
+//	[IN]	LinkProfile& link		- a reference to the link
+//
+// Output:
+//	[OUT] sf::Packet& packet		- will return the passed packet reference
+// ================================================================================================
+sf::Packet& operator<<(sf::Packet& packet, LinkProfile& link)
+{
+	packet << link.latency << link.jitter << link.distribution << link.loss << link.bandwidth;
+
+	return packet;
+}
+
+// ===== LinkProfile Packet Output Overload =======================================================
+// This method overloads the stream operator used with the sf::Packet class so that a LinkProfile
+// can be extracted from a packet.
+//
+// Input:
+//	[IN/OUT] sf::Packet& packet		- the packet that contains the link
+//	[IN]	LinkProfile& link		- a reference to the link that will receive the data
+//
+// Output:
+//	[OUT] sf::Packet& packet		- will return the passed packet reference
+// ================================================================================================
+sf::Packet& operator>>(sf::Packet& packet, LinkProfile& link)
+{
+	packet >> link.latency >> link.jitter >> link.distribution >> link.loss >> link.bandwidth;
+
+	return packet;
+}
+
+// ===== NetworkProfile Default Constructor =======================================================
+// The default constructor will create the "off" profile.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+NetworkProfile::NetworkProfile(void)
+{
+	name = "off";
+}
+
+// ===== NetworkProfile::Find =====================================================================
+// Method will look up a built-in profile by name.
+//
+// Input:
+//	[IN] const std::string &name		- the name of the profile
+//	[IN/OUT] NetworkProfile &profile	- receives the profile
+//
+// Output:
+//	[OUT] bool							- true if the profile was found, false otherwise
+// ================================================================================================
+bool NetworkProfile::Find(const std::string &name, NetworkProfile &profile)
+{
+	for(int i = 0; i < PROFILE_COUNT; i++)
+	{
+		if(name == PROFILES[i].name)
+		{
+			profile.name = PROFILES[i].name;
+			profile.up = PROFILES[i].up;
+			profile.down = PROFILES[i].down;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// ===== NetworkProfile::PrintProfiles ============================================================
+// Method will print the name of every built-in profile.
+//
+// Input:
+//	[IN/OUT] std::ostream &out	- the stream to print to
+//
+// Output: none
+// ================================================================================================
+void NetworkProfile::PrintProfiles(std::ostream &out)
+{
+	for(int i = 0; i < PROFILE_COUNT; i++)
+	{
+		out << (i > 0 ? ", " : "") << PROFILES[i].name;
+	}
+}
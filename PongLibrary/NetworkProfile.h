@@ -0,0 +1,111 @@
+// ================================================================================================
+// Filename: "NetworkProfile.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// A LinkProfile describes one direction of an emulated network link: how long a packet takes to
+// cross it, how that time varies, and how often packets are lost on the way. An EmulatedTransport
+// applies a LinkProfile to every packet it receives.
+//
+// The latency of each packet is latency plus a random amount drawn from the link's distribution:
+//	CONSTANT	- no variation, jitter is ignored
+//	UNIFORM		- anywhere from 0 to jitter
+//	NORMAL		- normally distributed around 0 with jitter as the standard deviation, never negative
+//	PARETO		- a long tailed distribution with jitter as its' scale; most packets see little
+//				  extra delay and a few see a lot, the way a congested Wi-Fi link behaves
+//
+// The links the game runs over are reliable, so a lost packet is not dropped. It is delivered
+// after a retransmission timeout instead, and the packets behind it wait for it, the same
+// head-of-line stall TCP produces. Packets are never duplicated or delivered out of order, as no
+// Transport may do either. A bandwidth cap queues packets behind each other for the time
+// it takes to clock them onto the link.
+//
+// A NetworkProfile is a named pair of links, up (client to server) and down (server to client).
+// The built-in profiles are looked up by name with NetworkProfile::Find(). The server picks a
+// profile, emulates the up link on the packets it receives, and sends the down link to the client
+// in INITIALIZE so the client can emulate it on its' side.
+//
+// To increase simplicity, the LinkProfile and NetworkProfile classes make all members public.
+// ================================================================================================
+
+#ifndef NETWORKPROFILE_H
+#define NETWORKPROFILE_H
+
+#include <string>
+#include <ostream>
+#include <SFML\Network\Packet.hpp>
+
+// ================================================================================================
+// LinkProfile - one direction of an emulated link
+// ================================================================================================
+class LinkProfile
+{
+
+public:
+
+	// Latency Distributions
+	enum Distribution {CONSTANT, UNIFORM, NORMAL, PARETO};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	LinkProfile(void);
+	LinkProfile(int latency, int jitter, sf::Uint8 distribution, float loss, int bandwidth);
+	~LinkProfile(void){}
+
+	// Method Prototypes
+	bool IsActive(void) const;
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	int latency;				// Least time, in ms, a packet takes to cross the link
+	int jitter;					// Scale, in ms, of the extra time drawn from the distribution
+	sf::Uint8 distribution;		// One of the Distribution values
+	float loss;					// Chance, 0 to 1, a packet has to be retransmitted
+	int bandwidth;				// Link speed in kbit/s, 0 for no cap
+};
+
+// Packet Overloads for LinkProfile
+sf::Packet& operator<<(sf::Packet& packet, LinkProfile& link);
+sf::Packet& operator>>(sf::Packet& packet, LinkProfile& link);
+
+// ================================================================================================
+// NetworkProfile - a named pair of links
+// ================================================================================================
+class NetworkProfile
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	NetworkProfile(void);
+	~NetworkProfile(void){}
+
+	// Static Methods
+	static bool Find(const std::string &name, NetworkProfile &profile);
+	static void PrintProfiles(std::ostream &out);
+
+	// Inlined Methods
+	bool IsActive(void) const { return (up.IsActive() || down.IsActive()); }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	std::string name;
+	LinkProfile up;				// Client to server
+	LinkProfile down;			// Server to client
+};
+
+#endif
@@ -0,0 +1,278 @@
+// ================================================================================================
+// Filename: "NetworkTrace.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the TraceSample and NetworkTrace classes. For a class
+// description see the header file "NetworkTrace.h"
+// ================================================================================================
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "NetworkTrace.h"
+#include "EmulatedTransport.h"
+
+// ===== TraceSample Default Constructor ==========================================================
+// The default constructor will create a sample with no delay.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+TraceSample::TraceSample(void)
+{
+	time = 0;
+	delay = 0;
+	lost = false;
+}
+
+// ===== TraceSample Constructor ==================================================================
+// The constructor will create a sample with every value given.
+//
+// Input:
+//	[IN] NetTime time		- time since the first sample of the trace
+//	[IN] NetTime delay		- time the packet took to cross the link, not counting a retransmission
+//	[IN] bool lost			- true if the packet had to be retransmitted
+//
+// Output: none
+// ================================================================================================
+TraceSample::TraceSample(NetTime time, NetTime delay, bool lost)
+{
+	this->time = time;
+	this->delay = delay;
+	this->lost = lost;
+}
+
+// ===== TraceSample Packet Input Overload ========================================================
+// This method overloads the stream operator used with the sf::Packet class so that a TraceSample
+// can be sent to the client. The time is sent in ms and the delay in us, which keeps a sample to
+// 9 bytes and covers traces of over three weeks.
+//
+// Input:
+//	[IN/OUT] sf::Packet& packet		- the packet to receive the sample
+//	[IN]	TraceSample& sample		- a reference to the sample
+//
+// Output:
+//	[OUT] sf::Packet& packet		- will return the passed packet reference
+// ================================================================================================
+sf::Packet& operator<<(sf::Packet& packet, TraceSample& sample)
+{
+	sf::Uint32 time = (sf::Uint32)TimeBase::ToMilliseconds(sample.time);
+	sf::Uint32 delay = (sf::Uint32)sample.delay;
+	sf::Uint8 lost = sample.lost;
+
+	packet << time << delay << lost;
+
+	return packet;
+}
+
+// ===== TraceSample Packet Output Overload =======================================================
+// This method overloads the stream operator used with the sf::Packet class so that a TraceSample
+// can be extracted from a packet.
+//
+// Input:
+//	[IN/OUT] sf::Packet& packet		- the packet that contains the sample
+//	[IN]	TraceSample& sample		- a reference to the sample that will receive the data
+//
+// Output:
+//	[OUT] sf::Packet& packet		- will return the passed packet reference
+// ================================================================================================
+sf::Packet& operator>>(sf::Packet& packet, TraceSample& sample)
+{
+	sf::Uint32 time = 0;
+	sf::Uint32 delay = 0;
+	sf::Uint8 lost = 0;
+
+	packet >> time >> delay >> lost;
+
+	sample.time = TimeBase::FromMilliseconds((int)time);
+	sample.delay = delay;
+	sample.lost = (lost != 0);
+
+	return packet;
+}
+
+// ===== Default Constructor ======================================================================
+// The default constructor will create an empty trace, ready to record.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+NetworkTrace::NetworkTrace(void)
+{
+	m_started = false;
+	m_startTime = 0;
+	m_leastDelay[UP] = 0;
+	m_leastDelay[DOWN] = 0;
+}
+
+// ===== Record ===================================================================================
+// Method will add a sample to the trace. A packet that arrives more than a retransmission timeout
+// later than the least delay seen in its' direction is marked as lost, with the retransmission
+// taken out of its' delay. Negative delays, from error in the clock estimate, are taken as 0.
+//
+// Input:
+//	[IN] Direction direction	- which direction the packet crossed the link
+//	[IN] NetTime time			- when the packet was received
+//	[IN] NetTime delay			- time the packet took to cross the link
+//
+// Output: none
+// ================================================================================================
+void NetworkTrace::Record(Direction direction, NetTime time, NetTime delay)
+{
+	std::vector<TraceSample> &samples = ((direction == UP) ? up : down);
+	NetTime retransmit = TimeBase::FromMilliseconds(EmulatedTransport::RETRANSMIT_TIMEOUT);
+
+	if(!m_started)
+	{
+		m_started = true;
+		m_startTime = time;
+	}
+
+	if(delay < 0)
+	{
+		delay = 0;
+	}
+
+	if(samples.empty() || (delay < m_leastDelay[direction]))
+	{
+		m_leastDelay[direction] = delay;
+	}
+
+	bool lost = (delay > (m_leastDelay[direction] + retransmit));
+
+	if(lost)
+	{
+		delay -= retransmit;
+	}
+
+	samples.push_back(TraceSample((time - m_startTime), delay, lost));
+}
+
+// ===== Save =====================================================================================
+// Method will write the trace to a text file.
+//
+// Input:
+//	[IN] const std::string &path	- the file to write
+//
+// Output:
+//	[OUT] bool						- true if the file was written, false otherwise
+// ================================================================================================
+bool NetworkTrace::Save(const std::string &path) const
+{
+	std::ofstream file(path.c_str());
+
+	if(!file)
+	{
+		return false;
+	}
+
+	file << "# NetworkedPong network trace\n";
+	file << "# direction time_us delay_us lost\n";
+
+	for(unsigned int i = 0; i < up.size(); i++)
+	{
+		file << "up " << up[i].time << " " << up[i].delay << " " << (up[i].lost ? 1 : 0) << "\n";
+	}
+
+	for(unsigned int i = 0; i < down.size(); i++)
+	{
+		file << "down " << down[i].time << " " << down[i].delay << " " << (down[i].lost ? 1 : 0) << "\n";
+	}
+
+	return (bool)file;
+}
+
+// ===== Load =====================================================================================
+// Method will read a trace from a text file, replacing the samples held. Each direction is sorted
+// by time, in case the file was put together by hand.
+//
+// Input:
+//	[IN] const std::string &path	- the file to read
+//
+// Output:
+//	[OUT] bool						- true if the file was read and held at least one sample
+// ================================================================================================
+bool NetworkTrace::Load(const std::string &path)
+{
+	std::ifstream file(path.c_str());
+	std::string line;
+
+	if(!file)
+	{
+		return false;
+	}
+
+	up.clear();
+	down.clear();
+
+	while(std::getline(file, line))
+	{
+		std::istringstream fields(line);
+		std::string direction;
+		TraceSample sample;
+		int lost = 0;
+
+		if(line.empty() || (line[0] == '#'))
+		{
+			continue;
+		}
+
+		if(!(fields >> direction >> sample.time >> sample.delay >> lost))
+		{
+			continue;	// Not a sample, skip it
+		}
+
+		sample.lost = (lost != 0);
+
+		if(direction == "up")
+		{
+			up.push_back(sample);
+		}
+		else if(direction == "down")
+		{
+			down.push_back(sample);
+		}
+	}
+
+	std::stable_sort(up.begin(), up.end(), [](const TraceSample &a, const TraceSample &b){ return (a.time < b.time); });
+	std::stable_sort(down.begin(), down.end(), [](const TraceSample &a, const TraceSample &b){ return (a.time < b.time); });
+
+	return !IsEmpty();
+}
+
+// ===== Lookup ===================================================================================
+// Method will find the sample in effect at a time since the start of replay: the last sample taken
+// at or before that time. Past the end of the trace, replay loops back to the start.
+//
+// Input:
+//	[IN] const std::vector<TraceSample> &samples	- one direction of a trace, not empty
+//	[IN] NetTime elapsed							- time since replay started
+//
+// Output:
+//	[OUT] const TraceSample&						- the sample in effect
+// ================================================================================================
+const TraceSample& NetworkTrace::Lookup(const std::vector<TraceSample> &samples, NetTime elapsed)
+{
+	NetTime length = (samples.back().time + 1);
+
+	if(elapsed < 0)
+	{
+		elapsed = 0;
+	}
+
+	elapsed %= length;
+
+	std::vector<TraceSample>::const_iterator next = std::upper_bound(samples.begin(), samples.end(), elapsed,
+		[](NetTime time, const TraceSample &sample){ return (time < sample.time); });
+
+	if(next == samples.begin())
+	{
+		return samples.front();		// Before the first sample
+	}
+
+	next--;
+
+	return *next;
+}
@@ -0,0 +1,108 @@
+// ================================================================================================
+// Filename: "NetworkTrace.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// A NetworkTrace is a record of how a real connection treated each packet: when it was sent, how
+// long it took to arrive, and whether it was lost on the way. The server records one per client
+// when started with -record-trace, and any build can replay it with -net-trace, so a change to
+// interpolation or prediction can be checked against the same real-world network, offline and as
+// often as needed.
+//
+// The trace holds a list of TraceSamples for each direction, up (client to server) and down
+// (server to client). A sample's time is how long after the first sample it was taken. Replay
+// looks up the sample in effect at the time since the connection started, and loops back to the
+// start once the end of the trace is reached.
+//
+// The connections the game runs over are reliable, so a loss shows up as a packet arriving about a
+// retransmission timeout later than the link's usual delay. Record() keeps the least delay seen in
+// each direction, and marks a sample that arrives more than EmulatedTransport::RETRANSMIT_TIMEOUT
+// later than that as lost, storing the delay without the retransmission. Replay adds it back, so a
+// trace captured from some other tool can mark its' losses the same way.
+//
+// Traces are saved as text, one sample per line:
+//	<up|down> <time in us> <delay in us> <lost, 0 or 1>
+// Lines starting with '#' are comments.
+//
+// To increase simplicity, the TraceSample and NetworkTrace classes make their data members public.
+// ================================================================================================
+
+#ifndef NETWORKTRACE_H
+#define NETWORKTRACE_H
+
+#include <string>
+#include <vector>
+#include <SFML\Network\Packet.hpp>
+#include "NetTime.h"
+
+// ================================================================================================
+// TraceSample - how one packet crossed the link
+// ================================================================================================
+class TraceSample
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	TraceSample(void);
+	TraceSample(NetTime time, NetTime delay, bool lost);
+	~TraceSample(void){}
+
+	NetTime time;		// Time since the first sample of the trace
+	NetTime delay;		// Time the packet took to cross the link, not counting a retransmission
+	bool lost;			// True if the packet had to be retransmitted
+};
+
+// Packet Overloads for TraceSample
+sf::Packet& operator<<(sf::Packet& packet, TraceSample& sample);
+sf::Packet& operator>>(sf::Packet& packet, TraceSample& sample);
+
+// ================================================================================================
+// NetworkTrace
+// ================================================================================================
+class NetworkTrace
+{
+
+public:
+
+	// Directions
+	enum Direction {UP, DOWN};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	NetworkTrace(void);
+	~NetworkTrace(void){}
+
+	// Method Prototypes
+	void Record(Direction direction, NetTime time, NetTime delay);
+	bool Save(const std::string &path) const;
+	bool Load(const std::string &path);
+
+	// Static Methods
+	static const TraceSample& Lookup(const std::vector<TraceSample> &samples, NetTime elapsed);
+
+	// Inlined Methods
+	bool IsEmpty(void) const { return (up.empty() && down.empty()); }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	std::vector<TraceSample> up;		// Client to server, in time order
+	std::vector<TraceSample> down;		// Server to client, in time order
+
+private:
+
+	// Recording Data
+	bool m_started;
+	NetTime m_startTime;				// Time of the first sample recorded
+	NetTime m_leastDelay[2];			// Least delay seen in each direction
+};
+
+#endif
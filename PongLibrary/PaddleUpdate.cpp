@@ -19,6 +19,7 @@
 //  ===============================================================================================
 PaddleUpdate::PaddleUpdate(void)
 {
+	m_sequence = 0;
 	m_paddleLoc = 0;
 	m_paddleDir = Paddle::STILL;
 	m_timestamp = 0;
@@ -32,6 +33,7 @@ PaddleUpdate::PaddleUpdate(void)
 //  ===============================================================================================
 PaddleUpdate::PaddleUpdate(const PaddleUpdate &original)
 {
+	m_sequence = original.m_sequence;
 	m_paddleLoc = original.m_paddleLoc;
 	m_paddleDir = original.m_paddleDir;
 	m_timestamp = original.m_timestamp;
@@ -50,7 +52,9 @@ PaddleUpdate::PaddleUpdate(const PaddleUpdate &original)
 // ================================================================================================
 sf::Packet& operator<<(sf::Packet& packet, PaddleUpdate& update)
 {
-	packet	<< update.m_paddleLoc << update.m_paddleDir << update.m_timestamp;
+	packet	<< update.m_sequence << update.m_paddleLoc << update.m_paddleDir;
+
+	TimeBase::WriteCompact(packet, update.m_timestamp);
 
 	return packet;
 }
@@ -68,7 +72,9 @@ sf::Packet& operator<<(sf::Packet& packet, PaddleUpdate& update)
 // ================================================================================================
 sf::Packet& operator>>(sf::Packet& packet, PaddleUpdate& update)
 {
-	packet	>> update.m_paddleLoc >> update.m_paddleDir >> update.m_timestamp;
+	packet	>> update.m_sequence >> update.m_paddleLoc >> update.m_paddleDir;
+
+	TimeBase::ReadCompact(packet, update.m_timestamp);
 
 	return packet;
 }
\ No newline at end of file
@@ -7,12 +7,20 @@
 // Class Description:
 // 
 // This class is used to package the data needed for paddle updates that are sent to the server.
+// The timestamp is on the client's clock and is sent compact; the server expands it against the
+// client's last sync point.
+//
+// Each update is one engine cycle of input. The sequence counts up by one per update, and the
+// server applies the direction itself and reports back the last sequence it applied, so the client
+// can replay the inputs the server hasn't seen yet. The location is the client's predicted
+// position, for reference only.
 // ================================================================================================
 
 #ifndef PADDLEUPDATE_H
 #define PADDLEUPDATE_H
 
 #include <SFML\Network\Packet.hpp>
+#include "NetTime.h"
 
 class PaddleUpdate
 {
@@ -24,9 +32,10 @@ public:
 	PaddleUpdate(const PaddleUpdate &original);
 
 	// Data Members
+	sf::Uint32 m_sequence;
 	float m_paddleLoc;
 	int m_paddleDir;
-	int m_timestamp;
+	NetTime m_timestamp;
 };
 
 // Packet Overloads for GameData
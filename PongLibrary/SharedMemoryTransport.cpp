@@ -0,0 +1,628 @@
+// ================================================================================================
+// Filename: "SharedMemoryTransport.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the SharedMemoryTransport and SharedMemoryListener
+// classes. For a class description see the header file "SharedMemoryTransport.h"
+// ================================================================================================
+
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include <Windows.h>
+#include <SFML\System\Clock.hpp>
+#include "SharedMemoryTransport.h"
+
+// Segment Layout Sizes; these must be known at compile time to lay out the segment
+static const int SHM_MAX_SLOTS = 16;
+static const unsigned int SHM_RING_BYTES = 65536;
+
+// Slot States, in the low bits of a slot's state word under its' generation
+enum SlotState {SLOT_FREE, SLOT_CLAIMED, SLOT_ACTIVE, SLOT_CLOSED, SLOT_LEFT};
+static const int SLOT_STATE_BITS = 3;
+static const LONG SLOT_STATE_MASK = ((1 << SLOT_STATE_BITS) - 1);
+static const LONG SLOT_GENERATION_MASK = (0x7FFFFFFF >> (SLOT_STATE_BITS - 1));
+
+// ================================================================================================
+// Segment Layout - everything below lives in the shared memory itself
+// ================================================================================================
+struct SharedMemoryRing
+{
+	volatile LONG head;				// Bytes read so far, only moved by the reader
+	volatile LONG tail;				// Bytes written so far, only moved by the writer
+	volatile LONG readerWaiting;	// Set while the reader is asleep on its event
+	char data[SHM_RING_BYTES];
+};
+
+struct SharedMemorySlot
+{
+	volatile LONG state;
+	SharedMemoryRing toServer;
+	SharedMemoryRing toClient;
+};
+
+struct SharedMemorySegment
+{
+	volatile LONG listening;
+	SharedMemorySlot slots[SHM_MAX_SLOTS];
+};
+
+// Initialize Static Constants
+const int SharedMemoryTransport::MAX_SLOTS = SHM_MAX_SLOTS;
+const unsigned int SharedMemoryTransport::RING_BYTES = SHM_RING_BYTES;
+const int SharedMemoryTransport::WAIT_TIMEOUT_MS = 50;
+
+// ===== SlotWord =================================================================================
+// Builds a slot's state word from a state and a generation.
+// ================================================================================================
+static LONG SlotWord(LONG state, LONG generation)
+{
+	return (LONG)(((unsigned long)generation << SLOT_STATE_BITS) | (unsigned long)state);
+}
+
+// ===== SlotGeneration ===========================================================================
+// Takes the generation out of a slot's state word.
+// ================================================================================================
+static LONG SlotGeneration(LONG word)
+{
+	return (LONG)((unsigned long)word >> SLOT_STATE_BITS);
+}
+
+// ===== ResetSlot ================================================================================
+// Empties both of a slot's rings, then returns it to the free list, keeping its' generation. Only
+// the last end to leave the slot calls this.
+// ================================================================================================
+static void ResetSlot(SharedMemorySlot *slotData, LONG generation)
+{
+	slotData->toServer.head = slotData->toServer.tail = 0;
+	slotData->toClient.head = slotData->toClient.tail = 0;
+	slotData->toServer.readerWaiting = slotData->toClient.readerWaiting = 0;
+	MemoryBarrier();
+	InterlockedExchange(&slotData->state, SlotWord(SLOT_FREE, generation));
+}
+
+// ===== RingCopyIn ===============================================================================
+// Copies bytes into a ring starting at a running byte offset, wrapping at the end of the buffer.
+// ================================================================================================
+static void RingCopyIn(SharedMemoryRing *ring, LONG offset, const void *source, unsigned int size)
+{
+	const char *bytes = (const char*)source;
+	unsigned int start = ((unsigned int)offset & (SHM_RING_BYTES - 1));
+	unsigned int firstPart = ((size < (SHM_RING_BYTES - start)) ? size : (SHM_RING_BYTES - start));
+
+	memcpy(&ring->data[start], bytes, firstPart);
+	memcpy(&ring->data[0], (bytes + firstPart), (size - firstPart));
+}
+
+// ===== RingCopyOut ==============================================================================
+// Copies bytes out of a ring starting at a running byte offset, wrapping at the end of the buffer.
+// ================================================================================================
+static void RingCopyOut(SharedMemoryRing *ring, LONG offset, void *destination, unsigned int size)
+{
+	char *bytes = (char*)destination;
+	unsigned int start = ((unsigned int)offset & (SHM_RING_BYTES - 1));
+	unsigned int firstPart = ((size < (SHM_RING_BYTES - start)) ? size : (SHM_RING_BYTES - start));
+
+	memcpy(bytes, &ring->data[start], firstPart);
+	memcpy((bytes + firstPart), &ring->data[0], (size - firstPart));
+}
+
+// ===== SegmentName ==============================================================================
+// Method will build the name of the segment that a server on the passed port listens on.
+// ================================================================================================
+std::string SharedMemoryTransport::SegmentName(int portNumber)
+{
+	std::stringstream name;
+	name << "Local\\PongShm_" << portNumber;
+
+	return name.str();
+}
+
+// ===== EventName ================================================================================
+// Method will build the name of the event signalled when a ring in the passed slot is written.
+// ================================================================================================
+std::string SharedMemoryTransport::EventName(int portNumber, int slot, bool toServer)
+{
+	std::stringstream name;
+	name << SegmentName(portNumber) << "_" << slot << (toServer ? "_s" : "_c");
+
+	return name.str();
+}
+
+// ===== Constructor ==============================================================================
+// The constructor will map its' own view of the segment, so the listener can be closed without
+// pulling the memory out from under live connections, and open the events for its' slot.
+//
+// Input:
+//	[IN] int portNumber	- the port the server is listening on
+//	[IN] int slot		- the slot in the segment this connection uses
+//	[IN] long generation	- the slot's generation, from when the client claimed it
+//	[IN] bool serverEnd	- true for the server end of the slot, false for the client end
+//
+// Output: none
+// ================================================================================================
+SharedMemoryTransport::SharedMemoryTransport(int portNumber, int slot, long generation, bool serverEnd)
+{
+	m_slot = slot;
+	m_generation = generation;
+	m_serverEnd = serverEnd;
+	m_disconnected = false;
+	m_segment = NULL;
+	m_outRing = NULL;
+	m_inRing = NULL;
+
+	m_mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, SegmentName(portNumber).c_str());
+
+	if(m_mapping != NULL)
+	{
+		m_segment = (SharedMemorySegment*)MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedMemorySegment));
+	}
+
+	if(m_segment != NULL)
+	{
+		SharedMemorySlot *slotData = &m_segment->slots[m_slot];
+
+		m_outRing = (m_serverEnd ? &slotData->toClient : &slotData->toServer);
+		m_inRing = (m_serverEnd ? &slotData->toServer : &slotData->toClient);
+	}
+
+	m_outEvent = CreateEventA(NULL, FALSE, FALSE, EventName(portNumber, slot, !m_serverEnd).c_str());
+	m_inEvent = CreateEventA(NULL, FALSE, FALSE, EventName(portNumber, slot, m_serverEnd).c_str());
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will close the slot and leave it; the last end to leave returns the slot to the
+// free list so another client can claim it.
+// ================================================================================================
+SharedMemoryTransport::~SharedMemoryTransport(void)
+{
+	if(m_segment != NULL)
+	{
+		Disconnect();
+		Leave();
+
+		UnmapViewOfFile(m_segment);
+	}
+
+	if(m_mapping != NULL)
+	{
+		CloseHandle(m_mapping);
+	}
+
+	CloseHandle(m_outEvent);
+	CloseHandle(m_inEvent);
+}
+
+// ===== Connect ==================================================================================
+// Method will claim a free slot in the segment of the server listening on the passed port, then
+// wake the server's listener so it accepts the slot.
+//
+// Input:
+//	[IN] int portNumber				- the port the server is listening on
+//
+// Output:
+//	[OUT] SharedMemoryTransport*	- the client end of the slot, or NULL if there is no local
+//									  server or every slot is taken
+// ================================================================================================
+SharedMemoryTransport* SharedMemoryTransport::Connect(int portNumber)
+{
+	HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, SegmentName(portNumber).c_str());
+
+	if(mapping == NULL)
+	{
+		return NULL;	// No server on this machine
+	}
+
+	SharedMemorySegment *segment = (SharedMemorySegment*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedMemorySegment));
+	SharedMemoryTransport *transport = NULL;
+
+	if((segment != NULL) && (segment->listening != 0))
+	{
+		for(int slot = 0; slot < SHM_MAX_SLOTS; slot++)
+		{
+			LONG word = segment->slots[slot].state;
+
+			if((word & SLOT_STATE_MASK) != SLOT_FREE)
+			{
+				continue;
+			}
+
+			LONG generation = ((SlotGeneration(word) + 1) & SLOT_GENERATION_MASK);
+
+			if(InterlockedCompareExchange(&segment->slots[slot].state, SlotWord(SLOT_CLAIMED, generation), word) == word)
+			{
+				transport = new SharedMemoryTransport(portNumber, slot, generation, false);
+
+				// Wake the listener
+				HANDLE acceptEvent = CreateEventA(NULL, FALSE, FALSE, (SegmentName(portNumber) + "_accept").c_str());
+				SetEvent(acceptEvent);
+				CloseHandle(acceptEvent);
+				break;
+			}
+		}
+	}
+
+	if(segment != NULL)
+	{
+		UnmapViewOfFile(segment);
+	}
+
+	CloseHandle(mapping);
+
+	return transport;
+}
+
+// ===== IsOpen ===================================================================================
+// Method will check if the slot is still in use by both ends, in this end's generation. A claimed
+// slot counts as open so the client can wait for the server to accept it.
+// ================================================================================================
+bool SharedMemoryTransport::IsOpen(void)
+{
+	LONG word = m_segment->slots[m_slot].state;
+
+	if(m_disconnected)
+	{
+		return false;
+	}
+
+	return ((word == SlotWord(SLOT_CLAIMED, m_generation)) || (word == SlotWord(SLOT_ACTIVE, m_generation)));
+}
+
+// ===== Leave ====================================================================================
+// Method will give up this end's hold on the slot. An end that leaves first marks the slot as left
+// for the other end. The last end to leave, or a client leaving a slot the server never accepted,
+// empties the rings and frees the slot. A slot already in another generation is left alone.
+// ================================================================================================
+void SharedMemoryTransport::Leave(void)
+{
+	SharedMemorySlot *slotData = &m_segment->slots[m_slot];
+
+	while(true)
+	{
+		LONG word = slotData->state;
+
+		if(SlotGeneration(word) != m_generation)
+		{
+			return;
+		}
+
+		LONG state = (word & SLOT_STATE_MASK);
+
+		if(state == SLOT_LEFT)
+		{
+			ResetSlot(slotData, m_generation);		// The other end has already left
+			return;
+		}
+
+		if((state == SLOT_CLAIMED) || (state == SLOT_ACTIVE) || (state == SLOT_CLOSED))
+		{
+			if(InterlockedCompareExchange(&slotData->state, SlotWord(SLOT_LEFT, m_generation), word) == word)
+			{
+				if(state == SLOT_CLAIMED)
+				{
+					ResetSlot(slotData, m_generation);		// Never accepted, so no other end
+				}
+
+				return;
+			}
+
+			continue;
+		}
+
+		return;		// Already free
+	}
+}
+
+// ===== Send =====================================================================================
+// Method will copy the packet into the outgoing ring as a length followed by the packet bytes,
+// waiting for room if the ring is full. The other end's event is only signalled if it is asleep.
+//
+// Input:
+//	[IN] sf::Packet &packet		- the packet to send
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done, Disconnected if the slot was closed, or Error if the packet
+//								  can never fit in the ring
+// ================================================================================================
+sf::Socket::Status SharedMemoryTransport::Send(sf::Packet &packet)
+{
+	if(m_segment == NULL)
+	{
+		return sf::Socket::Disconnected;
+	}
+
+	sf::Uint32 size = (sf::Uint32)packet.getDataSize();
+	unsigned int needed = (sizeof(size) + size);
+
+	if(needed >= SHM_RING_BYTES)
+	{
+		return sf::Socket::Error;
+	}
+
+	// Wait for room
+	while((SHM_RING_BYTES - (unsigned int)(m_outRing->tail - m_outRing->head)) < needed)
+	{
+		if(!IsOpen())
+		{
+			return sf::Socket::Disconnected;
+		}
+
+		Sleep(0);
+	}
+
+	if(!IsOpen())
+	{
+		return sf::Socket::Disconnected;
+	}
+
+	// Write, then publish the new tail
+	LONG tail = m_outRing->tail;
+	RingCopyIn(m_outRing, tail, &size, sizeof(size));
+	RingCopyIn(m_outRing, (tail + sizeof(size)), packet.getData(), size);
+
+	MemoryBarrier();
+	InterlockedExchangeAdd(&m_outRing->tail, (LONG)needed);
+
+	if(m_outRing->readerWaiting != 0)
+	{
+		SetEvent(m_outEvent);
+	}
+
+	return sf::Socket::Done;
+}
+
+// ===== Receive ==================================================================================
+// Method will wait until a packet is available in the incoming ring. Packets already in the ring
+// are still delivered after the slot closes. The other process can write anything into the ring,
+// so a packet size that doesn't fit in what has been written is an error, and nothing is read.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//	[IN] sf::Time timeout		- the longest to wait, sf::Time::Zero to wait forever
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done, NotReady on timeout, Disconnected if the slot was closed, or
+//								  Error if the ring holds an impossible packet size
+// ================================================================================================
+sf::Socket::Status SharedMemoryTransport::Receive(sf::Packet &packet, sf::Time timeout)
+{
+	sf::Clock waitClock;
+
+	if(m_segment == NULL)
+	{
+		return sf::Socket::Disconnected;
+	}
+
+	while(true)
+	{
+		LONG head = m_inRing->head;
+		LONG tail = m_inRing->tail;
+
+		if(tail != head)
+		{
+			MemoryBarrier();
+
+			unsigned int written = (unsigned int)(tail - head);
+			sf::Uint32 size;
+
+			if((written < sizeof(size)) || (written > SHM_RING_BYTES))
+			{
+				return sf::Socket::Error;
+			}
+
+			RingCopyOut(m_inRing, head, &size, sizeof(size));
+
+			if(size > (written - sizeof(size)))
+			{
+				return sf::Socket::Error;
+			}
+
+			std::vector<char> buffer(size);
+
+			if(size > 0)
+			{
+				RingCopyOut(m_inRing, (head + sizeof(size)), &buffer[0], size);
+			}
+
+			MemoryBarrier();
+			InterlockedExchangeAdd(&m_inRing->head, (LONG)(sizeof(size) + size));
+
+			packet.clear();
+
+			if(size > 0)
+			{
+				packet.append(&buffer[0], size);
+			}
+
+			return sf::Socket::Done;
+		}
+
+		if(!IsOpen())
+		{
+			return sf::Socket::Disconnected;
+		}
+
+		DWORD waitTime = WAIT_TIMEOUT_MS;
+
+		if(timeout != sf::Time::Zero)
+		{
+			sf::Int32 remaining = (timeout - waitClock.getElapsedTime()).asMilliseconds();
+
+			if(remaining <= 0)
+			{
+				return sf::Socket::NotReady;
+			}
+
+			if((DWORD)remaining < waitTime)
+			{
+				waitTime = (DWORD)remaining;
+			}
+		}
+
+		// Sleep until the writer signals, re-checking after raising the flag so a write
+		// that raced the flag isn't missed
+		InterlockedExchange(&m_inRing->readerWaiting, 1);
+
+		if(m_inRing->tail == head)
+		{
+			WaitForSingleObject(m_inEvent, waitTime);
+		}
+
+		InterlockedExchange(&m_inRing->readerWaiting, 0);
+	}
+}
+
+// ===== Disconnect ===============================================================================
+// Method will close the slot for both ends and wake anything asleep on it. Only an active slot in
+// this end's generation is closed; a client that disconnects before the server accepts it only
+// stops using the slot, until it leaves.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void SharedMemoryTransport::Disconnect(void)
+{
+	if(m_segment != NULL)
+	{
+		InterlockedCompareExchange(&m_segment->slots[m_slot].state, SlotWord(SLOT_CLOSED, m_generation),
+								   SlotWord(SLOT_ACTIVE, m_generation));
+
+		m_disconnected = true;
+	}
+
+	SetEvent(m_outEvent);
+	SetEvent(m_inEvent);
+}
+
+// ===== Listener Constructor =====================================================================
+// The constructor will zero all members; the segment is created by Listen().
+//
+// Input: none
+// Output: none
+// ================================================================================================
+SharedMemoryListener::SharedMemoryListener(void)
+{
+	m_mapping = NULL;
+	m_segment = NULL;
+	m_acceptEvent = NULL;
+	m_portNumber = 0;
+	m_listening = false;
+}
+
+// ===== Listener Destructor ======================================================================
+// The destructor will ensure all handles are released. Connections already accepted keep their own
+// view of the segment.
+// ================================================================================================
+SharedMemoryListener::~SharedMemoryListener(void)
+{
+	Close();
+
+	if(m_segment != NULL)
+	{
+		UnmapViewOfFile(m_segment);
+	}
+
+	if(m_mapping != NULL)
+	{
+		CloseHandle(m_mapping);
+	}
+
+	if(m_acceptEvent != NULL)
+	{
+		CloseHandle(m_acceptEvent);
+	}
+}
+
+// ===== Listen ===================================================================================
+// Method will create the segment for the passed port and mark it as accepting clients.
+//
+// Input:
+//	[IN] int portNumber	- the port number the segment is named after
+//
+// Output:
+//	[OUT] bool			- true if the segment was created, false if it failed or another server
+//						  on this machine already owns it
+// ================================================================================================
+bool SharedMemoryListener::Listen(int portNumber)
+{
+	m_portNumber = portNumber;
+
+	m_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, sizeof(SharedMemorySegment),
+								   SharedMemoryTransport::SegmentName(portNumber).c_str());
+
+	if((m_mapping == NULL) || (GetLastError() == ERROR_ALREADY_EXISTS))
+	{
+		return false;
+	}
+
+	m_segment = (SharedMemorySegment*)MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedMemorySegment));
+
+	if(m_segment == NULL)
+	{
+		return false;
+	}
+
+	m_acceptEvent = CreateEventA(NULL, FALSE, FALSE, (SharedMemoryTransport::SegmentName(portNumber) + "_accept").c_str());
+
+	m_listening = true;
+	InterlockedExchange(&m_segment->listening, 1);
+
+	return true;
+}
+
+// ===== Accept ===================================================================================
+// Method will block until a client claims a slot, then create the server end of that slot.
+//
+// Input: none
+//
+// Output:
+//	[OUT] SharedMemoryTransport*	- the server end of the claimed slot, or NULL if the listener
+//									  was closed
+// ================================================================================================
+SharedMemoryTransport* SharedMemoryListener::Accept(void)
+{
+	while(m_listening)
+	{
+		for(int slot = 0; slot < SHM_MAX_SLOTS; slot++)
+		{
+			LONG word = m_segment->slots[slot].state;
+
+			if((word & SLOT_STATE_MASK) != SLOT_CLAIMED)
+			{
+				continue;
+			}
+
+			if(InterlockedCompareExchange(&m_segment->slots[slot].state, SlotWord(SLOT_ACTIVE, SlotGeneration(word)), word) == word)
+			{
+				return new SharedMemoryTransport(m_portNumber, slot, SlotGeneration(word), true);
+			}
+		}
+
+		WaitForSingleObject(m_acceptEvent, SharedMemoryTransport::WAIT_TIMEOUT_MS);
+	}
+
+	return NULL;
+}
+
+// ===== Close ====================================================================================
+// Method will stop accepting clients and wake a blocked Accept().
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void SharedMemoryListener::Close(void)
+{
+	m_listening = false;
+
+	if(m_segment != NULL)
+	{
+		InterlockedExchange(&m_segment->listening, 0);
+	}
+
+	if(m_acceptEvent != NULL)
+	{
+		SetEvent(m_acceptEvent);
+	}
+}
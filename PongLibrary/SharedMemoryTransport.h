@@ -0,0 +1,132 @@
+// ================================================================================================
+// Filename: "SharedMemoryTransport.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The SharedMemoryTransport class connects a client and a server that run on the same machine
+// through a named shared memory segment, so practice bots don't pay for a TCP loopback connection.
+// Packets are copied straight into a ring in the segment by the sender and out of it by the
+// receiver; the kernel is only involved to wake a receiver that has gone to sleep.
+//
+// The server creates the segment with a SharedMemoryListener. The segment holds MAX_SLOTS
+// connection slots, each with one ring per direction. A client claims a free slot with
+// SharedMemoryTransport::Connect() and signals the listener, which hands the server end of the
+// slot to the SNetworkController like any other accepted connection. The protocol on top is the
+// same as over TCP, so a bot can use either transport.
+//
+// Each ring is single-producer/single-consumer: the outgoing thread on one end only moves the tail
+// and the listening thread on the other end only moves the head. A reader that finds its ring
+// empty raises a waiting flag and sleeps on a named event; the writer only signals the event when
+// that flag is up.
+//
+// A slot's state word carries a generation, counted up each time the slot is claimed, and each end
+// keeps the generation it joined. Every change to the state is a compare-and-swap from a state of
+// that generation, so an end that is late to close or leave can never touch a connection that has
+// since claimed the slot. Disconnect() closes an active slot for both ends. Each end leaves the
+// slot when it is destroyed, and whichever end leaves last empties the rings and frees the slot;
+// a client that leaves before the server accepts it frees the slot itself.
+//
+// Windows handles are stored as void* so that <Windows.h> stays out of this header.
+// ================================================================================================
+
+#ifndef SHAREDMEMORYTRANSPORT_H
+#define SHAREDMEMORYTRANSPORT_H
+
+#include <string>
+#include "Transport.h"
+
+struct SharedMemorySegment;
+struct SharedMemoryRing;
+
+// ================================================================================================
+// SharedMemoryTransport
+// ================================================================================================
+class SharedMemoryTransport: public Transport
+{
+
+public:
+
+	// The listener creates the server ends of claimed slots
+	friend class SharedMemoryListener;
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Destructor
+	~SharedMemoryTransport(void);
+
+	// Static Factory
+	static SharedMemoryTransport* Connect(int portNumber);
+
+	// Transport Prototypes
+	sf::Socket::Status Send(sf::Packet &packet);
+	sf::Socket::Status Receive(sf::Packet &packet, sf::Time timeout);
+	void Disconnect(void);
+	sf::IpAddress GetRemoteAddress(void){ return sf::IpAddress::LocalHost; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int MAX_SLOTS;				// Connections a single segment can carry
+	static const unsigned int RING_BYTES;	// Size of each ring, must be a power of two
+	static const int WAIT_TIMEOUT_MS;		// Longest a reader sleeps before re-checking the slot
+
+private:
+
+	// Private Constructor, use Connect() or SharedMemoryListener::Accept()
+	SharedMemoryTransport(int portNumber, int slot, long generation, bool serverEnd);
+
+	static std::string SegmentName(int portNumber);
+	static std::string EventName(int portNumber, int slot, bool toServer);
+
+	bool IsOpen(void);
+	void Leave(void);
+
+	// Segment Data
+	void *m_mapping;
+	SharedMemorySegment *m_segment;
+	int m_slot;
+	long m_generation;		// The slot's generation when this end joined it
+	bool m_serverEnd;
+	bool m_disconnected;	// Disconnect() was called on this end
+
+	// Ring Data
+	SharedMemoryRing *m_outRing;
+	SharedMemoryRing *m_inRing;
+	void *m_outEvent;		// Signalled when this end writes
+	void *m_inEvent;		// Signalled when the other end writes
+};
+
+// ================================================================================================
+// SharedMemoryListener - creates the segment and accepts clients that claim a slot in it
+// ================================================================================================
+class SharedMemoryListener
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	SharedMemoryListener(void);
+	~SharedMemoryListener(void);
+
+	// Method Prototypes
+	bool Listen(int portNumber);
+	SharedMemoryTransport* Accept(void);		// Blocking
+	void Close(void);
+
+private:
+
+	void *m_mapping;
+	SharedMemorySegment *m_segment;
+	void *m_acceptEvent;
+	int m_portNumber;
+	bool m_listening;
+};
+
+#endif
@@ -0,0 +1,277 @@
+// ================================================================================================
+// Filename: "SimState.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the SimState class. For a class description see the
+// header file "SimState.h"
+// ================================================================================================
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <type_traits>
+#include <SFML\Graphics\Rect.hpp>
+#include "SimState.h"
+#include "Ball.h"
+#include "Paddle.h"
+#include "Calculator.h"
+
+static_assert(std::is_trivially_copyable<SimState>::value, "SimState must stay trivially copyable");
+
+// ===== FromGameData =============================================================================
+// Method will take the simulated part of a GameData.
+//
+// Input:
+//	[IN] const GameData &gameData	- the snapshot to start from
+//
+// Output:
+//	[OUT] SimState state			- the snapshot's state
+// ================================================================================================
+SimState SimState::FromGameData(const GameData &gameData)
+{
+	SimState state;
+
+	state.serverTick = gameData.serverTick;
+	state.playerOnePaddlePosition = gameData.playerOnePaddlePosition;
+	state.playerTwoPaddlePosition = gameData.playerTwoPaddlePosition;
+	state.playerOneHealth = gameData.playerOneHealth;
+	state.playerTwoHealth = gameData.playerTwoHealth;
+	state.playerOneScore = gameData.playerOneScore;
+	state.playerTwoScore = gameData.playerTwoScore;
+	state.ballX = gameData.ballX;
+	state.ballY = gameData.ballY;
+	state.ballAngle = gameData.ballAngle;
+
+	return state;
+}
+
+// ===== ApplyPositions ===========================================================================
+// Method will copy the ball and paddle positions, and the ball angle, into a GameData. Scores and
+// health are left alone, so the ones shown are always the server's.
+//
+// Input:
+//	[IN/OUT] GameData &gameData	- the GameData to update
+//
+// Output: none
+// ================================================================================================
+void SimState::ApplyPositions(GameData &gameData) const
+{
+	gameData.playerOnePaddlePosition = playerOnePaddlePosition;
+	gameData.playerTwoPaddlePosition = playerTwoPaddlePosition;
+	gameData.ballX = ballX;
+	gameData.ballY = ballY;
+	gameData.ballAngle = ballAngle;
+}
+
+// ===== Step =====================================================================================
+// Method will advance the state one server tick.
+//
+// Input:
+//	[IN] int playerOneDirection	- player one's paddle direction, one of the Paddle::Direction values
+//	[IN] int playerTwoDirection	- player two's paddle direction
+//
+// Output: none
+// ================================================================================================
+void SimState::Step(int playerOneDirection, int playerTwoDirection)
+{
+	MovePaddle(playerOnePaddlePosition, playerOneDirection);
+	MovePaddle(playerTwoPaddlePosition, playerTwoDirection);
+
+	MoveBall();
+	CheckPaddleCollisions();
+
+	// Check for Scores
+	if(ballX <= GameData::LEFT_GOAL_LINE)
+	{
+		playerTwoScore++;
+		Serve(2);
+	}
+	else if(ballX >= GameData::RIGHT_GOAL_LINE)
+	{
+		playerOneScore++;
+		Serve(1);
+	}
+
+	serverTick++;
+}
+
+// ===== Matches ==================================================================================
+// Method will check if two states agree: the same scores and health, and positions within the
+// tolerance.
+//
+// Input:
+//	[IN] const SimState &other	- the state to compare with
+//	[IN] float tolerance		- the largest difference in any position, in pixels, that still agrees
+//
+// Output:
+//	[OUT] bool					- true if the states agree, false otherwise
+// ================================================================================================
+bool SimState::Matches(const SimState &other, float tolerance) const
+{
+	if((playerOneScore != other.playerOneScore) || (playerTwoScore != other.playerTwoScore) ||
+	   (playerOneHealth != other.playerOneHealth) || (playerTwoHealth != other.playerTwoHealth))
+	{
+		return false;
+	}
+
+	return ((fabs(playerOnePaddlePosition - other.playerOnePaddlePosition) <= tolerance) &&
+			(fabs(playerTwoPaddlePosition - other.playerTwoPaddlePosition) <= tolerance) &&
+			(fabs(ballX - other.ballX) <= tolerance) && (fabs(ballY - other.ballY) <= tolerance));
+}
+
+// ===== MovePaddle ===============================================================================
+// Method will move a paddle one tick, stopping at the edges of the board as Paddle::MoveUp() and
+// Paddle::MoveDown() do.
+//
+// Input:
+//	[IN/OUT] float &position	- the paddle's y-coordinate
+//	[IN] int direction			- one of the Paddle::Direction values
+//
+// Output: none
+// ================================================================================================
+void SimState::MovePaddle(float &position, int direction)
+{
+	if((direction == Paddle::UP) && ((position - (Paddle::HEIGHT / 2)) > Paddle::BASE_MOVE_RATE))
+	{
+		position -= Paddle::BASE_MOVE_RATE;
+	}
+	else if((direction == Paddle::DOWN) && ((position + (Paddle::HEIGHT / 2)) < (GameData::BOARD_HEIGHT - Paddle::BASE_MOVE_RATE)))
+	{
+		position += Paddle::BASE_MOVE_RATE;
+	}
+}
+
+// ===== MoveBall =================================================================================
+// Method will move the ball one tick along its' angle, bouncing off at most one wall, as
+// Ball::Move() does. A bounce off the top or bottom mirrors the angle about the x-axis, and one off
+// a side mirrors it about the y-axis.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void SimState::MoveBall(void)
+{
+	float newX = (ballX + (float)(Ball::BASE_MOVE_RATE * cos(ballAngle)));
+	float newY = (ballY + ((-1) * (float)(Ball::BASE_MOVE_RATE * sin(ballAngle))));	// y-plane grows downward
+
+	if((newY - Ball::RADIUS) <= 0)	// Top Collision
+	{
+		ballAngle = ((2 * M_PI) - ballAngle);
+		newY = Ball::RADIUS;
+	}
+	else if((newY + Ball::RADIUS) >= GameData::BOARD_HEIGHT)	// Bottom Collision
+	{
+		ballAngle = ((2 * M_PI) - ballAngle);
+		newY = (GameData::BOARD_HEIGHT - Ball::RADIUS);
+	}
+	else if((newX - Ball::RADIUS) <= 0)	// Left Collision
+	{
+		ballAngle = ((ballAngle < M_PI) ? (M_PI - ballAngle) : ((3 * M_PI) - ballAngle));
+		newX = Ball::RADIUS;
+	}
+	else if((newX + Ball::RADIUS) >= GameData::BOARD_WIDTH)	// Right Collision
+	{
+		ballAngle = ((ballAngle < (M_PI / 2)) ? (M_PI - ballAngle) : ((3 * M_PI) - ballAngle));
+		newX = (GameData::BOARD_WIDTH - Ball::RADIUS);
+	}
+
+	ballX = newX;
+	ballY = newY;
+}
+
+// ===== HitsPaddle ===============================================================================
+// Method will check if the ball's bounding rectangle meets a paddle's, the same check as
+// Calculator::CheckCollision() makes on the shapes.
+//
+// Input:
+//	[IN] float paddleX	- the paddle's x-coordinate
+//	[IN] float paddleY	- the paddle's y-coordinate
+//
+// Output:
+//	[OUT] bool			- true if they meet, false otherwise
+// ================================================================================================
+bool SimState::HitsPaddle(float paddleX, float paddleY) const
+{
+	sf::Rect<float> ballBounds((ballX - (Ball::RADIUS / 2)), (ballY - (Ball::RADIUS / 2)), (2 * Ball::RADIUS), (2 * Ball::RADIUS));
+	sf::Rect<float> paddleBounds((paddleX - (Paddle::WIDTH / 2)), (paddleY - (Paddle::HEIGHT / 2)), Paddle::WIDTH, Paddle::HEIGHT);
+
+	return ballBounds.intersects(paddleBounds);
+}
+
+// ===== CheckPaddleCollisions ====================================================================
+// Method will bounce the ball off a paddle it has hit, away from the paddle's center and no steeper
+// than the server allows, and take the paddle's health, as ServerEngine::UpdatePositions() does.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void SimState::CheckPaddleCollisions(void)
+{
+	float leftX = (GameData::LEFT_GOAL_LINE + (Paddle::WIDTH / 2));
+	float rightX = (GameData::RIGHT_GOAL_LINE - (Paddle::WIDTH / 2));
+
+	if(ballX < (GameData::BOARD_WIDTH / 2))		// Check Left Side
+	{
+		if(HitsPaddle(leftX, playerOnePaddlePosition) && (playerOneHealth > 0))
+		{
+			playerOneHealth -= 10;
+
+			double newAngle = Calculator::GetAngleTo(leftX, playerOnePaddlePosition, ballX, ballY);
+
+			// Too steep if: (60 < angle < 180) or (180 < angle < 300)
+			if((newAngle > (M_PI / 3)) && (newAngle < M_PI))
+			{
+				newAngle = (M_PI / 3);
+			}
+			else if((newAngle > M_PI) && (newAngle < ((5 * M_PI) / 3)))
+			{
+				newAngle = ((5 * M_PI) / 3);
+			}
+
+			ballAngle = newAngle;
+			ballX = (leftX + (Paddle::WIDTH / 2) + (Ball::RADIUS / 2));
+		}
+	}
+	else if(ballX > (GameData::BOARD_WIDTH / 2))	// Check Right Side
+	{
+		if(HitsPaddle(rightX, playerTwoPaddlePosition) && (playerTwoHealth > 0))
+		{
+			playerTwoHealth -= 10;
+
+			double newAngle = Calculator::GetAngleTo(rightX, playerTwoPaddlePosition, ballX, ballY);
+
+			// Too steep if: (angle < 120 ) or (angle > 240)
+			if(newAngle < ((4 * M_PI) / 6))
+			{
+				newAngle = ((4 * M_PI) / 6);
+			}
+			else if(newAngle > ((4 * M_PI) / 3))
+			{
+				newAngle = ((4 * M_PI) / 3);
+			}
+
+			ballAngle = newAngle;
+			ballX = (rightX - (Paddle::WIDTH / 2) - (Ball::RADIUS / 2) - 16);
+		}
+	}
+}
+
+// ===== Serve ====================================================================================
+// Method will restore both paddles' health and serve the ball from the center toward the player
+// who didn't score, as the server does after a score.
+//
+// Input:
+//	[IN] int scoringPlayer	- the player who just scored
+//
+// Output: none
+// ================================================================================================
+void SimState::Serve(int scoringPlayer)
+{
+	playerOneHealth = 100;
+	playerTwoHealth = 100;
+
+	ballX = (float)(GameData::BOARD_WIDTH / 2);
+	ballY = (float)(GameData::BOARD_HEIGHT / 2);
+	ballAngle = ((scoringPlayer == 1) ? 0 : M_PI);
+}
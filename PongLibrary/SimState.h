@@ -0,0 +1,74 @@
+// ================================================================================================
+// Filename: "SimState.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The SimState class is the part of the game a tick changes, the ball, paddle positions, health and
+// scores, held as plain values so that it is trivially copyable. Saving or restoring a tick is a
+// copy of a few dozen bytes, with no SFML shapes to construct, which is what lets a client keep a
+// ring of past ticks and re-run many of them within one frame.
+//
+// Step() advances the state one tick, given both players' paddle directions, by the same rules the
+// ServerEngine applies to its' Ball and Paddles, in the same order: the paddles move, the ball moves
+// and bounces off the walls, the paddles bounce the ball and lose health, and a ball past a goal
+// line scores and is served from the center. The health pack spawns at random, so it is left out;
+// the server's snapshots carry its' effect on health.
+//
+// SimState has no constructors or destructor of its' own, so it stays trivially copyable. Create
+// one with FromGameData().
+// ================================================================================================
+
+#ifndef SIMSTATE_H
+#define SIMSTATE_H
+
+#include "GameData.h"
+
+class SimState
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Static Methods
+	static SimState FromGameData(const GameData &gameData);
+
+	// Method Prototypes
+	void ApplyPositions(GameData &gameData) const;
+	void Step(int playerOneDirection, int playerTwoDirection);
+	bool Matches(const SimState &other, float tolerance) const;
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	int serverTick;						// The server tick this is the state after
+
+	// Player Data
+	float playerOnePaddlePosition;		// This is the y-coordinate of the center of the paddle
+	float playerTwoPaddlePosition;
+	int playerOneHealth;
+	int playerTwoHealth;
+	int playerOneScore;
+	int playerTwoScore;
+
+	// Ball Data
+	float ballX;
+	float ballY;
+	double ballAngle;
+
+private:
+
+	static void MovePaddle(float &position, int direction);
+	void MoveBall(void);
+	bool HitsPaddle(float paddleX, float paddleY) const;
+	void CheckPaddleCollisions(void);
+	void Serve(int scoringPlayer);
+};
+
+#endif
@@ -0,0 +1,210 @@
+// ================================================================================================
+// Filename: "TcpTransport.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the TcpTransport class. For a class description see
+// the header file "TcpTransport.h"
+// ================================================================================================
+
+#include <SFML\System\Clock.hpp>
+#include "TcpTransport.h"
+
+// Initialize Static Constants
+const unsigned int TcpTransport::MAX_PACKET_SIZE = 65536;
+
+// ===== Constructor ==============================================================================
+// The constructor will take ownership of an already connected socket.
+//
+// Input:
+//	[IN] sf::TcpSocket *connectedSocket	- the connected socket
+//
+// Output: none
+// ================================================================================================
+TcpTransport::TcpTransport(sf::TcpSocket *connectedSocket)
+{
+	m_socket = connectedSocket;
+	m_selector.add(*m_socket);
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will ensure all dynamically allocated memory is released.
+// ================================================================================================
+TcpTransport::~TcpTransport(void)
+{
+	delete m_socket;
+}
+
+// ===== Connect ==================================================================================
+// Method will attempt to connect a new socket to the passed IP and port number.
+//
+// Input:
+//	[IN] sf::IpAddress ipAddress	- the IP address of the server
+//	[IN] int portNumber				- the port number that the server is listening to
+//
+// Output:
+//	[OUT] TcpTransport*				- the connected transport, or NULL if the connection failed
+// ================================================================================================
+TcpTransport* TcpTransport::Connect(sf::IpAddress ipAddress, int portNumber)
+{
+	sf::TcpSocket *socket = new sf::TcpSocket;
+
+	if(socket->connect(ipAddress, portNumber) != sf::Socket::Done)
+	{
+		delete socket;
+		return NULL;
+	}
+
+	return new TcpTransport(socket);
+}
+
+// ===== Send =====================================================================================
+// Method will send the packet through the socket.
+//
+// Input:
+//	[IN] sf::Packet &packet		- the packet to send
+//
+// Output:
+//	[OUT] sf::Socket::Status	- the status returned by the socket
+// ================================================================================================
+sf::Socket::Status TcpTransport::Send(sf::Packet &packet)
+{
+	return m_socket->send(packet);
+}
+
+// ===== Receive ==================================================================================
+// Method will read whatever the socket has into the receive buffer until a whole packet has been
+// received or the timeout has passed. The socket is only read once the selector says it is
+// readable, so a read never blocks.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//	[IN] sf::Time timeout		- the longest to wait, sf::Time::Zero to wait forever
+//
+// Output:
+//	[OUT] sf::Socket::Status	- the status returned by the socket, NotReady on timeout, or Error
+//								  if the stream holds a packet larger than MAX_PACKET_SIZE
+// ================================================================================================
+sf::Socket::Status TcpTransport::Receive(sf::Packet &packet, sf::Time timeout)
+{
+	sf::Clock waitClock;
+	bool firstPass = true;
+	char chunk[4096];
+	std::size_t received;
+
+	while(true)
+	{
+		sf::Socket::Status extractStatus = ExtractPacket(packet);
+
+		if(extractStatus != sf::Socket::NotReady)
+		{
+			return extractStatus;
+		}
+
+		sf::Time remaining = sf::Time::Zero;
+
+		if(timeout != sf::Time::Zero)
+		{
+			remaining = (timeout - waitClock.getElapsedTime());
+
+			if(remaining <= sf::Time::Zero)
+			{
+				if(!firstPass)
+				{
+					return sf::Socket::NotReady;
+				}
+
+				remaining = Poll();
+			}
+		}
+
+		firstPass = false;
+
+		if(!m_selector.wait(remaining))
+		{
+			if(timeout == sf::Time::Zero)
+			{
+				return sf::Socket::Error;	// An endless wait only fails if the selector does
+			}
+
+			continue;
+		}
+
+		sf::Socket::Status status = m_socket->receive(chunk, sizeof(chunk), received);
+
+		if(status != sf::Socket::Done)
+		{
+			return status;
+		}
+
+		m_receiveBuffer.insert(m_receiveBuffer.end(), chunk, (chunk + received));
+	}
+}
+
+// ===== ExtractPacket ============================================================================
+// Method will move the first packet out of the receive buffer if all of it has arrived. Each packet
+// is a 32-bit size in network byte order followed by that many bytes, the format sf::TcpSocket uses.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//
+// Output:
+//	[OUT] sf::Socket::Status	- Done if a packet was extracted, NotReady if more bytes are needed,
+//								  or Error if the size prefix is larger than MAX_PACKET_SIZE
+// ================================================================================================
+sf::Socket::Status TcpTransport::ExtractPacket(sf::Packet &packet)
+{
+	if(m_receiveBuffer.size() < sizeof(sf::Uint32))
+	{
+		return sf::Socket::NotReady;
+	}
+
+	const unsigned char *prefix = (const unsigned char*)&m_receiveBuffer[0];
+	sf::Uint32 size = ((prefix[0] << 24) | (prefix[1] << 16) | (prefix[2] << 8) | prefix[3]);
+
+	if(size > MAX_PACKET_SIZE)
+	{
+		return sf::Socket::Error;
+	}
+
+	if(m_receiveBuffer.size() < (sizeof(sf::Uint32) + size))
+	{
+		return sf::Socket::NotReady;
+	}
+
+	packet.clear();
+
+	if(size > 0)
+	{
+		packet.append(&m_receiveBuffer[sizeof(sf::Uint32)], size);
+	}
+
+	m_receiveBuffer.erase(m_receiveBuffer.begin(), (m_receiveBuffer.begin() + sizeof(sf::Uint32) + size));
+
+	return sf::Socket::Done;
+}
+
+// ===== Disconnect ===============================================================================
+// Method will disconnect the socket.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void TcpTransport::Disconnect(void)
+{
+	m_socket->disconnect();
+}
+
+// ===== GetRemoteAddress =========================================================================
+// Method will return the address of the connected peer.
+//
+// Input: none
+//
+// Output:
+//	[OUT] sf::IpAddress	- the peer's address
+// ================================================================================================
+sf::IpAddress TcpTransport::GetRemoteAddress(void)
+{
+	return m_socket->getRemoteAddress();
+}
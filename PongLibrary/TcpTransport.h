@@ -0,0 +1,72 @@
+// ================================================================================================
+// Filename: "TcpTransport.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The TcpTransport class carries packets over a connected sf::TcpSocket. The transport takes
+// ownership of the socket and will release it when destroyed.
+//
+// Packets are sent with sf::TcpSocket::send(), but received a chunk at a time into the transport's
+// own buffer and split on the same size prefix SFML writes. sf::TcpSocket::receive(sf::Packet&)
+// would block until a whole packet had arrived, so a peer that sent half a packet could hold the
+// listening thread, or a shard polling handshakes, for as long as it liked.
+// ================================================================================================
+
+#ifndef TCPTRANSPORT_H
+#define TCPTRANSPORT_H
+
+#include <SFML\Network\TcpSocket.hpp>
+#include <SFML\Network\SocketSelector.hpp>
+#include <vector>
+#include "Transport.h"
+
+class TcpTransport: public Transport
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	TcpTransport(sf::TcpSocket *connectedSocket);
+	~TcpTransport(void);
+
+	// Static Factory
+	static TcpTransport* Connect(sf::IpAddress ipAddress, int portNumber);
+
+	// Transport Prototypes
+	sf::Socket::Status Send(sf::Packet &packet);
+	sf::Socket::Status Receive(sf::Packet &packet, sf::Time timeout);
+	void Disconnect(void);
+	sf::IpAddress GetRemoteAddress(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const unsigned int MAX_PACKET_SIZE;	// Larger size prefixes are treated as a broken stream
+
+private:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	sf::Socket::Status ExtractPacket(sf::Packet &packet);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	sf::TcpSocket *m_socket;
+	sf::SocketSelector m_selector;
+	std::vector<char> m_receiveBuffer;		// Bytes received that don't yet make a whole packet
+};
+
+#endif
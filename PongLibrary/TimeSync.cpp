@@ -22,6 +22,12 @@ TimeSync::TimeSync(void)
 	clientRecieveTime = 0;
 	clientSendTime = 0;	
 	serverReceivedTime = 0;
+
+	offsetEstimate = 0;
+	offsetUncertainty = 0;
+	offsetReference = 0;
+	offsetSkew = 0;
+	offsetValid = false;
 }
 
 // ===== Packet Input Overload ====================================================================
@@ -37,8 +43,15 @@ TimeSync::TimeSync(void)
 // ================================================================================================
 sf::Packet& operator<<(sf::Packet& packet, TimeSync& timeSync)
 {
-	packet	<< timeSync.serverSendTime << timeSync.clientRecieveTime << timeSync.clientSendTime
-			<< timeSync.serverReceivedTime;
+	TimeBase::Write(packet, timeSync.serverSendTime);
+	TimeBase::Write(packet, timeSync.clientRecieveTime);
+	TimeBase::Write(packet, timeSync.clientSendTime);
+	TimeBase::Write(packet, timeSync.serverReceivedTime);
+	TimeBase::Write(packet, timeSync.offsetEstimate);
+	TimeBase::Write(packet, timeSync.offsetUncertainty);
+	TimeBase::Write(packet, timeSync.offsetReference);
+
+	packet << timeSync.offsetSkew << timeSync.offsetValid;
 
 	return packet;
 }
@@ -56,8 +69,15 @@ sf::Packet& operator<<(sf::Packet& packet, TimeSync& timeSync)
 // ================================================================================================
 sf::Packet& operator>>(sf::Packet& packet, TimeSync& timeSync)
 {
-	packet	>> timeSync.serverSendTime >> timeSync.clientRecieveTime >> timeSync.clientSendTime
-			>> timeSync.serverReceivedTime;
+	TimeBase::Read(packet, timeSync.serverSendTime);
+	TimeBase::Read(packet, timeSync.clientRecieveTime);
+	TimeBase::Read(packet, timeSync.clientSendTime);
+	TimeBase::Read(packet, timeSync.serverReceivedTime);
+	TimeBase::Read(packet, timeSync.offsetEstimate);
+	TimeBase::Read(packet, timeSync.offsetUncertainty);
+	TimeBase::Read(packet, timeSync.offsetReference);
+
+	packet >> timeSync.offsetSkew >> timeSync.offsetValid;
 
 	return packet;
 }
\ No newline at end of file
@@ -6,10 +6,17 @@
 // ================================================================================================
 // Class Description:
 // 
-// The TimeSync instance is used when a client first connects to the server. The server will send
-// a TimeSync request to the client, which will "stamp" the appropriate times in the class and then
-// send it back. These times will allow the server to calculate the difference between the server
-// and client clocks as well as estimate the latency.
+// The TimeSync instance is used when a client first connects to the server, and then periodically
+// for as long as it stays connected. The server will send a TimeSync request to the client, which
+// will "stamp" the appropriate times in the class and then send it back. These times will allow the
+// server to calculate the difference between the server and client clocks as well as estimate the
+// latency. Each side stamps its' send time as the packet goes out, not when it is queued.
+//
+// Every request also carries the server's current estimate of the clock difference, so the client
+// knows it as well.
+//
+// All times are NetTimes and are sent in full; the stamps of the latest round are the sync points
+// each end uses to expand the compact timestamps in other packets.
 //
 // To increase simplicity, the TimeSync class will make all members public.
 // ================================================================================================
@@ -18,6 +25,7 @@
 #define TIMESYNC_H
 
 #include <SFML\Network\Packet.hpp>
+#include "NetTime.h"
 
 class TimeSync
 {
@@ -36,10 +44,17 @@ public:
 	// Class Data Members
 	// ============================================================================================
 	
-	int serverSendTime;
-	int clientRecieveTime;
-	int clientSendTime;
-	int serverReceivedTime;
+	NetTime serverSendTime;
+	NetTime clientRecieveTime;
+	NetTime clientSendTime;
+	NetTime serverReceivedTime;
+
+	// Server's Estimate
+	NetTime offsetEstimate;				// Server time minus client time
+	NetTime offsetUncertainty;			// The true difference is within offsetEstimate +/- this
+	NetTime offsetReference;			// Client time the estimate was measured at
+	double offsetSkew;					// Change in the difference per unit of client time
+	bool offsetValid;					// False until the server has completed a round
 
 private:
 
@@ -0,0 +1,227 @@
+// ================================================================================================
+// Filename: "TimingWheel.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the TimingWheel and DeliveryQueue classes. For a
+// class description see the header file "TimingWheel.h"
+// ================================================================================================
+
+#include <SFML\System\Sleep.hpp>
+#include "TimingWheel.h"
+
+// Initialize Static Constants
+const int TimingWheel::SLOT_COUNT = 1024;
+const NetTime TimingWheel::TICK = 1000;		// 1 ms
+
+// ===== DeliveryQueue Constructor ================================================================
+// The constructor will start the queue empty with nothing in flight.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+DeliveryQueue::DeliveryQueue(void)
+{
+	m_inFlight.store(0);
+}
+
+// ===== DeliveryQueue::Push ======================================================================
+// Method will add a packet that has come due. Called by the wheel thread.
+//
+// Input:
+//	[IN] const sf::Packet &packet	- the packet
+//
+// Output: none
+// ================================================================================================
+void DeliveryQueue::Push(const sf::Packet &packet)
+{
+	m_lock.lock();
+
+	m_ready.push_back(packet);
+
+	m_lock.unlock();
+
+	m_inFlight--;
+}
+
+// ===== DeliveryQueue::Pop =======================================================================
+// Method will take the oldest packet that has come due.
+//
+// Input:
+//	[IN/OUT] sf::Packet &packet	- receives the packet
+//
+// Output:
+//	[OUT] bool					- true if a packet was taken, false if none are due
+// ================================================================================================
+bool DeliveryQueue::Pop(sf::Packet &packet)
+{
+	bool popped = false;
+
+	m_lock.lock();
+
+	if(!m_ready.empty())
+	{
+		packet = m_ready.front();
+		m_ready.pop_front();
+		popped = true;
+	}
+
+	m_lock.unlock();
+
+	return popped;
+}
+
+// ===== Constructor ==============================================================================
+// The constructor will create the slots and start the wheel thread.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+TimingWheel::TimingWheel(void)
+{
+	m_slots.resize(SLOT_COUNT);
+	m_lastTick = ((Now() / TICK) - 1);
+	m_running.store(true);
+	m_wheelThread = new std::thread(&TimingWheel::WheelLoop, this);
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will stop the wheel thread. Packets still on the wheel are dropped.
+// ================================================================================================
+TimingWheel::~TimingWheel(void)
+{
+	m_running.store(false);
+	m_wheelThread->join();
+	delete m_wheelThread;
+}
+
+// ===== Shared ===================================================================================
+// Method will return the wheel shared by the whole process, creating it on first use.
+//
+// Input: none
+//
+// Output:
+//	[OUT] TimingWheel*	- the shared wheel
+// ================================================================================================
+TimingWheel* TimingWheel::Shared(void)
+{
+	static TimingWheel sharedWheel;
+
+	return &sharedWheel;
+}
+
+// ===== Now ======================================================================================
+// Method will return the current time on the wheel's clock.
+//
+// Input: none
+//
+// Output:
+//	[OUT] NetTime	- the current time
+// ================================================================================================
+NetTime TimingWheel::Now(void)
+{
+	return TimeBase::Now(&m_clock);
+}
+
+// ===== Schedule =================================================================================
+// Method will hold a packet until it is due and then push it onto the connection's queue. A packet
+// that is already due goes out on the next tick.
+//
+// Input:
+//	[IN] std::shared_ptr<DeliveryQueue> queue	- the connection's queue
+//	[IN] const sf::Packet &packet				- the packet
+//	[IN] NetTime due							- when, on the wheel's clock, it should be delivered
+//
+// Output: none
+// ================================================================================================
+void TimingWheel::Schedule(std::shared_ptr<DeliveryQueue> queue, const sf::Packet &packet, NetTime due)
+{
+	Entry entry;
+	entry.queue = queue;
+	entry.packet = packet;
+	entry.due = due;
+
+	queue->m_inFlight++;
+
+	m_lock.lock();
+
+	NetTime tick = (due / TICK);
+
+	if(tick <= m_lastTick)
+	{
+		tick = (m_lastTick + 1);	// Already due, the next slot visited
+	}
+
+	m_slots[(int)(tick % SLOT_COUNT)].push_back(entry);
+
+	m_lock.unlock();
+}
+
+// ===== WheelLoop ================================================================================
+// The wheel thread: once per tick, deliver everything that has come due.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void TimingWheel::WheelLoop(void)
+{
+	while(m_running.load())
+	{
+		Advance(Now());
+		sf::sleep(sf::microseconds((sf::Int64)TICK));
+	}
+}
+
+// ===== Advance ==================================================================================
+// Method will visit every slot whose tick has fully passed since the last visit and deliver the
+// packets in them that are due. Packets are delivered outside the wheel lock, slot by slot.
+//
+// Input:
+//	[IN] NetTime now	- the current time on the wheel's clock
+//
+// Output: none
+// ================================================================================================
+void TimingWheel::Advance(NetTime now)
+{
+	std::list<Entry> due;
+	NetTime nowTick = (now / TICK);
+
+	m_lock.lock();
+
+	// After a long stall, one full turn visits every slot
+	if(((nowTick - 1) - m_lastTick) > SLOT_COUNT)
+	{
+		m_lastTick = ((nowTick - 1) - SLOT_COUNT);
+	}
+
+	while((m_lastTick + 1) < nowTick)
+	{
+		m_lastTick++;
+
+		std::list<Entry> &slot = m_slots[(int)(m_lastTick % SLOT_COUNT)];
+		std::list<Entry>::iterator it = slot.begin();
+
+		while(it != slot.end())
+		{
+			if(it->due <= now)
+			{
+				std::list<Entry>::iterator next = it;
+				next++;
+				due.splice(due.end(), slot, it);
+				it = next;
+			}
+			else
+			{
+				it++;	// Due on a later turn
+			}
+		}
+	}
+
+	m_lock.unlock();
+
+	for(std::list<Entry>::iterator it = due.begin(); it != due.end(); it++)
+	{
+		it->queue->Push(it->packet);
+	}
+}
@@ -0,0 +1,120 @@
+// ================================================================================================
+// Filename: "TimingWheel.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The TimingWheel class holds every packet the network emulator is delaying, for every connection
+// in the process, and hands each one back to its' connection when it is due. A single wheel thread
+// does the timing, so the cost of emulating a connection doesn't grow with the number of them.
+//
+// The wheel is an array of SLOT_COUNT slots, one per TICK of time. A packet due at time t is put
+// in slot (t / TICK) % SLOT_COUNT, so scheduling is constant time however many packets are
+// waiting. Each tick the wheel thread visits the slots it has passed and moves the packets that
+// are due into their connections' DeliveryQueues. A packet due more than a full turn of the wheel
+// away simply stays in its' slot until the turn it is due on.
+//
+// The wheel is shared by the whole process through Shared(); its' thread starts on first use and
+// is stopped when the process exits. Times are on the wheel's own clock, read with Now().
+// ================================================================================================
+
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <list>
+#include <deque>
+#include <atomic>
+#include <SFML\Network\Packet.hpp>
+#include <SFML\System\Clock.hpp>
+#include "NetTime.h"
+
+// ================================================================================================
+// DeliveryQueue - the packets that are due on one connection
+// ================================================================================================
+class DeliveryQueue
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	DeliveryQueue(void);
+	~DeliveryQueue(void){}
+
+	// Method Prototypes
+	void Push(const sf::Packet &packet);
+	bool Pop(sf::Packet &packet);
+
+	// Inlined Methods
+	bool IsIdle(void){ return (m_inFlight.load() == 0); }
+
+	// Packets scheduled on the wheel and not yet delivered
+	std::atomic<int> m_inFlight;
+
+private:
+
+	std::mutex m_lock;
+	std::deque<sf::Packet> m_ready;
+};
+
+// ================================================================================================
+// TimingWheel
+// ================================================================================================
+class TimingWheel
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	TimingWheel(void);
+	~TimingWheel(void);
+
+	// Static Methods
+	static TimingWheel* Shared(void);
+
+	// Method Prototypes
+	void Schedule(std::shared_ptr<DeliveryQueue> queue, const sf::Packet &packet, NetTime due);
+	NetTime Now(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int SLOT_COUNT;		// Slots in one turn of the wheel
+	static const NetTime TICK;			// Time each slot covers
+
+private:
+
+	// A delayed packet and the connection it belongs to
+	struct Entry
+	{
+		std::shared_ptr<DeliveryQueue> queue;
+		sf::Packet packet;
+		NetTime due;
+	};
+
+	void WheelLoop(void);
+	void Advance(NetTime now);
+
+	// Wheel Data
+	sf::Clock m_clock;
+	std::mutex m_lock;
+	std::vector< std::list<Entry> > m_slots;
+	NetTime m_lastTick;					// Last tick whose slot the wheel thread has visited
+
+	// Thread Data
+	std::thread *m_wheelThread;
+	std::atomic<bool> m_running;
+};
+
+#endif
@@ -0,0 +1,59 @@
+// ================================================================================================
+// Filename: "Transport.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The Transport class is the interface that the ClientHandler and CNetworkController use to move
+// packets between the server and a client. It hides what is actually carrying the packets so the
+// same protocol code can run over a TCP socket, shared memory, or an in-process loopback.
+//
+// Every Transport must deliver each packet exactly once and in order. The protocol never resends:
+// a lost INITIALIZE, RESUME or NET_TRACE would leave a client unable to start or resume its' game.
+// An unreliable carrier such as UDP would need a layer of acknowledgements and retransmission
+// beneath this interface first.
+//
+// A Transport is used by exactly two threads: the outgoing thread is the only caller of Send() and
+// the listening thread is the only caller of Receive(). Disconnect() may be called from any thread
+// and must wake a blocked Receive().
+//
+// Receive() waits at most the passed timeout and returns sf::Socket::NotReady if nothing arrived
+// in time, so the listening thread can notice a peer that has gone silent. A timeout of
+// sf::Time::Zero waits forever, the same as sf::SocketSelector::wait(). Receive() always checks
+// at least once, so a timeout of Poll() returns a packet that has already arrived without waiting.
+// A peer that sends only part of a packet must never block Receive() past its' timeout.
+// ================================================================================================
+
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <SFML\Network\Packet.hpp>
+#include <SFML\Network\Socket.hpp>
+#include <SFML\Network\IpAddress.hpp>
+#include <SFML\System\Time.hpp>
+
+class Transport
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Destructor
+	virtual ~Transport(void){}
+
+	// Timeout that checks for a packet without waiting for one
+	static sf::Time Poll(void){ return sf::microseconds(1); }
+
+	// Interface Prototypes
+	virtual sf::Socket::Status Send(sf::Packet &packet) = 0;
+	virtual sf::Socket::Status Receive(sf::Packet &packet, sf::Time timeout) = 0;
+	virtual void Disconnect(void) = 0;
+	virtual sf::IpAddress GetRemoteAddress(void) = 0;
+};
+
+#endif
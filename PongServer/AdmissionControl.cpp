@@ -0,0 +1,274 @@
+// ================================================================================================
+// Filename: "AdmissionControl.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the AdmissionControl class. For a class description
+// see the header file "AdmissionControl.h"
+// ================================================================================================
+
+#include "AdmissionControl.h"
+
+// Initialize Static Constants
+const unsigned int AdmissionControl::MAX_TRACKED_SOURCES = 4096;
+
+// ===== Constructor ==============================================================================
+// The constructor will zero every counter.
+//
+// Input:
+//	[IN] ServerConfig *config	- the options the server was started with
+//	[IN] sf::Clock *gameClock	- the server's game clock
+//
+// Output: none
+// ================================================================================================
+AdmissionControl::AdmissionControl(const ServerConfig *config, const sf::Clock *gameClock) : m_gameClock(gameClock)
+{
+	m_config = config;
+
+	m_stats.accepted = 0;
+	m_stats.completed = 0;
+	m_stats.latencyTotal = 0;
+	m_stats.latencyMax = 0;
+	m_stats.pending = 0;
+	m_stats.clients = 0;
+
+	for(int i = 0; i < GameData::REJECT_REASON_COUNT; i++)
+	{
+		m_stats.rejected[i] = 0;
+	}
+}
+
+// ===== Admit ====================================================================================
+// Method will decide whether a newly accepted connection may start its' handshake. If it may, the
+// connection counts as pending until HandshakeDone() or HandshakeFailed() is called for it.
+//
+// Input:
+//	[IN] sf::IpAddress source		- the address the connection came from
+//	[IN/OUT] sf::Uint8 &reason		- receives the GameData::RejectReason if the connection is refused
+//
+// Output:
+//	[OUT] bool						- true if the connection was admitted, false otherwise
+// ================================================================================================
+bool AdmissionControl::Admit(sf::IpAddress source, sf::Uint8 &reason)
+{
+	NetTime now = TimeBase::Now(m_gameClock);
+	bool admitted = false;
+
+	m_lock.lock();
+
+	m_stats.accepted++;
+
+	if(!TakeToken(source.toInteger(), now))
+	{
+		reason = GameData::RATE_LIMITED;
+	}
+	else if(m_stats.pending >= m_config->maxPendingHandshakes)
+	{
+		reason = GameData::TOO_MANY_PENDING;
+	}
+	else if((m_stats.clients + m_stats.pending) >= m_config->maxClients)
+	{
+		reason = GameData::SERVER_FULL;
+	}
+	else
+	{
+		m_stats.pending++;
+		admitted = true;
+	}
+
+	if(!admitted)
+	{
+		m_stats.rejected[reason]++;
+	}
+
+	m_lock.unlock();
+
+	return admitted;
+}
+
+// ===== HandshakeDone ============================================================================
+// Method will record a finished handshake and its' accept latency.
+//
+// Input:
+//	[IN] bool seated			- true if a JOIN took a new seat, false for a resumed session
+//	[IN] NetTime acceptTime		- the game clock time the connection was accepted
+//
+// Output: none
+// ================================================================================================
+void AdmissionControl::HandshakeDone(bool seated, NetTime acceptTime)
+{
+	NetTime latency = (TimeBase::Now(m_gameClock) - acceptTime);
+
+	m_lock.lock();
+
+	m_stats.pending--;
+	m_stats.completed++;
+	m_stats.latencyTotal += latency;
+
+	if(latency > m_stats.latencyMax)
+	{
+		m_stats.latencyMax = latency;
+	}
+
+	if(seated)
+	{
+		m_stats.clients++;
+	}
+
+	m_lock.unlock();
+}
+
+// ===== HandshakeFailed ==========================================================================
+// Method will record a handshake that was abandoned.
+//
+// Input:
+//	[IN] sf::Uint8 reason	- the GameData::RejectReason the connection was closed for
+//
+// Output: none
+// ================================================================================================
+void AdmissionControl::HandshakeFailed(sf::Uint8 reason)
+{
+	m_lock.lock();
+
+	m_stats.pending--;
+	m_stats.rejected[reason]++;
+
+	m_lock.unlock();
+}
+
+// ===== ClientsLeft ==============================================================================
+// Method will free the seats of clients whose match has been released.
+//
+// Input:
+//	[IN] int count	- the number of clients that left
+//
+// Output: none
+// ================================================================================================
+void AdmissionControl::ClientsLeft(int count)
+{
+	m_lock.lock();
+
+	m_stats.clients -= count;
+
+	m_lock.unlock();
+}
+
+// ===== GetStats =================================================================================
+// Method will return a copy of the accept counters.
+//
+// Input: none
+//
+// Output:
+//	[OUT] Stats	- the current counters
+// ================================================================================================
+AdmissionControl::Stats AdmissionControl::GetStats(void)
+{
+	m_lock.lock();
+
+	Stats stats = m_stats;
+
+	m_lock.unlock();
+
+	return stats;
+}
+
+// ===== PrintStats ===============================================================================
+// Method will write the accept counters to the passed stream.
+//
+// Input:
+//	[IN/OUT] std::ostream &out	- the stream to write to
+//
+// Output: none
+// ================================================================================================
+void AdmissionControl::PrintStats(std::ostream &out)
+{
+	Stats stats = GetStats();
+	sf::Int64 meanLatency = ((stats.completed > 0) ? (stats.latencyTotal / stats.completed) : 0);
+
+	out << "Accepted: " << stats.accepted << "  Completed: " << stats.completed
+		<< "  Pending: " << stats.pending << "  Clients: " << stats.clients << "\n";
+	out << "Rejected - Full: " << stats.rejected[GameData::SERVER_FULL]
+		<< "  Rate Limited: " << stats.rejected[GameData::RATE_LIMITED]
+		<< "  Too Many Pending: " << stats.rejected[GameData::TOO_MANY_PENDING]
+		<< "  Handshake Failed: " << stats.rejected[GameData::HANDSHAKE_FAILED]
+		<< "  Unknown Session: " << stats.rejected[GameData::UNKNOWN_SESSION] << "\n";
+	out << "Accept Latency - Mean: " << (meanLatency / 1000.0) << "ms  Max: " << (stats.latencyMax / 1000.0) << "ms\n";
+}
+
+// ===== TakeToken ================================================================================
+// Method will refill the source's token bucket for the time since it was last used and take one
+// token from it. Must be called with the lock held.
+//
+// Input:
+//	[IN] sf::Uint32 source	- the source address
+//	[IN] NetTime now		- the current game clock time
+//
+// Output:
+//	[OUT] bool				- true if a token was taken, false if the bucket is empty
+// ================================================================================================
+bool AdmissionControl::TakeToken(sf::Uint32 source, NetTime now)
+{
+	std::map<sf::Uint32, Bucket>::iterator it = m_buckets.find(source);
+
+	if(it == m_buckets.end())
+	{
+		if(m_buckets.size() >= MAX_TRACKED_SOURCES)
+		{
+			PruneBuckets(now);
+		}
+
+		Bucket bucket;
+		bucket.tokens = (float)m_config->acceptBurst;
+		bucket.lastRefill = now;
+
+		it = m_buckets.insert(std::make_pair(source, bucket)).first;
+	}
+
+	Bucket &bucket = it->second;
+
+	bucket.tokens += (m_config->acceptRate * ((now - bucket.lastRefill) / 1000000.0f));
+	bucket.lastRefill = now;
+
+	if(bucket.tokens > m_config->acceptBurst)
+	{
+		bucket.tokens = (float)m_config->acceptBurst;
+	}
+
+	if(bucket.tokens < 1.0f)
+	{
+		return false;
+	}
+
+	bucket.tokens -= 1.0f;
+
+	return true;
+}
+
+// ===== PruneBuckets =============================================================================
+// Method will forget every source whose bucket would have refilled completely by now, since a new
+// bucket for it would start full anyway. Must be called with the lock held.
+//
+// Input:
+//	[IN] NetTime now	- the current game clock time
+//
+// Output: none
+// ================================================================================================
+void AdmissionControl::PruneBuckets(NetTime now)
+{
+	std::map<sf::Uint32, Bucket>::iterator it = m_buckets.begin();
+
+	while(it != m_buckets.end())
+	{
+		float refilled = (it->second.tokens + (m_config->acceptRate * ((now - it->second.lastRefill) / 1000000.0f)));
+
+		if(refilled >= m_config->acceptBurst)
+		{
+			it = m_buckets.erase(it);
+		}
+		else
+		{
+			it++;
+		}
+	}
+}
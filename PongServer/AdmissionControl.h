@@ -0,0 +1,106 @@
+// ================================================================================================
+// Filename: "AdmissionControl.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The AdmissionControl class decides whether a newly accepted connection may start a handshake.
+// One instance is shared by every ServerShard, so the limits hold for the server as a whole and
+// not per shard. A connection is turned away with a RejectReason when:
+//
+//	- its' source address has used up its' token bucket (ServerConfig::acceptRate, acceptBurst)
+//	- too many connections are already handshaking (ServerConfig::maxPendingHandshakes)
+//	- the server already holds as many clients as it will take (ServerConfig::maxClients)
+//
+// An admitted connection counts as pending until the shard finishes its' handshake and reports back
+// with HandshakeDone(). A client seated by a JOIN then counts against the capacity until its' match
+// is released and the shard calls ClientsLeft().
+//
+// The class also keeps the server's accept counters: connections accepted, handshakes completed,
+// rejections by reason, and accept latency, which is the time from accept() returning to the
+// client being seated or resumed. GetStats() returns a copy for display. Accepts are rare next to
+// match traffic, so everything is guarded by a single lock.
+// ================================================================================================
+
+#ifndef ADMISSIONCONTROL_H
+#define ADMISSIONCONTROL_H
+
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <SFML\Network\IpAddress.hpp>
+#include <SFML\System\Clock.hpp>
+#include "GameData.h"
+#include "ServerConfig.h"
+
+class AdmissionControl
+{
+
+public:
+
+	// A copy of the accept counters
+	struct Stats
+	{
+		sf::Int64 accepted;									// Connections accepted
+		sf::Int64 completed;								// Handshakes that seated or resumed a client
+		sf::Int64 rejected[GameData::REJECT_REASON_COUNT];	// Connections turned away, by reason
+		sf::Int64 latencyTotal;								// Sum of accept latencies, in us
+		sf::Int64 latencyMax;								// Longest accept latency, in us
+		int pending;										// Connections handshaking now
+		int clients;										// Clients seated now
+	};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	AdmissionControl(const ServerConfig *config, const sf::Clock *gameClock);
+	~AdmissionControl(void){}
+
+	// Method Prototypes
+	bool Admit(sf::IpAddress source, sf::Uint8 &reason);
+	void HandshakeDone(bool seated, NetTime acceptTime);
+	void HandshakeFailed(sf::Uint8 reason);
+	void ClientsLeft(int count);
+	Stats GetStats(void);
+	void PrintStats(std::ostream &out);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const unsigned int MAX_TRACKED_SOURCES;	// Source buckets kept before idle ones are pruned
+
+private:
+
+	// A source address's token bucket
+	struct Bucket
+	{
+		float tokens;
+		NetTime lastRefill;
+	};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	bool TakeToken(sf::Uint32 source, NetTime now);
+	void PruneBuckets(NetTime now);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	const ServerConfig *m_config;
+	const sf::Clock *m_gameClock;
+
+	std::mutex m_lock;
+	std::map<sf::Uint32, Bucket> m_buckets;
+	Stats m_stats;
+};
+
+#endif
@@ -13,56 +13,89 @@
 #include <sstream>
 #include <iostream>
 #include <random>
+#include <algorithm>
+#include <chrono>
 #include <Windows.h>
 #include "ClientHandler.h"
+#include "EmulatedTransport.h"
+
+// Initialize Static Constants
+const int ClientHandler::INITIAL_SYNC_ROUNDS = 3;
+const int ClientHandler::TRACE_CHUNK = 1024;
 
 // ===== Constructor ==============================================================================
-// The constructor will receive a pointer to a connected sf::TcpSocket and set up a thread to listen
-// for data coming from the socket. Once the listening thread is established, the ClientHandler will
-// send a request for a clock sync from the client. 
+// The constructor will receive a pointer to a connected Transport and set up a thread to listen
+// for data coming from it. Once the listening thread is established, the ClientHandler will send the
+// INITIALIZE packet along with a burst of clock sync requests. The handshake is pipelined: all
+// INITIAL_SYNC_ROUNDS rounds go out with the INITIALIZE, so the client is ready one round trip
+// after it joins rather than one per round. The ClientHandler takes ownership of the Transport.
 //
 // The Constructor will receive a a const pointer to the engines game clock. This clock will be used
 // to syncronize the server with the client.
 // 
 // Input:
 //	[IN] int clientNumber				- which player this client represents
-//	[IN] sf::TcpSocket connectedSocket	- the connect TcpClient
+//	[IN] Transport *transport			- the connected transport
+//	[IN] sf::Uint32 sessionToken		- the token the client can use to resume its' slot
 //	[IN] sf::Clock *gameClock			- the game engines clock
+//	[IN] ServerConfig *config			- the options the server was started with
+//	[IN] std::function<void()> onReady	- called once the client is ready, may be nullptr
 //
 // Output: none
 //
 //  ===============================================================================================
-ClientHandler::ClientHandler(int clientNumber, sf::TcpSocket *connectedSocket,
-							 const sf::Clock *gameClock, bool usingArtLatency) : m_gameClock(gameClock)
+ClientHandler::ClientHandler(int clientNumber, Transport *transport, sf::Uint32 sessionToken,
+							 const sf::Clock *gameClock, const ServerConfig *config,
+							 std::function<void(void)> onReady) : m_gameClock(gameClock), m_pacer(config)
 {
 	// Initialize Values
 	m_clientNumber = clientNumber;
-	m_clientSocket = connectedSocket;
+	m_sessionToken = sessionToken;
+	m_config = config;
 	m_syncState = 0;
 	m_ready = false;
-
-	if(usingArtLatency)
-	{
-		srand((unsigned int)(time(0)));
-		m_artificialLatency = ((rand() % 300) + 200);	// Generate Latency Between 200 and 499
-														// This is the One-Way Latency
-		
-		std::cout << "Random Latency = " << m_artificialLatency << "ms\n";
-	}
-	else
+	m_onReady = onReady;
+	m_clientSyncPoint = 0;
+	m_lastLinkLog = 0;
+
+	NetTime now = TimeBase::Now(m_gameClock);
+	m_lastReceiveTime.store(now);
+	m_lastSendTime.store(now);
+	m_sendStartTime.store(-1);
+	m_dropTime.store(now);
+	m_syncRequested.store(0);
+	m_queueDepth.store(0);
+	m_lastSyncTime.store(now);
+	m_syncInterval.store(TimeBase::FromMilliseconds(m_config->syncInterval));
+
+	static std::atomic<unsigned int> connectionCount(0);
+	m_netSeed = (m_config->netSeed + (2 * connectionCount++));	// Up link, the client's down link is +1
+	m_transport = EmulateLink(transport);
+
+	if(m_config->netProfile.IsActive())
 	{
-		m_artificialLatency = 0;
-
-		std::cout << "Random Latency = " << m_artificialLatency << "ms\n";
+		std::cout << "Emulating network profile " << m_config->netProfile.name << "\n";
 	}
 
 	// Start thread
+	StartThreads();
+
+	SendInitialize();
+	SendTrace();
+	SendTimeSyncRequest(INITIAL_SYNC_ROUNDS);		// Pipelined, rather than one round per round trip
+}
+
+// ===== StartThreads =============================================================================
+// Method will mark the client as connected and start the listening and outgoing threads.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientHandler::StartThreads(void)
+{
 	m_connected = true;
 	m_clientListeningThread = new std::thread(&ClientHandler::SocketListening, this);
 	m_outThread = new std::thread(&ClientHandler::SendOutThread, this);
-
-	SendInitialize();
-	SendTimeSyncRequest();
 }
 
 // ===== Destructor ===============================================================================
@@ -74,7 +107,10 @@ ClientHandler::~ClientHandler()
 	StopOutgoingThread();
 	delete m_clientListeningThread;
 	delete m_outThread;
-	delete m_clientSocket;
+	delete m_transport;
+
+	LogTelemetry(true);
+	SaveTrace();
 }
 
 // ===== StopListeningThread ======================================================================
@@ -103,12 +139,14 @@ void ClientHandler::StopOutgoingThread()
 	if (m_outThread != NULL)
 	{
 		m_connected = false;	// Set Thread-Loop conditional to false
+		WakeOutThread();
 		m_outThread->join();	// Wait for thread to end
 	}
 }
 
 // ===== SendGameState ============================================================================
-// This method will send the current game state to its' connected client.
+// This method will send the current game state to its' connected client, if the snapshot pacer
+// decides it should go. It is sent at the precision the pacer picks, which is put in front of it.
 //
 // Input: 
 //	[IN] GameState currentState	- a data structure containing the current game state
@@ -117,16 +155,36 @@ void ClientHandler::StopOutgoingThread()
 // ================================================================================================
 void ClientHandler::SendGameData(GameData currentState)
 {
+	m_lastState = currentState;		// Kept so a resumed client can be sent it straight away
+
+	if(!m_connected)
+	{
+		return;		// Nothing to send it to until the client resumes
+	}
+
+	NetTime now = TimeBase::Now(m_gameClock);
+
+	if(!m_pacer.ShouldSend(currentState, now, m_queueDepth.load(), m_telemetry.GetStats()))
+	{
+		return;
+	}
+
 	sf::Packet dataPacket;
 	sf::Uint8 cmdCode = GameData::GAME_UPDATE;
+	sf::Uint8 precision = m_pacer.GetPrecision();
 
-	dataPacket << cmdCode << currentState;
+	dataPacket << cmdCode << precision;
+	GameData::Write(dataPacket, currentState, precision);
+	m_telemetry.Stamp(dataPacket, now);
 
 	SendPacket(dataPacket);
 }
 
 // ===== SendInitialize ===========================================================================
-// Will send the player number to the client.
+// Will send the player number, the session token, and the connection timeouts to the client, along
+// with the full server time so the client can expand compact timestamps before its' first TIME_SYNC.
+// The client is also sent the down link of the network profile, a seed, and the number of down
+// trace samples that will follow, so it can emulate the packets it receives.
 //
 // Input: none
 // Output: none
@@ -136,11 +194,17 @@ void ClientHandler::SendInitialize(void)
 	sf::Packet initPacket;
 	sf::Uint8 cmdCode = GameData::INITIALIZE;
 	sf::Uint8 playerNumber = m_clientNumber;
-	sf::Uint32 artLatency = m_artificialLatency;
+	LinkProfile downLink = m_config->netProfile.down;
+	sf::Uint32 downSeed = (m_netSeed + 1);
+	sf::Uint32 traceLength = m_config->netTrace.down.size();
+	sf::Uint32 idleTimeout = m_config->idleTimeout;
+	sf::Uint32 sessionToken = m_sessionToken;
+	sf::Uint32 resumeGrace = m_config->resumeGrace;
 
 	std::cout<< "Sending Init Packet\n";
 
-	initPacket << cmdCode << playerNumber << artLatency;
+	initPacket << cmdCode << playerNumber << downLink << downSeed << traceLength << idleTimeout << sessionToken << resumeGrace;
+	TimeBase::Write(initPacket, TimeBase::Now(m_gameClock));		// The client's first sync point
 
 	SendPacket(initPacket);
 }
@@ -153,32 +217,43 @@ void ClientHandler::SendInitialize(void)
 // The first 2-bits will be used for the direction the paddle is moving, and the last 14-bits will
 // be used for the current position of the paddle.
 //
-// If artifical latency is turned on. The SocketListening thread will wait m_artificalLatency time
-// after receiving a packet.
+// The thread never waits longer than a heartbeat interval for a packet, so that it can check the
+// connection's timeouts even when the client has gone silent.
+//
+// Every PADDLE_UPDATE carries a LinkTelemetry trailer, which is read into the telemetry. When the
+// server records traces and the clock estimate is valid, the one-way delay of the update, and of
+// the GAME_UPDATE its' trailer echoes, are recorded. The update is then queued for the engine.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void ClientHandler::SocketListening(void)
 {
-	sf::TcpSocket::Status receiveStatus;
+	sf::Socket::Status receiveStatus;
 	sf::Packet receivedPacket;
 	sf::Uint8 commandCode;
 	TimeSync timeSync;
 
 	while (m_connected)
 	{
-		receiveStatus = m_clientSocket->receive(receivedPacket); // Blocking
+		receiveStatus = m_transport->Receive(receivedPacket, sf::milliseconds(m_config->heartbeatInterval));
 
-		if(receiveStatus == sf::TcpSocket::Done)
+		if(receiveStatus == sf::Socket::Done)
 		{
+			m_lastReceiveTime.store(TimeBase::Now(m_gameClock));
+
 			// Extract Command Code
 			receivedPacket >> commandCode;
 
-			if(commandCode == GameData::TIME_SYNC)
+			if(commandCode == GameData::HEARTBEAT)
+			{
+				// Echoed heartbeat, receiving it was all that was needed
+			}
+			else if(commandCode == GameData::TIME_SYNC)
 			{
 				receivedPacket >> timeSync;
-				timeSync.serverReceivedTime = m_gameClock->getElapsedTime().asMilliseconds();
+				timeSync.serverReceivedTime = TimeBase::Now(m_gameClock);
+				m_clientSyncPoint = timeSync.clientSendTime;
 				TimeSyncReceived(timeSync);
 			}
 			else if(commandCode == GameData::PADDLE_UPDATE)
@@ -187,11 +262,37 @@ void ClientHandler::SocketListening(void)
 
 				// Extract Paddle and Time Data
 				receivedPacket >> update;
-
-				// Assign Data to Class Members
+				update.m_timestamp = TimeBase::Expand(update.m_timestamp, m_clientSyncPoint);
+
+				// Extract Telemetry Trailer
+				ClockEstimate estimate = GetClockEstimate();
+				NetTime arrival = m_lastReceiveTime.load();
+				NetTime clientSendTime = update.m_timestamp;
+
+				if(m_telemetry.Read(receivedPacket, arrival, m_clientSyncPoint, clientSendTime) && estimate.valid)
+				{
+					m_telemetry.AddOneWayDelay(arrival - estimate.ToServerTime(clientSendTime));
+				}
+
+				if(!m_config->recordTrace.empty() && estimate.valid)
+				{
+					NetTime downSendTime = 0;
+					NetTime downArrival = 0;
+
+					// The trailer echoes a GAME_UPDATE, which arrived the hold time before this was sent
+					if(m_telemetry.TakeEchoedArrival(downSendTime, downArrival))
+					{
+						downArrival = estimate.ToServerTime(downArrival);
+						m_trace.Record(NetworkTrace::DOWN, downArrival, (downArrival - downSendTime));
+					}
+
+					m_trace.Record(NetworkTrace::UP, arrival, (arrival - estimate.ToServerTime(update.m_timestamp)));
+				}
+
+				// Queue the Input for the Engine
 				m_dataLock.lock();
 
-				m_lastUpdate = update;
+				m_inputs.Push(update, arrival);
 
 				m_dataLock.unlock();
 			}
@@ -200,42 +301,232 @@ void ClientHandler::SocketListening(void)
 				std::cout << "Error with Command Code\n";
 			}
 		}
-		else if(receiveStatus == sf::TcpSocket::Disconnected)
+		else if(receiveStatus == sf::Socket::Disconnected)
 		{
-			std::cout << "Client Disconnected.\n";
-			m_connected = false;
+			Drop("Client Disconnected.");
 		}
-		else
+		else if(receiveStatus == sf::Socket::Error)
 		{
-			std::cout << "Error Receiving Last Packet.\n";
+			Drop("Error Receiving Last Packet.");
 		}
+
+		CheckTimeouts();
+		LogTelemetry(false);
+	}
+}
+
+// ===== CheckTimeouts ============================================================================
+// Method will drop the client if nothing has been received from it for the idle timeout, or if the
+// outgoing thread has been stuck in a single send for the half-open timeout. The second case is a
+// client whose connection is still open but who has stopped reading, so its' send buffer is full.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientHandler::CheckTimeouts(void)
+{
+	if(!m_connected)
+	{
+		return;
+	}
+
+	NetTime now = TimeBase::Now(m_gameClock);
+	NetTime sendStartTime = m_sendStartTime.load();
+
+	if((now - m_lastReceiveTime.load()) > TimeBase::FromMilliseconds(m_config->idleTimeout))
+	{
+		Drop("Client timed out.");
+	}
+	else if((sendStartTime >= 0) && ((now - sendStartTime) > TimeBase::FromMilliseconds(m_config->halfOpenTimeout)))
+	{
+		Drop("Client stopped reading.");
+	}
+}
+
+// ===== Drop =====================================================================================
+// Method will mark the client as disconnected and disconnect the transport, which also wakes an
+// outgoing thread that is stuck in a send.
+//
+// Input:
+//	[IN] const char *reason	- why the client is being dropped
+//
+// Output: none
+// ================================================================================================
+void ClientHandler::Drop(const char *reason)
+{
+	std::cout << "Player " << m_clientNumber << ": " << reason << " Dropping client.\n";
+
+	m_dropTime.store(TimeBase::Now(m_gameClock));	// Before m_connected, see IsExpired()
+	m_connected = false;
+	m_transport->Disconnect();
+	WakeOutThread();
+}
+
+// ===== IsExpired ================================================================================
+// Method will check if the client has been dropped for longer than the resume grace window.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if the client is gone and can no longer resume, false otherwise
+// ================================================================================================
+bool ClientHandler::IsExpired(void)
+{
+	if(m_connected)
+	{
+		return false;
+	}
+
+	return ((TimeBase::Now(m_gameClock) - m_dropTime.load()) > TimeBase::FromMilliseconds(m_config->resumeGrace));
+}
+
+// ===== Resume ===================================================================================
+// Method will hand the client's slot over to a reconnected transport. The old transport and its'
+// threads are shut down first, in case the server had not yet noticed the old connection was dead.
+// Once the new threads are running the client is told its' RESUME was accepted, sent the last
+// GameData, and sent a single TIME_SYNC. The client's clock has not changed, so the sample window
+// is kept and the new round simply joins it. The ClientHandler takes ownership of the transport.
+//
+// Input:
+//	[IN] Transport *transport	- the reconnected transport
+//
+// Output:
+//	[OUT] bool					- true if the slot was resumed, false if the session has expired
+// ================================================================================================
+bool ClientHandler::Resume(Transport *transport)
+{
+	if(IsExpired())
+	{
+		return false;
 	}
+
+	// Shut down the old connection
+	m_connected = false;
+	m_transport->Disconnect();
+	StopListeningThread();
+	StopOutgoingThread();
+	delete m_clientListeningThread;
+	delete m_outThread;
+	delete m_transport;
+
+	// Take over the new one
+	m_transport = EmulateLink(transport);
+
+	m_outLock.lock();
+
+	m_outPackets.clear();
+	m_queueDepth.store(0);
+
+	m_outLock.unlock();
+
+	NetTime now = TimeBase::Now(m_gameClock);
+	m_lastReceiveTime.store(now);
+	m_lastSendTime.store(now);
+	m_sendStartTime.store(-1);
+	m_syncRequested.store(0);
+	m_syncInterval.store(TimeBase::FromMilliseconds(m_config->syncInterval));		// New path, new latency
+	m_telemetry.Restart();
+	m_pacer.Reset(now);		// New path, and the resumed client must be sent the last GameData
+
+	m_dataLock.lock();
+	m_inputs.Restart();
+	m_dataLock.unlock();
+
+	StartThreads();
+
+	// Acknowledge, then bring the client straight up to date
+	sf::Packet resumePacket;
+	sf::Uint8 cmdCode = GameData::RESUME;
+	sf::Uint8 accepted = 1;
+
+	resumePacket << cmdCode << accepted;
+	SendPacket(resumePacket);
+
+	m_lastState.serverTime = now;
+	SendGameData(m_lastState);
+	SendTimeSyncRequest();
+
+	return true;
+}
+
+// ===== CreateHeartbeat ==========================================================================
+// Method will create a heartbeat packet stamped with the server clock. The client sends the packet
+// straight back.
+//
+// Input: none
+//
+// Output:
+//	[OUT] sf::Packet	- the heartbeat packet
+// ================================================================================================
+sf::Packet ClientHandler::CreateHeartbeat(void)
+{
+	sf::Packet heartbeatPacket;
+	sf::Uint8 cmdCode = GameData::HEARTBEAT;
+	heartbeatPacket << cmdCode;
+
+	TimeBase::WriteCompact(heartbeatPacket, TimeBase::Now(m_gameClock));
+
+	return heartbeatPacket;
 }
 
 // ===== SendTimeSyncRequest ======================================================================
-// This method will be called when the server sends a clock sync command. The method will create
-// a packet containing time stamps that will allow the server to adjust for latency.
+// This method will ask the outgoing thread to send clock sync requests, back to back, on its' next
+// pass. Each request is built and stamped by the outgoing thread as it is sent, see
+// CreateTimeSyncRequest().
+//
+// Input:
+//	[IN] int rounds		- the number of rounds to send
 //
-// Input:none
 // Output:none
 // ================================================================================================
-void ClientHandler::SendTimeSyncRequest(void)
+void ClientHandler::SendTimeSyncRequest(int rounds)
+{
+	m_outLock.lock();
+
+	m_syncRequested += rounds;
+
+	m_outLock.unlock();
+
+	m_outWake.notify_one();
+}
+
+// ===== CreateTimeSyncRequest ====================================================================
+// Method will create a clock sync request stamped with the current server time, and carrying the
+// server's current estimate of the clock difference so the client knows it too. Should only be
+// called by the outgoing thread, immediately before the request is sent.
+//
+// Input: none
+//
+// Output:
+//	[OUT] sf::Packet	- the clock sync request
+// ================================================================================================
+sf::Packet ClientHandler::CreateTimeSyncRequest(void)
 {
 	TimeSync syncRequest;
 	sf::Packet syncPacket;
 	sf::Uint8 cmdCode = GameData::TIME_SYNC;
-
-	syncRequest.serverSendTime = m_gameClock->getElapsedTime().asMilliseconds();
+	ClockEstimate estimate = GetClockEstimate();
+
+	syncRequest.offsetEstimate = estimate.offset;
+	syncRequest.offsetUncertainty = estimate.uncertainty;
+	syncRequest.offsetReference = estimate.reference;
+	syncRequest.offsetSkew = estimate.skew;
+	syncRequest.offsetValid = estimate.valid;
+	syncRequest.serverSendTime = TimeBase::Now(m_gameClock);
 	syncPacket << cmdCode << syncRequest;
 
-	std::cout << "Sending Time Sync\n";
-	SendPacket(syncPacket);
+	m_lastSyncTime.store(syncRequest.serverSendTime);
+
+	return syncPacket;
 }
 
 // ===== TimeSyncReceived =========================================================================
-// This method will operate like a simple state machine and will change behavior based on how 
-// many TimeSyncs the server has received. For each state, it will average the clock differences
-// and latency estimations for the client to produce a more accurate measurement.
+// This method will add the returned round to the client's ClockSync, which keeps the offset from
+// the round with the lowest round trip time and fits the client clock's skew. The first
+// INITIAL_SYNC_ROUNDS were all sent in one burst and are printed; once they have all returned the
+// client is ready, the ready callback is called, and from then on the outgoing thread sends a
+// round every sync interval. The interval doubles each time a round agrees with the ClockSync's
+// prediction, and drops back when one does not.
 //
 // Input:
 //	[IN] TimeSync timeSync	- the received timeSync
@@ -244,91 +535,173 @@ void ClientHandler::SendTimeSyncRequest(void)
 // ================================================================================================
 void ClientHandler::TimeSyncReceived(TimeSync timeSync)
 {
-	if(m_syncState == 0) // First Sync Returned
+	m_dataLock.lock();
+
+	bool agreed = m_clockSync.AddSample(timeSync);
+	ClockEstimate estimate = m_clockSync.GetEstimate();
+
+	m_dataLock.unlock();
+
+	if(m_ready)
 	{
-		std::cout << "\nTime Sync " << (m_syncState + 1) << " Recieved from Client\n";
-
-		int clientProcessTime = (timeSync.clientSendTime - timeSync.clientRecieveTime);
-		std::cout << "Client Processing Time: " << clientProcessTime << "ms\n";
-		int roundTripTime = (timeSync.serverReceivedTime - timeSync.serverSendTime - clientProcessTime);
-		std::cout << "Round Trip Time: " << roundTripTime << "ms\n";
-		int sendTimeDiff = (timeSync.serverSendTime + (roundTripTime / 2) - timeSync.clientRecieveTime);
-		std::cout << "Send Time Diff: " << sendTimeDiff << "ms\n";
-		int recTimeDiff = (timeSync.serverReceivedTime - (roundTripTime / 2) - timeSync.clientSendTime);
-		std::cout << "Receive Time Diff: " << recTimeDiff << "ms\n";
-
-		m_clientLatency = (roundTripTime / 2);
-		std::cout << "Client Latency: " << m_clientLatency << "ms\n";
-		m_clientClockDifference = ((sendTimeDiff + recTimeDiff) / 2);
-		std::cout << "Client Clock Difference: " << m_clientClockDifference << "ms\n";
+		NetTime interval = TimeBase::FromMilliseconds(m_config->syncInterval);
 
-		m_syncState++;
+		if(agreed)
+		{
+			interval = (m_syncInterval.load() * 2);
 
-		SendTimeSyncRequest();
+			if(interval > TimeBase::FromMilliseconds(m_config->maxSyncInterval))
+			{
+				interval = TimeBase::FromMilliseconds(m_config->maxSyncInterval);
+			}
+		}
+
+		m_syncInterval.store(interval);
 	}
-	else // Additional Syncs Returned
-	{
-		std::cout << "\nTime Sync " << (m_syncState + 1) << " Recieved from Client\n";
-
-		int clientProcessTime = (timeSync.clientSendTime - timeSync.clientRecieveTime);
-		std::cout << "Client Processing Time: " << clientProcessTime << "ms\n";
-		int roundTripTime = (timeSync.serverReceivedTime - timeSync.serverSendTime - clientProcessTime);
-		std::cout << "Round Trip Time: " << roundTripTime << "ms\n";
-		int sendTimeDiff = (timeSync.serverSendTime + (roundTripTime / 2) - timeSync.clientRecieveTime);
-		std::cout << "Send Time Diff: " << sendTimeDiff << "ms\n";
-		int recTimeDiff = (timeSync.serverReceivedTime - (roundTripTime / 2) - timeSync.clientSendTime);
-		std::cout << "Receive Time Diff: " << recTimeDiff << "ms\n";
-
-		m_clientLatency = ((m_clientLatency + (roundTripTime / 2)) / 2);
-		std::cout << "Client Latency: " << m_clientLatency << "ms\n";
-		m_clientClockDifference = ((m_clientClockDifference + ((sendTimeDiff + recTimeDiff) / 2)) / 2);
-		std::cout << "Client Clock Difference: " << m_clientClockDifference << "ms\n";
 
+	if(m_syncState < INITIAL_SYNC_ROUNDS)
+	{
 		m_syncState++;
 
-		if(m_syncState < 3) // Send 3 Time Syncs
-		{
-			SendTimeSyncRequest();
-		}
-		else
+		std::cout << "\nTime Sync " << m_syncState << " Recieved from Client\n";
+		std::cout << "Round Trip Time: " << estimate.roundTripTime << "us\n";
+		std::cout << "Client Clock Difference: " << estimate.offset << "us +/- " << estimate.uncertainty << "us\n";
+
+		if(m_syncState == INITIAL_SYNC_ROUNDS)
 		{
 			std::cout << "Client Ready...\n";
 			m_ready = true;
+
+			if(m_onReady)
+			{
+				m_onReady();
+			}
 		}
 	}
 }
 
-// ===== GetPaddleData ============================================================================
-// Method will return the last paddle update received from the client.
+// ===== GetClockEstimate =========================================================================
+// Method will return the current estimate of the client's clock difference.
+//
+// Input: none
+//
+// Output:
+//	[OUT] ClockEstimate	- server time minus client time, and its' confidence bound
+// ================================================================================================
+ClockEstimate ClientHandler::GetClockEstimate(void)
+{
+	ClockEstimate estimate;
+
+	m_dataLock.lock();
+
+	estimate = m_clockSync.GetEstimate();
+
+	m_dataLock.unlock();
+
+	return estimate;
+}
+
+// ===== GetLinkStats =============================================================================
+// Method will return the latest measurements of the connection to the client. They are taken from
+// the telemetry trailers on every GAME_UPDATE and PADDLE_UPDATE, so no extra packets are sent.
 //
 // Input: none
 //
 // Output:
-//	[OUT]	PaddleUpdate m_lastUpdate	- last update received from client
+//	[OUT] LinkStats	- round trip, one-way delay, jitter and loss of the client's connection
+// ================================================================================================
+LinkStats ClientHandler::GetLinkStats(void)
+{
+	return m_telemetry.GetStats();
+}
+
+// ===== LogTelemetry =============================================================================
+// Method will print the connection's measurements every link log interval, and once more when the
+// client is finished with. Does nothing when the link log is off.
+//
+// Input:
+//	[IN] bool final	- true to print now, as the client is being released
+//
+// Output: none
 // ================================================================================================
-PaddleUpdate ClientHandler::GetPaddleData(void)
+void ClientHandler::LogTelemetry(bool final)
 {
-	PaddleUpdate temp;
+	if(m_config->linkLogInterval <= 0)
+	{
+		return;
+	}
+
+	NetTime now = TimeBase::Now(m_gameClock);
+
+	if(!final && ((now - m_lastLinkLog) < TimeBase::FromMilliseconds(m_config->linkLogInterval)))
+	{
+		return;
+	}
+
+	m_lastLinkLog = now;
+
+	std::ostringstream line;
+	line << "Player " << m_clientNumber << (final ? " final " : " ") << "link - ";
+	m_telemetry.GetStats().Print(line);
+	line << "\nPlayer " << m_clientNumber << (final ? " final " : " ") << "input - ";
+	GetInputStats().Print(line);
+	line << "\n";
+
+	std::cout << line.str();
+}
+
+// ===== GetPaddleInputs ==========================================================================
+// Method will take this tick's paddle updates, up to the given number, off the input queue. The
+// queue is an adaptive buffer taken from at tick boundaries, so arrival jitter doesn't become
+// paddle jitter.
+//
+// Input:
+//	[IN/OUT] std::list<PaddleUpdate> &inputs	- receives the updates, oldest first
+//	[IN] int maxInputs							- the most updates to take
+//
+// Output:
+//	[OUT] bool									- true if any updates were taken, false otherwise
+// ================================================================================================
+bool ClientHandler::GetPaddleInputs(std::list<PaddleUpdate> &inputs, int maxInputs)
+{
+	m_dataLock.lock();
 
+	bool taken = m_inputs.Take(inputs, maxInputs);
+
+	m_dataLock.unlock();
+
+	return taken;
+}
+
+// ===== GetInputStats ============================================================================
+// Method will return the input queue's counters and buffer state.
+//
+// Input: none
+//
+// Output:
+//	[OUT] InputStats	- late, dropped and duplicated updates, and the buffer's depth and target
+// ================================================================================================
+InputStats ClientHandler::GetInputStats(void)
+{
 	m_dataLock.lock();
 
-	temp = m_lastUpdate;
+	InputStats stats = m_inputs.GetStats();
 
 	m_dataLock.unlock();
 
-	return temp;
+	return stats;
 }
 
 // ===== Disconnect ===============================================================================
-// This method will terminate the listening thread and disconnect the m_clientSocket.
+// This method will terminate the listening thread and disconnect the m_transport.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void ClientHandler::Disconnect(void)
 {
+	m_transport->Disconnect();		// Wakes the blocked listening thread
 	StopListeningThread();
-	m_clientSocket->disconnect();
 }
 
 // ===== SendPacket ===============================================================================
@@ -345,43 +718,228 @@ void ClientHandler::SendPacket(sf::Packet packet)
 	m_outLock.lock();
 
 	m_outPackets.push_back(packet);
+	m_queueDepth++;
 
 	m_outLock.unlock();
+
+	m_outWake.notify_one();
 }
 
 // ===== SendOutThread ============================================================================
-// This method is used to simulate artificial latency between the client and server. It will wait
-// m_artificialLatency time, before sending out all packets in the outPackets list. This method will
-// be the starting place for the m_outThread member and should only ever be called by that thread.
+// This method will send out all packets in the outPackets list. This method will be the starting
+// place for the m_outThread member and should only ever be called by that thread.
+//
+// The packets are taken off the list before they are sent, so a client that stops reading can only
+// stall this thread and never the engine calling SendPacket(). If nothing has been sent for a
+// heartbeat interval, a heartbeat is sent instead. Clock sync rounds are sent whenever they have
+// been requested, or once the client is ready and a sync interval has passed since the last round.
+//
+// With nothing to send, the thread sleeps until it is woken or the next heartbeat or sync round is
+// due, see NextScheduledSend().
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void ClientHandler::SendOutThread(void)
 {
-	sf::Packet tempPacket;
-	sf::Clock lagClock;
+	std::list<sf::Packet> sending;
 
 	while(m_connected)
 	{
-		if(lagClock.getElapsedTime().asMilliseconds() < m_artificialLatency)
+		std::unique_lock<std::mutex> lock(m_outLock);
+
+		if(m_outPackets.empty() && (m_syncRequested.load() == 0) && m_connected)
 		{
-			continue;
+			NetTime wait = (NextScheduledSend() - TimeBase::Now(m_gameClock));
+
+			if(wait > 0)
+			{
+				m_outWake.wait_for(lock, std::chrono::microseconds(wait));
+			}
 		}
-		else
+
+		sending.swap(m_outPackets);
+		int syncRounds = m_syncRequested.exchange(0);
+
+		lock.unlock();
+
+		while(!sending.empty() && m_connected)
 		{
-			lagClock.restart();
+			SendNow(sending.front());
+			sending.pop_front();
+			m_queueDepth--;
+		}
 
-			m_outLock.lock();
+		m_queueDepth -= (int)sending.size();
+		sending.clear();
 
-			while(!m_outPackets.empty())
+		NetTime now = TimeBase::Now(m_gameClock);
+
+		if(m_ready && ((now - m_lastSyncTime.load()) >= m_syncInterval.load()) && (syncRounds == 0))
+		{
+			syncRounds = 1;
+		}
+
+		if(syncRounds > 0)
+		{
+			for(; (syncRounds > 0) && m_connected; syncRounds--)
 			{
-				tempPacket = m_outPackets.front();
-				m_outPackets.pop_front();
-				m_clientSocket->send(tempPacket);
+				sf::Packet syncPacket = CreateTimeSyncRequest();
+				SendNow(syncPacket);
 			}
+		}
+		else if((now - m_lastSendTime.load()) >= TimeBase::FromMilliseconds(m_config->heartbeatInterval))
+		{
+			sf::Packet heartbeatPacket = CreateHeartbeat();
+			SendNow(heartbeatPacket);
+		}
+	}
+}
+
+// ===== WakeOutThread ============================================================================
+// Method will wake the outgoing thread if it is asleep, so it notices the client has disconnected.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientHandler::WakeOutThread(void)
+{
+	m_outLock.lock();
+	m_outLock.unlock();		// Taken so the thread is either asleep or yet to check m_connected
 
-			m_outLock.unlock();
+	m_outWake.notify_all();
+}
+
+// ===== NextScheduledSend ========================================================================
+// Method will work out when the outgoing thread next has to send something it was not asked to: a
+// heartbeat, or once the client is ready, the next clock sync round.
+//
+// Input: none
+//
+// Output:
+//	[OUT] NetTime	- the game clock time the next heartbeat or sync round is due
+// ================================================================================================
+NetTime ClientHandler::NextScheduledSend(void)
+{
+	NetTime due = (m_lastSendTime.load() + TimeBase::FromMilliseconds(m_config->heartbeatInterval));
+
+	if(m_ready)
+	{
+		due = std::min(due, (m_lastSyncTime.load() + m_syncInterval.load()));
+	}
+
+	return due;
+}
+
+// ===== EmulateLink =============================================================================
+// Method will wrap a transport so the packets received on it cross the network profile's up link,
+// or the up half of the trace being replayed. If neither changes anything the transport is returned
+// as it is. The client is sent the down link in INITIALIZE and emulates it on its' side.
+//
+// Input:
+//	[IN] Transport *transport	- the transport to wrap
+//
+// Output:
+//	[OUT] Transport*			- the transport the ClientHandler should use
+// ================================================================================================
+Transport* ClientHandler::EmulateLink(Transport *transport)
+{
+	if(!m_config->netProfile.up.IsActive() && m_config->netTrace.up.empty())
+	{
+		return transport;
+	}
+
+	return new EmulatedTransport(transport, m_config->netProfile.up, m_netSeed, &m_config->netTrace.up);
+}
+
+// ===== SendTrace ================================================================================
+// Method will send the down half of the trace being replayed to the client, TRACE_CHUNK samples to
+// a NET_TRACE packet, so it stays well under the largest packet a transport will carry.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientHandler::SendTrace(void)
+{
+	const std::vector<TraceSample> &samples = m_config->netTrace.down;
+
+	for(unsigned int first = 0; first < samples.size(); first += TRACE_CHUNK)
+	{
+		sf::Packet tracePacket;
+		sf::Uint8 cmdCode = GameData::NET_TRACE;
+		sf::Uint16 count = (sf::Uint16)std::min<size_t>(TRACE_CHUNK, (samples.size() - first));
+
+		tracePacket << cmdCode << count;
+
+		for(unsigned int i = first; i < (first + count); i++)
+		{
+			TraceSample sample = samples[i];
+			tracePacket << sample;
 		}
+
+		SendPacket(tracePacket);
+	}
+}
+
+// ===== SaveTrace ================================================================================
+// Method will write the trace recorded for this client to "<prefix>-<session token>.trace", if the
+// server is recording traces and anything was recorded.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ClientHandler::SaveTrace(void)
+{
+	if(m_config->recordTrace.empty() || m_trace.IsEmpty())
+	{
+		return;
 	}
-}
\ No newline at end of file
+
+	std::ostringstream path;
+	path << m_config->recordTrace << "-" << m_sessionToken << ".trace";
+
+	if(m_trace.Save(path.str()))
+	{
+		std::cout << "Player " << m_clientNumber << ": Network trace saved to " << path.str() << "\n";
+	}
+	else
+	{
+		std::cout << "Player " << m_clientNumber << ": Could not save network trace to " << path.str() << "\n";
+	}
+}
+
+// ===== SendNow ==================================================================================
+// Method will send a packet straight to the transport, keeping the bookkeeping the half-open check
+// relies on, and drop the client if the send fails. Should only be called by the outgoing thread.
+//
+// Input:
+//	[IN] sf::Packet &packet	- the packet to send
+//
+// Output:
+//	[OUT] bool				- true if the packet was sent, false otherwise
+// ================================================================================================
+bool ClientHandler::SendNow(sf::Packet &packet)
+{
+	if(!m_connected)
+	{
+		return false;
+	}
+
+	m_sendStartTime.store(TimeBase::Now(m_gameClock));
+
+	sf::Socket::Status sendStatus = m_transport->Send(packet);
+
+	m_sendStartTime.store(-1);
+
+	if(sendStatus == sf::Socket::Done)
+	{
+		m_lastSendTime.store(TimeBase::Now(m_gameClock));
+		return true;
+	}
+	else if(m_connected)
+	{
+		Drop("Error Sending Packet.");
+	}
+
+	return false;
+}
@@ -9,8 +9,10 @@
 // The ClientHandler class will be used to interact with a specific client. It will be responsible 
 // for receiving the Client's paddle data and sending the Server's game state to the client. Upon
 // creation, the ClientHandler will establish a clock sync with its' client as well as calculate
-// the latency. The ClientHandler will maintain the most recent position and direction of its'
-// assigned clients paddle along with the timestamp of when it was received.
+// the latency. For as long as the client is connected it keeps the clock sync, the health of the
+// connection and its' link telemetry up to date, holds the client's paddle updates in an InputQueue
+// until the engine takes them, and paces the game state it sends to the client's link. A dropped
+// client keeps its' slot for the resume grace window.
 //
 // The ClientHandler class makes all of its' members and methods private but allows the 
 // NetworkController class access by declaring it a friend. This is so that no other client code
@@ -24,12 +26,21 @@
 #include <Thread>
 #include <string>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <list>
-#include <SFML\Network\TcpSocket.hpp>
+#include <atomic>
 #include <SFML\System\Clock.hpp>
+#include "Transport.h"
+#include "ServerConfig.h"
 #include "GameData.h"
+#include "NetTime.h"
 #include "TimeSync.h"
+#include "ClockSync.h"
 #include "PaddleUpdate.h"
+#include "LinkTelemetry.h"
+#include "SnapshotPacer.h"
+#include "InputQueue.h"
 
 class ClientHandler
 {
@@ -47,7 +58,8 @@ private:
 	// ============================================================================================
 
 	// Constructor/Destructor Prototypes
-	ClientHandler(int clientNumber, sf::TcpSocket *connectedSocket, const sf::Clock *gameClock, bool usingArtLatency);
+	ClientHandler(int clientNumber, Transport *transport, sf::Uint32 sessionToken,
+				  const sf::Clock *gameClock, const ServerConfig *config, std::function<void(void)> onReady);
 	~ClientHandler(void);
 
 	// Method Prototypes
@@ -57,16 +69,33 @@ private:
 	void SendPacket(sf::Packet packet);
 	void StopListeningThread(void);
 	void StopOutgoingThread(void);
-	void SendTimeSyncRequest(void);
+	void SendTimeSyncRequest(int rounds = 1);
 	void TimeSyncReceived(TimeSync timeSync);
-	PaddleUpdate GetPaddleData(void);
+	ClockEstimate GetClockEstimate(void);
+	bool GetPaddleInputs(std::list<PaddleUpdate> &inputs, int maxInputs);
+	InputStats GetInputStats(void);
 	void Disconnect(void);
 	void SendOutThread(void);
+	void WakeOutThread(void);
+	NetTime NextScheduledSend(void);
+	void CheckTimeouts(void);
+	bool Resume(Transport *transport);
+	bool IsExpired(void);
+	void StartThreads(void);
+	void Drop(const char *reason);
+	sf::Packet CreateHeartbeat(void);
+	sf::Packet CreateTimeSyncRequest(void);
+	bool SendNow(sf::Packet &packet);
+	Transport* EmulateLink(Transport *transport);
+	void SendTrace(void);
+	void SaveTrace(void);
+	LinkStats GetLinkStats(void);
+	void LogTelemetry(bool final);
 
 	// Inlined Methods
 	bool IsConnected(void){ return m_connected; }
 	bool IsReady(void){ return m_ready; }
-	int GetClockDifference(void){ return m_clientClockDifference; }
+	sf::Uint32 GetSessionToken(void){ return m_sessionToken; }
 
 	// ============================================================================================
 	// Class Data Members
@@ -74,27 +103,59 @@ private:
 
 	// Game Data 
 	const sf::Clock *m_gameClock;
+	const ServerConfig *m_config;
 
 	// Client Data
 	int m_clientNumber;
-	sf::TcpSocket *m_clientSocket;
-	int m_clientClockDifference;
-	int m_clientLatency;
+	sf::Uint32 m_sessionToken;
+	Transport *m_transport;
 	int m_syncState;
-	int m_artificialLatency;
-	bool m_ready;
+	std::atomic<bool> m_ready;
+	std::function<void(void)> m_onReady;	// Called by the listening thread once the client is ready
 
-	// Paddle Data
+	// Network Emulation Data
+	static const int TRACE_CHUNK;	// Most samples sent in one NET_TRACE packet
+	unsigned int m_netSeed;			// Seeds the up link emulator, the client's down link uses the next one
+	NetworkTrace m_trace;			// Recorded by the listening thread when recording traces
+
+	// Telemetry Data
+	LinkTelemetry m_telemetry;		// Stamped on GAME_UPDATEs, read off PADDLE_UPDATEs
+	NetTime m_lastLinkLog;			// When the link was last logged, only touched by the listening thread
+
+	// Snapshot Pacing Data
+	SnapshotPacer m_pacer;			// Only touched by the thread stepping the match
+	std::atomic<int> m_queueDepth;	// Packets in the out queue or waiting to be sent by the out thread
+
+	// Paddle and Clock Data
 	std::mutex m_dataLock;
-	PaddleUpdate m_lastUpdate;
+	InputQueue m_inputs;					// Paddle updates not yet taken by the engine
+	ClockSync m_clockSync;
+
+	// Clock Sync Scheduling, times are from m_gameClock
+	static const int INITIAL_SYNC_ROUNDS;	// Rounds before the client is considered ready
+	std::atomic<int> m_syncRequested;		// Rounds to send back to back on the next pass of the out thread
+	std::atomic<NetTime> m_lastSyncTime;	// When the last round went out
+	std::atomic<NetTime> m_syncInterval;	// Time until the next round, backs off while rounds agree
+	NetTime m_clientSyncPoint;				// Latest full client time received, only touched by the
+											// listening thread
 
 	// Thread Data
 	std::thread *m_clientListeningThread;
-	bool m_connected;
+	std::atomic<bool> m_connected;
+
+	// Connection Health Data, times are from m_gameClock
+	std::atomic<NetTime> m_lastReceiveTime;		// When the last packet arrived from the client
+	std::atomic<NetTime> m_lastSendTime;		// When the last packet went out to the client
+	std::atomic<NetTime> m_sendStartTime;		// When the send in progress started, -1 if not sending
+	std::atomic<NetTime> m_dropTime;			// When the client was dropped
+
+	// Resume Data, only touched by the thread stepping the match
+	GameData m_lastState;
 
 	// Outgoing Data
 	std::thread *m_outThread;
 	std::mutex m_outLock;
+	std::condition_variable m_outWake;		// Signalled with m_outLock when there is work for the out thread
 	std::list<sf::Packet> m_outPackets;
 };
 
@@ -0,0 +1,343 @@
+// ================================================================================================
+// Filename: "InputQueue.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the InputStats and InputQueue classes. For a class
+// description see the header file "InputQueue.h"
+// ================================================================================================
+
+#include <cmath>
+#include "InputQueue.h"
+#include "GameData.h"
+
+// Initialize Static Constants
+const int InputQueue::MAX_INPUTS = 32;
+const int InputQueue::RECEIVED_WINDOW = 64;
+const int InputQueue::MAX_DEPTH = 6;
+const int InputQueue::CATCH_UP_SLACK = 2;
+const double InputQueue::JITTER_GAIN = (1.0 / 16.0);
+const double InputQueue::JITTER_MULTIPLIER = 2.0;
+
+// ===== InputStats Default Constructor ===========================================================
+// The default constructor will start with nothing counted.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+InputStats::InputStats(void)
+{
+	received = 0;
+	late = 0;
+	dropped = 0;
+	duplicated = 0;
+	depth = 0;
+	targetDepth = 0;
+	jitter = 0;
+}
+
+// ===== InputStats::Print ========================================================================
+// Method will write the counters and buffer state on one line.
+//
+// Input:
+//	[IN/OUT] std::ostream &out	- the stream to write to
+//
+// Output: none
+// ================================================================================================
+void InputStats::Print(std::ostream &out) const
+{
+	out << "Inputs: " << received << "  Late: " << late << "  Dropped: " << dropped << "  Duplicated: " << duplicated
+		<< "  Buffered: " << depth << "/" << targetDepth << "  Jitter: " << (jitter / 1000.0) << "ms";
+}
+
+// ===== Default Constructor ======================================================================
+// The default constructor will start the queue empty, with nothing received.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+InputQueue::InputQueue(void)
+{
+	m_haveReceived = false;
+	m_highestReceived = 0;
+	m_receivedMask = 0;
+	m_lastTaken = 0;
+	m_primed = false;
+	m_waiting = false;
+	m_haveTransit = false;
+	m_lastTransit = 0;
+}
+
+// ===== Push =====================================================================================
+// Method will queue an update from the client in sequence order, and update the jitter estimate
+// and counters. An update the engine has already moved past is counted as late, not queued.
+//
+// Input:
+//	[IN] const PaddleUpdate &update	- the update, its' timestamp on the client's clock
+//	[IN] NetTime arrivalTime		- when it arrived, on the server's clock
+//
+// Output:
+//	[OUT] bool						- true if it was queued, false if it was a duplicate or too late
+// ================================================================================================
+bool InputQueue::Push(const PaddleUpdate &update, NetTime arrivalTime)
+{
+	m_stats.received++;
+
+	// Already received
+	if(HasReceived(update.m_sequence))
+	{
+		m_stats.duplicated++;
+		return false;
+	}
+
+	// The first update places the engine just before it, wherever the client's sequences start
+	if(!m_haveReceived)
+	{
+		m_lastTaken = (update.m_sequence - 1);
+	}
+
+	bool tooLate = ((sf::Int32)(update.m_sequence - m_lastTaken) <= 0);
+
+	// Sequence
+	if(!m_haveReceived)
+	{
+		m_haveReceived = true;
+		m_highestReceived = update.m_sequence;
+		m_receivedMask = 1;
+	}
+	else
+	{
+		sf::Int32 gap = (sf::Int32)(update.m_sequence - m_highestReceived);
+
+		if(gap > 0)
+		{
+			m_stats.dropped += (gap - 1);
+			m_highestReceived = update.m_sequence;
+			m_receivedMask = ((gap < RECEIVED_WINDOW) ? ((m_receivedMask << gap) | 1) : 1);
+		}
+		else
+		{
+			if(-gap < RECEIVED_WINDOW)
+			{
+				m_receivedMask |= ((sf::Uint64)1 << -gap);
+			}
+
+			if(!tooLate && (m_stats.dropped > 0))
+			{
+				m_stats.dropped--;		// Filled a gap counted as dropped
+			}
+		}
+	}
+
+	// Transit jitter, the clock offset cancels out
+	NetTime transit = (arrivalTime - update.m_timestamp);
+
+	if(m_haveTransit)
+	{
+		double change = std::fabs((double)(transit - m_lastTransit));
+
+		m_stats.jitter += ((change - m_stats.jitter) * JITTER_GAIN);
+	}
+
+	m_haveTransit = true;
+	m_lastTransit = transit;
+
+	// The engine has moved past it, so it stays counted as dropped
+	if(tooLate)
+	{
+		m_stats.late++;
+		return false;
+	}
+
+	// Queue in sequence order
+	std::list<PaddleUpdate>::iterator it = m_inputs.end();
+
+	while(it != m_inputs.begin())
+	{
+		std::list<PaddleUpdate>::iterator before = it;
+		before--;
+
+		if((sf::Int32)(update.m_sequence - before->m_sequence) > 0)
+		{
+			break;
+		}
+
+		it = before;
+	}
+
+	m_inputs.insert(it, update);
+
+	if(m_waiting)
+	{
+		m_stats.late++;
+		m_waiting = false;
+	}
+
+	while((int)m_inputs.size() > MAX_INPUTS)
+	{
+		m_lastTaken = m_inputs.front().m_sequence;	// Pushed out, so the engine moves past it
+		m_inputs.pop_front();
+		m_stats.dropped++;
+	}
+
+	UpdateTarget();
+
+	return true;
+}
+
+// ===== Take =====================================================================================
+// Method will be called by the engine at each tick boundary, and will give it the updates to apply
+// this tick: none while the buffer is filling to the target, all it will take when the buffer is
+// well over the target, and one otherwise.
+//
+// Input:
+//	[IN/OUT] std::list<PaddleUpdate> &inputs	- receives the updates, oldest first
+//	[IN] int maxInputs							- the most updates the engine will take
+//
+// Output:
+//	[OUT] bool									- true if any updates were taken, false otherwise
+// ================================================================================================
+bool InputQueue::Take(std::list<PaddleUpdate> &inputs, int maxInputs)
+{
+	int depth = (int)m_inputs.size();
+	int fill = ((m_stats.targetDepth > 1) ? m_stats.targetDepth : 1);
+
+	if(depth == 0)
+	{
+		if(m_haveReceived)
+		{
+			m_primed = false;		// Refill to the target before giving any more
+			m_waiting = true;
+		}
+
+		return false;
+	}
+
+	if(!m_primed)
+	{
+		if(depth < fill)
+		{
+			return false;
+		}
+
+		m_primed = true;
+	}
+
+	int count = 1;
+
+	if(depth > (m_stats.targetDepth + CATCH_UP_SLACK))
+	{
+		count = maxInputs;
+	}
+
+	while(!m_inputs.empty() && (count-- > 0))
+	{
+		m_lastTaken = m_inputs.front().m_sequence;
+		inputs.push_back(m_inputs.front());
+		m_inputs.pop_front();
+	}
+
+	return !inputs.empty();
+}
+
+// ===== Restart ==================================================================================
+// Method will forget the transit state and refill the buffer after the connection is replaced. The
+// queued updates and the counters are kept.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void InputQueue::Restart(void)
+{
+	m_haveTransit = false;
+	m_primed = false;
+	m_waiting = false;
+}
+
+// ===== GetStats =================================================================================
+// Method will return a copy of the counters and buffer state.
+//
+// Input: none
+//
+// Output:
+//	[OUT] InputStats	- the current counters
+// ================================================================================================
+InputStats InputQueue::GetStats(void)
+{
+	InputStats stats = m_stats;
+
+	stats.depth = (int)m_inputs.size();
+
+	return stats;
+}
+
+// ===== HasReceived ==============================================================================
+// Method will check if an update with the given sequence has already been received. Further back
+// than the received mask reaches, anything the engine has passed, or that is still queued, is taken
+// as received.
+//
+// Input:
+//	[IN] sf::Uint32 sequence	- the sequence to look for
+//
+// Output:
+//	[OUT] bool					- true if it has been received, false otherwise
+// ================================================================================================
+bool InputQueue::HasReceived(sf::Uint32 sequence)
+{
+	sf::Int32 behind = (sf::Int32)(m_highestReceived - sequence);
+
+	if(!m_haveReceived || (behind < 0))
+	{
+		return false;
+	}
+
+	if(behind < RECEIVED_WINDOW)
+	{
+		return (((m_receivedMask >> behind) & 1) != 0);
+	}
+
+	return (((sf::Int32)(sequence - m_lastTaken) <= 0) || IsQueued(sequence));
+}
+
+// ===== IsQueued =================================================================================
+// Method will check if an update with the given sequence is already queued.
+//
+// Input:
+//	[IN] sf::Uint32 sequence	- the sequence to look for
+//
+// Output:
+//	[OUT] bool					- true if it is queued, false otherwise
+// ================================================================================================
+bool InputQueue::IsQueued(sf::Uint32 sequence)
+{
+	for(std::list<PaddleUpdate>::iterator it = m_inputs.begin(); it != m_inputs.end(); it++)
+	{
+		if(it->m_sequence == sequence)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// ===== UpdateTarget =============================================================================
+// Method will set the target depth to JITTER_MULTIPLIER jitters' worth of engine ticks, rounded
+// up, and at most MAX_DEPTH.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void InputQueue::UpdateTarget(void)
+{
+	double tick = (double)TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+	int target = (int)std::ceil((JITTER_MULTIPLIER * m_stats.jitter) / tick);
+
+	if(target > MAX_DEPTH)
+	{
+		target = MAX_DEPTH;
+	}
+
+	m_stats.targetDepth = target;
+}
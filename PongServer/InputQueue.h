@@ -0,0 +1,132 @@
+// ================================================================================================
+// Filename: "InputQueue.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The InputQueue class holds the paddle updates a client has sent until the engine applies them.
+// Each ClientHandler has one. Updates are kept in sequence order, so none is lost when several
+// arrive within one engine tick, and the engine takes them at tick boundaries with Take().
+//
+// A client sends one update per engine cycle, but they don't arrive one per tick: the network
+// bunches some up and holds others back. Applying them as they arrive would turn that arrival
+// jitter straight into paddle jitter. Instead the queue is an adaptive input buffer. It measures
+// the jitter of the updates' transit times, the same interarrival jitter the LinkTelemetry uses,
+// and aims to keep JITTER_MULTIPLIER jitters' worth of ticks buffered, at most MAX_DEPTH. The
+// engine is given one update per tick. When the buffer runs dry it waits until it has refilled to
+// the target before giving any more, and when it has more than CATCH_UP_SLACK updates over the
+// target the engine is given as many as it will take, to work off the extra delay.
+//
+// The queue counts, in an InputStats:
+//	received	- every update that arrived
+//	late		- updates that arrived after the buffer had run dry waiting for them, or after the
+//				  engine had already moved past their sequence
+//	dropped		- updates never applied: lost to a gap in the sequence, arrived too late, or pushed
+//				  out of a full queue
+//	duplicated	- updates for a sequence already received, such as those sent again on a resume
+//
+// Which sequences have been received is kept as a bitmask of the RECEIVED_WINDOW sequences up to
+// the highest, so an update that fills a gap the engine has already passed is told apart from a
+// copy of one that was applied. Further back than the window, anything the engine has passed is
+// taken as a copy.
+//
+// The InputQueue does not lock. The ClientHandler only uses it under its' data lock.
+// ================================================================================================
+
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <list>
+#include <ostream>
+#include <SFML\Config.hpp>
+#include "PaddleUpdate.h"
+#include "NetTime.h"
+
+// ================================================================================================
+// InputStats - a snapshot of the queue's counters
+// ================================================================================================
+class InputStats
+{
+
+public:
+
+	// Constructor/Destructor Prototypes
+	InputStats(void);
+	~InputStats(void){}
+
+	// Method Prototypes
+	void Print(std::ostream &out) const;
+
+	// Counters
+	sf::Uint32 received;
+	sf::Uint32 late;			// Arrived after the buffer ran dry waiting for them, or too late to apply
+	sf::Uint32 dropped;			// Never applied
+	sf::Uint32 duplicated;		// Already received
+
+	// Buffer State
+	int depth;					// Updates queued
+	int targetDepth;			// Updates the buffer aims to hold
+	double jitter;				// Interarrival jitter, in us
+};
+
+// ================================================================================================
+// InputQueue
+// ================================================================================================
+class InputQueue
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	InputQueue(void);
+	~InputQueue(void){}
+
+	// Method Prototypes
+	bool Push(const PaddleUpdate &update, NetTime arrivalTime);
+	bool Take(std::list<PaddleUpdate> &inputs, int maxInputs);
+	void Restart(void);
+	InputStats GetStats(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int MAX_INPUTS;			// Most updates queued, oldest dropped first
+	static const int RECEIVED_WINDOW;		// Sequences, up to the highest, kept in the received mask
+	static const int MAX_DEPTH;				// Most ticks of updates the buffer aims to hold
+	static const int CATCH_UP_SLACK;		// Updates over the target before the engine catches up
+	static const double JITTER_GAIN;		// Gain of the interarrival jitter
+	static const double JITTER_MULTIPLIER;	// Jitters of headroom the buffer aims to hold
+
+private:
+
+	bool HasReceived(sf::Uint32 sequence);
+	bool IsQueued(sf::Uint32 sequence);
+	void UpdateTarget(void);
+
+	std::list<PaddleUpdate> m_inputs;	// Oldest sequence first
+	InputStats m_stats;
+
+	// Sequence Data
+	bool m_haveReceived;
+	sf::Uint32 m_highestReceived;
+	sf::Uint64 m_receivedMask;			// Bit n set if m_highestReceived - n has been received
+	sf::Uint32 m_lastTaken;				// Sequence of the last update given to the engine
+
+	// Buffer Data
+	bool m_primed;						// False until the buffer has filled to the target
+	bool m_waiting;						// The buffer ran dry and the engine is waiting on an update
+
+	// Jitter Data
+	bool m_haveTransit;					// False until the first update, and after Restart()
+	NetTime m_lastTransit;
+};
+
+#endif
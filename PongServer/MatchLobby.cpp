@@ -0,0 +1,84 @@
+// ================================================================================================
+// Filename: "MatchLobby.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the MatchLobby class. For a class description see the
+// header file "MatchLobby.h"
+// ================================================================================================
+
+#include "MatchLobby.h"
+
+// ===== Constructor ==============================================================================
+// The constructor will start the lobby with no open seat.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+MatchLobby::MatchLobby(void)
+{
+	m_seatOpen = false;
+	m_openShard = 0;
+	m_openSerial = 0;
+}
+
+// ===== Join =====================================================================================
+// Method will find a seat for a player who has joined. If a seat is open, it is given to the
+// caller and closed. Otherwise the caller's new match becomes the open seat.
+//
+// Input:
+//	[IN/OUT] int &shardNumber			- the caller's shard; receives the open seat's shard
+//	[IN/OUT] sf::Uint32 &matchSerial	- the serial the caller will give a new match; receives the
+//										  open seat's match serial
+//
+// Output:
+//	[OUT] bool							- true if an open seat was taken, false if the caller must
+//										  open the new match
+// ================================================================================================
+bool MatchLobby::Join(int &shardNumber, sf::Uint32 &matchSerial)
+{
+	bool taken = false;
+
+	m_lock.lock();
+
+	if(m_seatOpen)
+	{
+		shardNumber = m_openShard;
+		matchSerial = m_openSerial;
+		m_seatOpen = false;
+		taken = true;
+	}
+	else
+	{
+		m_openShard = shardNumber;
+		m_openSerial = matchSerial;
+		m_seatOpen = true;
+	}
+
+	m_lock.unlock();
+
+	return taken;
+}
+
+// ===== Leave ====================================================================================
+// Method will stop offering a match's seat, because the match has been released before it filled.
+// Nothing changes if the open seat belongs to some other match.
+//
+// Input:
+//	[IN] int shardNumber		- the match's shard
+//	[IN] sf::Uint32 matchSerial	- the match's serial
+//
+// Output: none
+// ================================================================================================
+void MatchLobby::Leave(int shardNumber, sf::Uint32 matchSerial)
+{
+	m_lock.lock();
+
+	if(m_seatOpen && (m_openShard == shardNumber) && (m_openSerial == matchSerial))
+	{
+		m_seatOpen = false;
+	}
+
+	m_lock.unlock();
+}
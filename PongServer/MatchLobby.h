@@ -0,0 +1,63 @@
+// ================================================================================================
+// Filename: "MatchLobby.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The MatchLobby class pairs players across every ServerShard. One instance is shared by all of
+// them. Each shard seats the players it accepts in matches of its' own, but the operating system
+// hands connections to whichever shard is waiting in accept, so two players who join one after the
+// other usually land on different shards. Left to itself each shard would open a match for its'
+// player, and neither match would ever fill.
+//
+// The lobby remembers the one open seat in the server: the shard and match serial of a match with
+// a player seated and waiting for an opponent. A shard that finishes a JOIN handshake calls Join().
+// If a seat is open, the caller is given it, and the seat is no longer open; the shard passes the
+// player on to the seat's shard, which may be itself. If no seat is open, the caller's new match
+// becomes the open seat, and the shard opens it with the player seated.
+//
+// A match whose waiting player leaves before the match fills calls Leave(), so the lobby stops
+// offering its' seat. A player passed on to a seat that has gone in the meantime just joins again
+// on the shard it was passed to.
+//
+// Joins are rare next to match traffic, so everything is guarded by a single lock.
+// ================================================================================================
+
+#ifndef MATCHLOBBY_H
+#define MATCHLOBBY_H
+
+#include <mutex>
+#include <SFML\Config.hpp>
+
+class MatchLobby
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	MatchLobby(void);
+	~MatchLobby(void){}
+
+	// Method Prototypes
+	bool Join(int &shardNumber, sf::Uint32 &matchSerial);
+	void Leave(int shardNumber, sf::Uint32 matchSerial);
+
+private:
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	std::mutex m_lock;
+	bool m_seatOpen;
+	int m_openShard;				// Shard holding the open seat
+	sf::Uint32 m_openSerial;		// Serial of the match, on that shard, with the open seat
+};
+
+#endif
@@ -16,29 +16,31 @@ const int SNetworkController::LISTENING_PORT = 8585;
 const int SNetworkController::MAX_PLAYERS = 2;
 
 // ===== Constructor ==============================================================================
-// The constructor set up the listener that waits for clients to connect to the server.
+// The constructor will start the match with both player slots empty. Clients are attached with
+// AddClient() by the ServerShard that accepted them, or directly by the caller when the clients run
+// in the same process, for example through a LoopbackTransport.
 //
 // The Constructor will receive a a const pointer to the engines game clock. This clock will be used
 // to syncronize the server with the client.
 // 
 // Input:
-//	[IN] sf::Clock *gameClock			- the game engines clock
+//	[IN] sf::Clock *gameClock				- the game engines clock
+//	[IN] ServerConfig *config				- the options the server was started with
+//	[IN] std::function<void()> onReady		- called when a client becomes ready, may be nullptr
 //
 // Output: none
 //
 //  ===============================================================================================
-SNetworkController::SNetworkController(const sf::Clock *gameClock, bool usingArtLatency) : m_gameClock(gameClock)
+SNetworkController::SNetworkController(const sf::Clock *gameClock, const ServerConfig *config,
+									   std::function<void(void)> onReady) : m_gameClock(gameClock)
 {
 	// Initialize Data Members
-	m_ready = false;
 	m_numPlayers = 0;
-	m_usingArtLatency = usingArtLatency;
+	m_config = config;
+	m_onReady = onReady;
 
 	m_player1 = NULL;
 	m_player2 = NULL;
-
-	// Start Listening Thread
-	m_listeningThread = new std::thread(&SNetworkController::ListenForClients, this);
 }
 
 // ===== Destructor ===============================================================================
@@ -46,75 +48,92 @@ SNetworkController::SNetworkController(const sf::Clock *gameClock, bool usingArt
 // ================================================================================================
 SNetworkController::~SNetworkController(void)
 {
-	StopListeningThread();
-	delete m_listeningThread;
 	delete m_player1;
 	delete m_player2;
 }
 
-// ===== ListenForClients =========================================================================
-// This is the method that the listening thread will continously loop through until two clients 
-// have connected to the server. This method and the thread running it will assign ClientHandlers
-// to any clients requesting a connection. Once two players have connected, the method will set 
-// the m_ready member to true and the thread will be allowed to terminate.
-// 
-// Input: none
-// Output: none
-//  ===============================================================================================
-void SNetworkController::ListenForClients(void)
+// ===== AddClient ================================================================================
+// Method will create a ClientHandler for a newly connected client and assign it the next free
+// player slot. The ClientHandler takes ownership of the transport. If both slots are taken the
+// method will return false and the caller keeps ownership.
+//
+// Input:
+//	[IN] Transport *transport		- the connected transport for the new client
+//	[IN] sf::Uint32 sessionToken	- the token the client can use to resume its' slot
+//
+// Output:
+//	[OUT] bool						- true if the client was assigned a slot, false otherwise
+// ================================================================================================
+bool SNetworkController::AddClient(Transport *transport, sf::Uint32 sessionToken)
 {
-	sf::TcpSocket *tempClient = new sf::TcpSocket;
-
+	if(m_numPlayers == 0)
+	{
+		std::cout << "Player one has joined the game.\n";
 
-	// Set-Up the port listener
-	if(m_listener.listen(LISTENING_PORT) != sf::Socket::Done)
+		// Create Client Handler for Player 1
+		m_player1 = new ClientHandler(1, transport, sessionToken, m_gameClock, m_config, m_onReady);
+	}
+	else if(m_numPlayers == 1)
 	{
-		std::cout << "Error establishing listener.\n";
+		std::cout << "Player Two has joined the game. Starting Game.\n";
+
+		// Create Client Handler for Player 2
+		m_player2 = new ClientHandler(2, transport, sessionToken, m_gameClock, m_config, m_onReady);
 	}
 	else
 	{
-		std::cout << "Listener established on port.\n";
+		return false;
 	}
 
-	// Loop until MAX_PLAYERS reached
-	while(!m_ready)
-	{
-		std::cout << "Waiting For Clients...\n";
+	m_numPlayers++;
 
-		if(m_listener.accept(*tempClient) == sf::Socket::Done)	// BLOCKING
-		{
-			// Client Successfully Connected
-			if(m_numPlayers == 0)
-			{
-				std::cout << "Player one has joined the game.\n";
-
-				// Create Client Handler for Player 1
-				m_player1 = new ClientHandler(1, tempClient, m_gameClock, m_usingArtLatency);
-
-				// Create a new TcpSocket for the next player; Client Handler will release the memory
-				tempClient = new sf::TcpSocket;
-			}
-			else if(m_numPlayers == 1)
-			{
-				std::cout << "Player Two has joined the game. Starting Game.\n";
-
-				// Create Client Handler for Player 2
-				m_player2 = new ClientHandler(2, tempClient, m_gameClock, m_usingArtLatency);
-
-				tempClient = NULL;
-
-				m_ready = true;
-			}
+	return true;
+}
 
-			m_numPlayers++;
-		}
+// ===== ResumeClient =============================================================================
+// Method will hand a reconnected transport to the client handler that owns the session token. If
+// no handler in this match owns the token, the method will return false and the caller keeps
+// ownership of the transport.
+//
+// Input:
+//	[IN] sf::Uint32 sessionToken	- the token the client sent in its' RESUME
+//	[IN] Transport *transport		- the reconnected transport
+//
+// Output:
+//	[OUT] bool						- true if the session was resumed, false otherwise
+// ================================================================================================
+bool SNetworkController::ResumeClient(sf::Uint32 sessionToken, Transport *transport)
+{
+	if((m_player1 != NULL) && (m_player1->GetSessionToken() == sessionToken))
+	{
+		return m_player1->Resume(transport);
+	}
+	else if((m_player2 != NULL) && (m_player2->GetSessionToken() == sessionToken))
+	{
+		return m_player2->Resume(transport);
 	}
 
+	return false;
+}
+
+// ===== OwnsSession ==============================================================================
+// Will check if either client in this match was given the session token.
+//
+// Input:
+//	[IN] sf::Uint32 sessionToken	- the token to look for
+//
+// Output:
+//	[OUT] bool						- true if a client in this match holds the token
+// ================================================================================================
+bool SNetworkController::OwnsSession(sf::Uint32 sessionToken)
+{
+	return (((m_player1 != NULL) && (m_player1->GetSessionToken() == sessionToken)) ||
+			((m_player2 != NULL) && (m_player2->GetSessionToken() == sessionToken)));
 }
 
 // ===== SendGameState ============================================================================
-// Method will pass the current state to both client handlers so they can send it to their respective
-// clients.
+// Method will stamp the current state with the server clock and pass it to both client handlers so
+// they can send it to their respective clients.
 //
 // Input:
 //	[IN] GameState currentState	- the current game state
@@ -123,6 +142,8 @@ void SNetworkController::ListenForClients(void)
 // ================================================================================================
 void SNetworkController::SendGameData(GameData currentState)
 {
+	currentState.serverTime = TimeBase::Now(m_gameClock);
+
 	m_player1->SendGameData(currentState);
 	m_player2->SendGameData(currentState);
 }
@@ -135,45 +156,42 @@ void SNetworkController::SendGameData(GameData currentState)
 // ================================================================================================
 void SNetworkController::Disconnect(void)
 {
-	m_player1->Disconnect();
-	m_player2->Disconnect();
-}
+	if(m_player1 != NULL)
+	{
+		m_player1->Disconnect();
+	}
 
-// ===== StopThread ===============================================================================
-// Method will terminate the listening thread.
-//
-// Input: none
-// Output: none
-// ================================================================================================
-void SNetworkController::StopListeningThread()
-{
-	if (m_listeningThread != NULL)
+	if(m_player2 != NULL)
 	{
-		m_ready = true;				// Set Thread-Loop conditional to false
-		m_listeningThread->join();	// Wait for thread to end
+		m_player2->Disconnect();
 	}
 }
 
-// ===== GetPlayerPaddleData ======================================================================
-// The method will call the appropriate client handlers GetPaddleData method and place the data
-// into the reference. If the client handlers are NULL then the method will return false.
+// ===== GetPlayerInputs ==========================================================================
+// The method will call the appropriate client handlers GetPaddleInputs method and place the
+// queued updates into the list. If the client handlers are NULL then the method will return false.
+// The client stamps its' updates with its' own clock; the timestamps are mapped onto the server
+// clock with the client handler's current clock estimate, skew included.
 //
 // Input:
-//	[IN] int player						- the player to whom the data belongs
-//	[IN/OUT] PaddleUpdate &engineUpdate	- the reference to store the data in
+//	[IN] int player								- the player to whom the data belongs
+//	[IN/OUT] std::list<PaddleUpdate> &inputs	- receives the updates, oldest first
+//	[IN] int maxInputs							- the most updates to take
 //
 // Output
-//	[OUT] bool							- true if new data was stored, false otherwise
+//	[OUT] bool									- true if any updates were taken, false otherwise
 // ================================================================================================
-bool SNetworkController::GetPlayerPaddleData(int player, PaddleUpdate &engineUpdate)
+bool SNetworkController::GetPlayerInputs(int player, std::list<PaddleUpdate> &inputs, int maxInputs)
 {
-	PaddleUpdate temp;
+	bool taken = false;
+	ClockEstimate estimate;
 
 	if(player == 1)
 	{
 		if(m_player1 != NULL)
 		{
-			temp = m_player1->GetPaddleData();
+			taken = m_player1->GetPaddleInputs(inputs, maxInputs);
+			estimate = m_player1->GetClockEstimate();
 		}
 		else
 		{
@@ -185,7 +203,8 @@ bool SNetworkController::GetPlayerPaddleData(int player, PaddleUpdate &engineUpd
 	{
 		if(m_player2 != NULL)
 		{
-			temp = m_player2->GetPaddleData();
+			taken = m_player2->GetPaddleInputs(inputs, maxInputs);
+			estimate = m_player2->GetClockEstimate();
 		}
 		else
 		{
@@ -199,9 +218,58 @@ bool SNetworkController::GetPlayerPaddleData(int player, PaddleUpdate &engineUpd
 		return false;
 	}
 
-	engineUpdate.m_paddleLoc = temp.m_paddleLoc;
-	engineUpdate.m_paddleDir = temp.m_paddleDir;
-	engineUpdate.m_timestamp = temp.m_timestamp;
+	for(std::list<PaddleUpdate>::iterator it = inputs.begin(); it != inputs.end(); it++)
+	{
+		it->m_timestamp = estimate.ToServerTime(it->m_timestamp);
+	}
+
+	return taken;
+}
+
+// ===== GetLinkStats =============================================================================
+// The method will place the latest measurements of a player's connection into the reference.
+//
+// Input:
+//	[IN] int player				- the player whose connection to measure
+//	[IN/OUT] LinkStats &stats	- the reference to store the measurements in
+//
+// Output
+//	[OUT] bool					- true if the player has a client handler, false otherwise
+// ================================================================================================
+bool SNetworkController::GetLinkStats(int player, LinkStats &stats)
+{
+	ClientHandler *handler = ((player == 1) ? m_player1 : ((player == 2) ? m_player2 : NULL));
+
+	if(handler == NULL)
+	{
+		return false;
+	}
+
+	stats = handler->GetLinkStats();
+
+	return true;
+}
+
+// ===== GetInputStats ============================================================================
+// The method will place a player's input queue counters into the reference.
+//
+// Input:
+//	[IN] int player				- the player whose inputs to count
+//	[IN/OUT] InputStats &stats	- the reference to store the counters in
+//
+// Output
+//	[OUT] bool					- true if the player has a client handler, false otherwise
+// ================================================================================================
+bool SNetworkController::GetInputStats(int player, InputStats &stats)
+{
+	ClientHandler *handler = ((player == 1) ? m_player1 : ((player == 2) ? m_player2 : NULL));
+
+	if(handler == NULL)
+	{
+		return false;
+	}
+
+	stats = handler->GetInputStats();
 
 	return true;
 }
@@ -245,6 +313,11 @@ bool SNetworkController::IsReady(void)
 // ================================================================================================
 bool SNetworkController::ClientsConnected(void)
 {
+	if((m_player1 == NULL) || (m_player2 == NULL))
+	{
+		return false;
+	}
+
 	if(m_player1->IsConnected() && m_player2->IsConnected())
 	{
 		return true;
@@ -253,4 +326,53 @@ bool SNetworkController::ClientsConnected(void)
 	{
 		return false;
 	}
-}
\ No newline at end of file
+}
+
+// ===== ClientDropped ============================================================================
+// Will check if any client that has joined the match has since lost its' connection, whether or not
+// the match is full yet.
+//
+// Input:none
+//
+// Output:
+//	[OUT] bool		- true if a joined client is no longer connected, false otherwise
+//
+// ================================================================================================
+bool SNetworkController::ClientDropped(void)
+{
+	if((m_player1 != NULL) && !m_player1->IsConnected())
+	{
+		return true;
+	}
+
+	if((m_player2 != NULL) && !m_player2->IsConnected())
+	{
+		return true;
+	}
+
+	return false;
+}
+
+// ===== SessionExpired ===========================================================================
+// Will check if a dropped client has run out of time to resume its' session.
+//
+// Input:none
+//
+// Output:
+//	[OUT] bool		- true if either client's session has expired, false otherwise
+//
+// ================================================================================================
+bool SNetworkController::SessionExpired(void)
+{
+	if((m_player1 != NULL) && m_player1->IsExpired())
+	{
+		return true;
+	}
+
+	if((m_player2 != NULL) && m_player2->IsExpired())
+	{
+		return true;
+	}
+
+	return false;
+}
@@ -6,22 +6,30 @@
 // ================================================================================================
 // Class Description:
 // 
-// The SNetworkController will be responsible for setting up the initial listener, accepting client
-// connection requests, receive client data, and transmitting game state data to the clients.
+// The SNetworkController will be responsible for the two client connections of a single match. It
+// will assign connected clients to player slots, receive client data, and transmit game state data
+// to the clients. Accepting connections is done by the ServerShard that owns the match, which hands
+// each accepted Transport to AddClient().
 //
 // The SNetworkController will abstract the individual client connection away from the game engine.
 // all requests to send/receive data should be sent through the SNetworkController.
+//
+// The owner can pass a callback that is called, from a client's listening thread, whenever one of
+// the match's clients becomes ready, so it can start the match without polling IsReady().
 // ================================================================================================
 
 #ifndef SNETWORKCONTROLLER_H
 #define SNETWORKCONTROLLER_H
 
-#include <Thread>
 #include <string>
-#include <SFML\Network\TcpListener.hpp>
+#include <functional>
+#include <list>
+#include "ServerConfig.h"
 #include "ClientHandler.h"
+#include "Transport.h"
 #include "GameData.h"
 #include "PaddleUpdate.h"
+#include "NetTime.h"
 
 class SNetworkController
 {
@@ -39,25 +47,31 @@ public:
 	// ============================================================================================
 
 	// Constructor/Destructor Prototypes
-	SNetworkController(const sf::Clock *gameClock, bool usingArtLatency);
+	SNetworkController(const sf::Clock *gameClock, const ServerConfig *config,
+					   std::function<void(void)> onReady = nullptr);
 	~SNetworkController(void);
 
 	// Method Prototypes
-	void ListenForClients(void);
+	bool AddClient(Transport *transport, sf::Uint32 sessionToken);
+	bool ResumeClient(sf::Uint32 sessionToken, Transport *transport);
+	bool OwnsSession(sf::Uint32 sessionToken);
 	void SendGameData(GameData currentState);
 	void Disconnect(void);
-	void StopListeningThread(void);
-	bool GetPlayerPaddleData(int player, PaddleUpdate &engineUpdate);
+	bool GetPlayerInputs(int player, std::list<PaddleUpdate> &inputs, int maxInputs);
+	bool GetLinkStats(int player, LinkStats &stats);
+	bool GetInputStats(int player, InputStats &stats);
 	bool IsReady();
 	bool ClientsConnected(void);
+	bool ClientDropped(void);
+	bool SessionExpired(void);
 
-private:
+	// Inlined Methods
+	bool IsFull(void){ return (m_numPlayers >= MAX_PLAYERS); }
+	int GetPlayerCount(void){ return m_numPlayers; }
+	NetTime GetServerTime(void){ return TimeBase::Now(m_gameClock); }
+	const ServerConfig* GetConfig(void){ return m_config; }
 
-	// ============================================================================================
-	// Methods
-	// ============================================================================================
-
-	void SocketListening(void);
+private:
 
 	// ============================================================================================
 	// Members
@@ -65,13 +79,11 @@ private:
 
 	// Game Data
 	const sf::Clock *m_gameClock;
+	const ServerConfig *m_config;
+	std::function<void(void)> m_onReady;	// Called when a client becomes ready
 
-	// Connection Request Listening Data Members
-	std::thread *m_listeningThread;
-	sf::TcpListener m_listener;
+	// Player Slot Data Members
 	int m_numPlayers;
-	bool m_ready;
-	bool m_usingArtLatency;
 
 	// Client Handlers
 	ClientHandler *m_player1;
@@ -0,0 +1,172 @@
+// ================================================================================================
+// Filename: "ServerConfig.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ServerConfig class. For a class description see
+// the header file "ServerConfig.h"
+// ================================================================================================
+
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include "ServerConfig.h"
+
+// ===== Default Constructor ======================================================================
+// The default constructor will set every option to its' default.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+ServerConfig::ServerConfig(void)
+{
+	// Shard Options
+	numShards = std::thread::hardware_concurrency();
+	benchClients = 0;
+
+	// Network Emulation Options
+	NetworkProfile::Find("legacy", netProfile);
+	netProfileGiven = false;
+	netSeed = 1;
+
+	// Connection Options
+	heartbeatInterval = 250;
+	idleTimeout = 1500;
+	halfOpenTimeout = 1500;
+	resumeGrace = 10000;
+	syncInterval = 1000;
+	maxSyncInterval = 16000;
+	linkLogInterval = 0;
+	minSnapshotRate = 15;
+
+	// Game Options
+	maxRewind = 100;
+
+	// Admission Options
+	maxClients = 512;
+	maxPendingHandshakes = 64;
+	handshakeTimeout = 1000;
+	acceptRate = 5.0f;
+	acceptBurst = 10;
+}
+
+// ===== ParseOption ==============================================================================
+// Method will read the command line option at argv[index], along with its' value, if it is one of
+// the server's options. The index is left on the last argument consumed.
+//
+// Input:
+//	[IN] int argc			- the number of command line arguments
+//	[IN] char* argv[]		- the command line arguments
+//	[IN/OUT] int &index		- the argument to read
+//
+// Output:
+//	[OUT] bool				- true if the option was recognized, false otherwise
+// ================================================================================================
+bool ServerConfig::ParseOption(int argc, char* argv[], int &index)
+{
+	if((index + 1) >= argc)
+	{
+		return false;
+	}
+
+	if(strcmp(argv[index], "-shards") == 0)
+	{
+		numShards = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-bench") == 0)
+	{
+		benchClients = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-heartbeat") == 0)
+	{
+		heartbeatInterval = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-idle-timeout") == 0)
+	{
+		idleTimeout = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-half-open-timeout") == 0)
+	{
+		halfOpenTimeout = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-resume-grace") == 0)
+	{
+		resumeGrace = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-sync-interval") == 0)
+	{
+		syncInterval = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-max-sync-interval") == 0)
+	{
+		maxSyncInterval = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-link-log") == 0)
+	{
+		linkLogInterval = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-min-snapshot-rate") == 0)
+	{
+		minSnapshotRate = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-max-rewind") == 0)
+	{
+		maxRewind = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-net-profile") == 0)
+	{
+		if(NetworkProfile::Find(argv[++index], netProfile))
+		{
+			netProfileGiven = true;
+		}
+		else
+		{
+			std::cout << "Unknown network profile " << argv[index] << ", choose from: ";
+			NetworkProfile::PrintProfiles(std::cout);
+			std::cout << "\n";
+		}
+	}
+	else if(strcmp(argv[index], "-net-trace") == 0)
+	{
+		if(!netTrace.Load(argv[++index]))
+		{
+			std::cout << "Could not read network trace " << argv[index] << "\n";
+		}
+	}
+	else if(strcmp(argv[index], "-record-trace") == 0)
+	{
+		recordTrace = argv[++index];
+	}
+	else if(strcmp(argv[index], "-net-seed") == 0)
+	{
+		netSeed = (unsigned int)strtoul(argv[++index], NULL, 10);
+	}
+	else if(strcmp(argv[index], "-max-clients") == 0)
+	{
+		maxClients = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-max-pending") == 0)
+	{
+		maxPendingHandshakes = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-handshake-timeout") == 0)
+	{
+		handshakeTimeout = atoi(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-accept-rate") == 0)
+	{
+		acceptRate = (float)atof(argv[++index]);
+	}
+	else if(strcmp(argv[index], "-accept-burst") == 0)
+	{
+		acceptBurst = atoi(argv[++index]);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
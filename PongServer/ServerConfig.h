@@ -0,0 +1,76 @@
+// ================================================================================================
+// Filename: "ServerConfig.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ServerConfig class holds the options the server was started with. ServerStart fills one in
+// from the command line and every ServerShard, SNetworkController and ClientHandler keeps a const
+// pointer to it, so a new option only has to be added here and read where it is used.
+//
+// The constructor sets every option to its' default. To increase simplicity, the ServerConfig class
+// will make all members public.
+// ================================================================================================
+
+#ifndef SERVERCONFIG_H
+#define SERVERCONFIG_H
+
+#include <string>
+#include "NetworkProfile.h"
+#include "NetworkTrace.h"
+
+class ServerConfig
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ServerConfig(void);
+	~ServerConfig(void){}
+
+	// Method Prototypes
+	bool ParseOption(int argc, char* argv[], int &index);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Shard Options
+	int numShards;						// Number of shards to run, one per core by default
+	int benchClients;					// Loopback clients to benchmark the shards with, 0 to serve
+
+	// Network Emulation Options
+	NetworkProfile netProfile;			// Network conditions to emulate on every connection
+	bool netProfileGiven;				// True if the profile was picked on the command line
+	unsigned int netSeed;				// Seed for the emulator's random choices, so a run can be repeated
+	NetworkTrace netTrace;				// Trace to replay in place of the profile's latency and loss
+	std::string recordTrace;			// Prefix of the trace file recorded for each client, empty for none
+
+	// Connection Options
+	int heartbeatInterval;				// Time, in ms, a client may go without hearing from the server
+	int idleTimeout;					// Time, in ms, without receiving anything before a client is dropped
+	int halfOpenTimeout;				// Time, in ms, a send may stay stuck before a client is dropped
+	int resumeGrace;					// Time, in ms, a dropped client has to reconnect and resume its' slot
+	int syncInterval;					// Time, in ms, between clock sync rounds once a client is ready
+	int maxSyncInterval;				// Longest time, in ms, the sync interval backs off to
+	int linkLogInterval;				// Time, in ms, between prints of each client's link telemetry, 0 for off
+	int minSnapshotRate;				// Fewest GAME_UPDATEs per second a congested client is backed off to
+
+	// Game Options
+	int maxRewind;						// Longest time, in ms, back a paddle hit may be judged, 0 for off
+
+	// Admission Options
+	int maxClients;						// Most clients seated or handshaking across the server
+	int maxPendingHandshakes;			// Most connections that may be handshaking at once
+	int handshakeTimeout;				// Time, in ms, a new connection has to send its' JOIN or RESUME
+	float acceptRate;					// Connections per second allowed from a single address
+	int acceptBurst;					// Connections a single address may make at once before being limited
+};
+
+#endif
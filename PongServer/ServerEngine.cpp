@@ -9,10 +9,14 @@
 // ================================================================================================
 
 #define _USE_MATH_DEFINES
+#include <math.h>
 #include <iostream>
 #include "ServerEngine.h"
 #include "Calculator.h"
 
+// Initialize Static Constants
+const int ServerEngine::MAX_INPUTS_PER_TICK = 2;
+
 // ===== Constructor ==============================================================================
 // The constructor will initialize all game values.
 //
@@ -23,6 +27,7 @@ ServerEngine::ServerEngine(SNetworkController *networkControl) : m_networkContro
 {
 	// Initialize Engine Members
 	m_running = false;
+	m_paused = false;
 	m_engineClock.restart();
 
 	m_leftPaddle = new Paddle(1);
@@ -30,23 +35,30 @@ ServerEngine::ServerEngine(SNetworkController *networkControl) : m_networkContro
 
 	m_player1Scoring = false;
 	m_player2Scoring = false;
+	m_player1LastUpdate = 0;
+	m_player2LastUpdate = 0;
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will ensure all dynamically allocated memory is released.
+// ================================================================================================
+ServerEngine::~ServerEngine(void)
+{
+	delete m_leftPaddle;
+	delete m_rightPaddle;
 }
 
 // ===== Run ======================================================================================
-// This method will be the "infinite" loop that starts when the engine starts. Every iteration it
-// will check for data from the clients, update the game state based on client data, and send the
-// current GameData to the clients.
+// This method will be the "infinite" loop that starts when the engine starts. It will start the
+// match and then step it at ENGINE_SPEED until the match ends. A ServerShard running many matches
+// calls Start() and Step() itself instead.
 //
 // Input: none
 // Output: none
 // ================================================================================================
 void ServerEngine::Run(void)
 {
-	m_currentState.startGame = true;
-	m_ball.Serve(0);
-	m_currentState.ballAngle = m_ball.GetMoveAngle();
-	m_networkControl->SendGameData(m_currentState);
-	m_running = true;
+	Start();
 
 	while(m_running)
 	{
@@ -60,95 +72,193 @@ void ServerEngine::Run(void)
 			m_engineClock.restart();
 		}
 
-		if(!m_networkControl->ClientsConnected())
+		Step();
+	}
+}
+
+// ===== Start ====================================================================================
+// This method will serve the ball and send the first GameData, which tells the clients to start.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerEngine::Start(void)
+{
+	m_currentState.startGame = true;
+	m_ball.Serve(0);
+	m_currentState.ballAngle = m_ball.GetMoveAngle();
+	RecordBall();
+	m_networkControl->SendGameData(m_currentState);
+	m_running = true;
+}
+
+// ===== Step =====================================================================================
+// This method will run a single engine cycle. It will check for data from the clients, update the
+// game state based on client data, and send the current GameData to the clients. If a client is
+// waiting to resume, the cycle only sends the paused GameData.
+//
+// Input: none
+//
+// Output:
+//	[OUT] bool	- true if the match is still running, false once it has ended
+// ================================================================================================
+bool ServerEngine::Step(void)
+{
+	if(m_networkControl->SessionExpired())
+	{
+		std::cout << "A client has disconnected, stopping engine.\n";
+		m_running = false;
+	}
+	else if(!m_networkControl->ClientsConnected())
+	{
+		if(!m_paused)
 		{
-			std::cout << "A client has disconnected, stopping engine.\n";
-			m_running = false;
+			std::cout << "A client has dropped, pausing until it resumes.\n";
+			m_paused = true;
 		}
 
-		// Update HealthPack
-		m_healthPack.Update();
-		m_currentState.healthPackSpawned = m_healthPack.Spawned();
+		GetClientPaddleData(false);		// Acknowledged, but nothing moves
+		m_currentState.serverTick++;
+		m_networkControl->SendGameData(m_currentState);
 
-		// Check For Client Data
-		GetClientPaddleData();
-		UpdatePositions();
+		return m_running;
+	}
+	else if(m_paused)
+	{
+		std::cout << "Client resumed, unpausing.\n";
+		m_paused = false;
+	}
 
-		if(m_player1Scoring)
-		{
-			m_currentState.playerOneScore += 1;
+	// Update HealthPack
+	m_healthPack.Update();
+	m_currentState.healthPackSpawned = m_healthPack.Spawned();
 
-			if(m_currentState.playerOneScore >= GameData::MAX_POINTS)
-			{
-				m_currentState.gameWon = true;
-				m_currentState.winningPlayer = 1;
-				m_running = false;
-			}
+	// Check For Client Data
+	GetClientPaddleData(true);
+	UpdatePositions();
 
-			std::cout << "Player 1 Scored.\n";
-			m_currentState.playerOneHealth = 100;
-			m_currentState.playerTwoHealth = 100;
-			m_player1Scoring = false;
-			m_ball.Serve(1);
-		}
-		else if(m_player2Scoring)
+	if(m_player1Scoring)
+	{
+		m_currentState.playerOneScore += 1;
+
+		if(m_currentState.playerOneScore >= GameData::MAX_POINTS)
 		{
-			m_currentState.playerTwoScore += 1;
+			m_currentState.gameWon = true;
+			m_currentState.winningPlayer = 1;
+			m_running = false;
+		}
 
-			if(m_currentState.playerTwoScore >= GameData::MAX_POINTS)
-			{
-				m_currentState.gameWon = true;
-				m_currentState.winningPlayer = 2;
-				m_running = false;
-			}
+		std::cout << "Player 1 Scored.\n";
+		m_currentState.playerOneHealth = 100;
+		m_currentState.playerTwoHealth = 100;
+		m_player1Scoring = false;
+		m_ball.Serve(1);
+		m_ballHistory.clear();
+	}
+	else if(m_player2Scoring)
+	{
+		m_currentState.playerTwoScore += 1;
 
-			std::cout << "Player 2 Scored.\n";
-			m_currentState.playerOneHealth = 100;
-			m_currentState.playerTwoHealth = 100;
-			m_player2Scoring = false;
-			m_ball.Serve(2);
+		if(m_currentState.playerTwoScore >= GameData::MAX_POINTS)
+		{
+			m_currentState.gameWon = true;
+			m_currentState.winningPlayer = 2;
+			m_running = false;
 		}
 
-		// Send GameState Update
-		UpdateState();
-		m_networkControl->SendGameData(m_currentState);
+		std::cout << "Player 2 Scored.\n";
+		m_currentState.playerOneHealth = 100;
+		m_currentState.playerTwoHealth = 100;
+		m_player2Scoring = false;
+		m_ball.Serve(2);
+		m_ballHistory.clear();
 	}
+
+	// Send GameState Update
+	m_currentState.serverTick++;
+	UpdateState();
+	RecordBall();
+	m_networkControl->SendGameData(m_currentState);
+
+	return m_running;
 }
 
 // ===== GetClientPaddleData ======================================================================
-// The method will retreive the latest paddle information from the client handlers. It will then
-// use this information to update the current game state. The method must check if the client
-// handler returned NULL, which means there is no new paddle data.
+// The method will retreive the queued paddle updates from the client handlers, up to
+// MAX_INPUTS_PER_TICK per player, and apply them to the paddles and the current game state.
+//
+// Input:
+//	[IN] bool apply	- false to acknowledge the updates without moving the paddles, while paused
 //
-// Input: none
 // Output: none
 // ================================================================================================
-void ServerEngine::GetClientPaddleData(void)
+void ServerEngine::GetClientPaddleData(bool apply)
 { 
-	PaddleUpdate temp;
+	std::list<PaddleUpdate> inputs;
 
 	// Get Player 1's Data
-	if(m_networkControl->GetPlayerPaddleData(1, temp))
+	if(m_networkControl->GetPlayerInputs(1, inputs, MAX_INPUTS_PER_TICK))
 	{
-		m_leftPaddle->setPosition(m_leftPaddle->getPosition().x, temp.m_paddleLoc);
-		m_currentState.playerOnePaddlePosition = temp.m_paddleLoc;
-		m_currentState.playerOneDirection = temp.m_paddleDir;
-		m_player1LastUpdate = temp.m_timestamp;
+		ApplyInputs(m_leftPaddle, inputs, m_currentState.playerOnePaddlePosition, m_currentState.playerOneDirection,
+					m_currentState.playerOneLastInput, m_player1LastUpdate, apply);
 	}
 
+	inputs.clear();
+
 	// Get Player 2's Data
-	if(m_networkControl->GetPlayerPaddleData(2, temp))
+	if(m_networkControl->GetPlayerInputs(2, inputs, MAX_INPUTS_PER_TICK))
+	{
+		ApplyInputs(m_rightPaddle, inputs, m_currentState.playerTwoPaddlePosition, m_currentState.playerTwoDirection,
+					m_currentState.playerTwoLastInput, m_player2LastUpdate, apply);
+	}
+}
+
+// ===== ApplyInputs ==============================================================================
+// The method will move a paddle one cycle for each of a player's paddle updates, in order, the same
+// way the client moves it, and record the result in the game state. Updates the server has already
+// applied, repeated after a resume, are skipped.
+//
+// Input:
+//	[IN] Paddle *paddle							- the player's paddle
+//	[IN] std::list<PaddleUpdate> &inputs		- the player's updates, oldest first
+//	[IN/OUT] float &position					- the game state's paddle position
+//	[IN/OUT] int &direction						- the game state's paddle direction
+//	[IN/OUT] sf::Uint32 &lastInput				- the game state's last applied sequence
+//	[IN/OUT] NetTime &lastUpdate				- server time the client sent the last applied update
+//	[IN] bool apply								- false to acknowledge without moving
+//
+// Output: none
+// ================================================================================================
+void ServerEngine::ApplyInputs(Paddle *paddle, std::list<PaddleUpdate> &inputs, float &position, int &direction,
+							   sf::Uint32 &lastInput, NetTime &lastUpdate, bool apply)
+{
+	for(std::list<PaddleUpdate>::iterator it = inputs.begin(); it != inputs.end(); it++)
 	{
-		m_rightPaddle->setPosition(m_rightPaddle->getPosition().x, temp.m_paddleLoc);
-		m_currentState.playerTwoPaddlePosition = temp.m_paddleLoc;;
-		m_currentState.playerTwoDirection = temp.m_paddleDir;
-		m_player2LastUpdate = temp.m_timestamp;
+		if((sf::Int32)(it->m_sequence - lastInput) <= 0)
+		{
+			continue;		// Already applied
+		}
+
+		if(apply && (it->m_paddleDir == Paddle::UP))
+		{
+			paddle->MoveUp(1);
+		}
+		else if(apply && (it->m_paddleDir == Paddle::DOWN))
+		{
+			paddle->MoveDown(1);
+		}
+
+		direction = (apply ? it->m_paddleDir : (int)Paddle::STILL);
+		lastInput = it->m_sequence;
+		lastUpdate = it->m_timestamp;
 	}
+
+	position = paddle->getPosition().y;
 }
 
 // ===== UpdatePositions ==========================================================================
-// This method will update the ball and paddle positions. It will also check for paddle collisions
-// and scores.
+// This method will update the ball and paddle positions. It will also check for paddle collisions,
+// lag compensated, and scores.
 //
 // Input: none
 // Output: none
@@ -161,7 +271,10 @@ void ServerEngine::UpdatePositions(void)
 	// Check for Paddle Collisions
 	if(m_ball.getPosition().x < (GameData::BOARD_WIDTH / 2))		// Check Left Side
 	{
-		if((Calculator::CheckCollision(m_ball, *m_leftPaddle)) && (m_currentState.playerOneHealth > 0))
+		Ball hitBall = m_ball;
+
+		if(((Calculator::CheckCollision(m_ball, *m_leftPaddle)) || RewindHit(m_leftPaddle, m_player1LastUpdate, true, hitBall)) &&
+		   (m_currentState.playerOneHealth > 0))
 		{
 			std::cout << "Left Paddle Hit\n";
 
@@ -169,8 +282,8 @@ void ServerEngine::UpdatePositions(void)
 
 			double newAngle = Calculator::GetAngleTo(m_leftPaddle->getPosition().x, 
 													 m_leftPaddle->getPosition().y,
-													 m_ball.getPosition().x,
-													 m_ball.getPosition().y);
+													 hitBall.getPosition().x,
+													 hitBall.getPosition().y);
 
 			std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
 
@@ -191,7 +304,10 @@ void ServerEngine::UpdatePositions(void)
 	}
 	else if(m_ball.getPosition().x > (GameData::BOARD_WIDTH / 2))	// Check Right Side	
 	{
-		if((Calculator::CheckCollision(m_ball, *m_rightPaddle)) && (m_currentState.playerTwoHealth > 0))
+		Ball hitBall = m_ball;
+
+		if(((Calculator::CheckCollision(m_ball, *m_rightPaddle)) || RewindHit(m_rightPaddle, m_player2LastUpdate, false, hitBall)) &&
+		   (m_currentState.playerTwoHealth > 0))
 		{
 			std::cout << "Right Paddle Hit\n";
 
@@ -199,8 +315,8 @@ void ServerEngine::UpdatePositions(void)
 
 			double newAngle = Calculator::GetAngleTo(m_rightPaddle->getPosition().x, 
 													 m_rightPaddle->getPosition().y,
-													 m_ball.getPosition().x,
-													 m_ball.getPosition().y);
+													 hitBall.getPosition().x,
+													 hitBall.getPosition().y);
 
 			std::cout << "Angle = " << (newAngle * (180 / M_PI)) << " degress.\n";
 
@@ -277,4 +393,104 @@ void ServerEngine::UpdateState(void)
 	m_currentState.ballAngle = m_ball.GetMoveAngle();
 	m_currentState.ballX = m_ball.getPosition().x;
 	m_currentState.ballY = m_ball.getPosition().y;
-}
\ No newline at end of file
+}
+
+// ===== RecordBall ===============================================================================
+// Method will add the ball's position this cycle to the history, and release the samples that are
+// older than the rewind cap. The newest sample at or before the cap is kept, so a rewind all the way
+// to the cap still has a position to judge.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerEngine::RecordBall(void)
+{
+	const ServerConfig *config = m_networkControl->GetConfig();
+
+	if(config->maxRewind <= 0)
+	{
+		return;
+	}
+
+	BallSample sample;
+
+	sample.time = m_networkControl->GetServerTime();
+	sample.x = m_ball.getPosition().x;
+	sample.y = m_ball.getPosition().y;
+
+	m_ballHistory.push_back(sample);
+
+	NetTime oldest = (sample.time - TimeBase::FromMilliseconds(config->maxRewind));
+
+	while((m_ballHistory.size() > 1) && (m_ballHistory[1].time <= oldest))
+	{
+		m_ballHistory.pop_front();
+	}
+}
+
+// ===== RewindHit ================================================================================
+// Method will check if a paddle met the ball where the ball was when the player sent their last
+// applied update, up to the rewind cap ago. Only a ball still travelling toward the paddle can be
+// hit, so a ball that has just bounced off it isn't hit a second time by its' own past.
+//
+// Input:
+//	[IN] Paddle *paddle			- the paddle to check
+//	[IN] NetTime inputTime		- server time the player sent their last applied update, 0 if none
+//	[IN] bool towardLeft		- true for the left paddle, false for the right
+//	[IN/OUT] Ball &hitBall		- receives the ball where the player saw it, if they hit it
+//
+// Output:
+//	[OUT] bool					- true if the player saw the ball meet their paddle, false otherwise
+// ================================================================================================
+bool ServerEngine::RewindHit(Paddle *paddle, NetTime inputTime, bool towardLeft, Ball &hitBall)
+{
+	const ServerConfig *config = m_networkControl->GetConfig();
+
+	if((config->maxRewind <= 0) || (inputTime <= 0) || m_ballHistory.empty())
+	{
+		return false;
+	}
+
+	// Only a ball heading toward the paddle
+	bool movingLeft = (cos(m_ball.GetMoveAngle()) < 0);
+
+	if(movingLeft != towardLeft)
+	{
+		return false;
+	}
+
+	// Rewind to the update, no further than the cap
+	NetTime now = m_networkControl->GetServerTime();
+	NetTime target = inputTime;
+
+	if(target < (now - TimeBase::FromMilliseconds(config->maxRewind)))
+	{
+		target = (now - TimeBase::FromMilliseconds(config->maxRewind));
+	}
+
+	// The newest sample at or before the target is the ball the player saw
+	std::deque<BallSample>::reverse_iterator it = m_ballHistory.rbegin();
+
+	while((it != m_ballHistory.rend()) && (it->time > target))
+	{
+		it++;
+	}
+
+	if(it == m_ballHistory.rend())
+	{
+		return false;
+	}
+
+	Ball rewound = m_ball;
+
+	rewound.setPosition(it->x, it->y);
+
+	if(!Calculator::CheckCollision(rewound, *paddle))
+	{
+		return false;
+	}
+
+	hitBall = rewound;
+
+	return true;
+}
@@ -8,11 +8,32 @@
 // 
 // The ServerEngine class will control all game logic and updates to the game data. It will contain
 // the SNetworkController.
+//
+// While a player is dropped but may still resume, the engine pauses: nothing moves and paddle data
+// is ignored, but the frozen GameData is still sent every cycle. The match only ends once a
+// player's session expires.
+//
+// The server is the authority on the paddles. Each paddle update a client sends is one engine
+// cycle of input; the engine moves the paddle itself, in the order the updates were sent, and
+// records the sequence of the last one applied in the GameData so the client can reconcile its'
+// prediction. At most MAX_INPUTS_PER_TICK updates are applied per player each cycle, so a client
+// whose clock runs fast, or that floods updates, can't move its' paddle faster than the rules
+// allow; the rest wait for the next cycle.
+//
+// Paddle hits are lag compensated. The engine keeps the ball's position at each cycle for the last
+// ServerConfig::maxRewind ms. A paddle update is stamped with the client's clock, mapped onto the
+// server's, so when the ball misses a paddle the engine also checks where the ball was when that
+// player's last applied update was sent: the ball the player was reacting to. If it met the paddle
+// there, the hit counts, bouncing the ball away at the angle the player saw. Updates older than the
+// cap are judged at the cap, and the history is cleared on every serve so a hit is never judged
+// against the ball's previous point.
 // ================================================================================================ 
 
 #ifndef SERVERENGINE_H
 #define SERVERENGINE_H
 
+#include <list>
+#include <deque>
 #include <SFML\System\Clock.hpp>
 #include "GameData.h"
 #include "Paddle.h"
@@ -31,10 +52,15 @@ public:
 
 	// Constructor/Destructor Prototypes
 	ServerEngine(SNetworkController *networkControl);
-	~ServerEngine(void){}
+	~ServerEngine(void);
 
 	// Prototypes
 	void Run(void);
+	void Start(void);
+	bool Step(void);
+
+	// Inlined Methods
+	bool IsRunning(void){ return m_running; }
 
 private:
 
@@ -43,20 +69,28 @@ private:
 	// ============================================================================================
 
 	// Prototypes
-	void GetClientPaddleData(void); 
+	void GetClientPaddleData(bool apply);
+	void ApplyInputs(Paddle *paddle, std::list<PaddleUpdate> &inputs, float &position, int &direction,
+					 sf::Uint32 &lastInput, NetTime &lastUpdate, bool apply);
 	void UpdatePositions(void);
 	void UpdateState(void);
+	void RecordBall(void);
+	bool RewindHit(Paddle *paddle, NetTime inputTime, bool towardLeft, Ball &hitBall);
 
 
 	// ============================================================================================
 	// Class Data Members
 	// ============================================================================================
 
+	// Constants
+	static const int MAX_INPUTS_PER_TICK;	// Most paddle updates applied per player each cycle
+
 	// Network Controller
 	SNetworkController *m_networkControl;
 
 	// Engine Members
 	bool m_running;
+	bool m_paused;
 	sf::Clock m_engineClock;
 
 	// Game Pieces
@@ -67,11 +101,21 @@ private:
 
 	// Game State
 	GameData m_currentState;
-	int m_player1LastUpdate;
-	int m_player2LastUpdate;
+	NetTime m_player1LastUpdate;		// Server time the client sent its' last update
+	NetTime m_player2LastUpdate;
 	bool m_player1Scoring;
 	bool m_player2Scoring;
 
+	// Lag Compensation, a ball position and the server time it was at it
+	struct BallSample
+	{
+		NetTime time;
+		float x;
+		float y;
+	};
+
+	std::deque<BallSample> m_ballHistory;		// Oldest first, covers the last maxRewind ms
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,848 @@
+// ================================================================================================
+// Filename: "ServerShard.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ServerShard class. For a class description see
+// the header file "ServerShard.h"
+// ================================================================================================
+
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <Windows.h>
+#include <SFML\System\Sleep.hpp>
+#include "ServerShard.h"
+#include "TcpTransport.h"
+#include "GameData.h"
+
+// ===== Constructor ==============================================================================
+// The constructor will store the shard's configuration. No threads are started until Start().
+//
+// Either listener may be NULL, in which case the shard only receives clients through AddClient().
+//
+// Input:
+//	[IN] int shardNumber						- which shard this is; also the core it is pinned to
+//	[IN] sf::TcpListener *listener				- the listening socket shared by all shards
+//	[IN] SharedMemoryListener *localListener	- the shared memory listener shared by all shards
+//	[IN] sf::Clock *gameClock					- the server's game clock
+//	[IN] ServerConfig *config					- the options the server was started with
+//	[IN] AdmissionControl *admission			- the admission control shared by all shards
+//
+// Output: none
+// ================================================================================================
+ServerShard::ServerShard(int shardNumber, sf::TcpListener *listener, SharedMemoryListener *localListener,
+						 const sf::Clock *gameClock, const ServerConfig *config, AdmissionControl *admission) : m_gameClock(gameClock)
+{
+	m_shardNumber = shardNumber;
+	m_config = config;
+	m_admission = admission;
+	m_running = false;
+	m_woken = false;
+
+	m_listener = listener;
+	m_localListener = localListener;
+	m_acceptThread = NULL;
+	m_localAcceptThread = NULL;
+
+	m_peers = NULL;
+	m_lobby = &m_ownLobby;
+
+	m_shardThread = NULL;
+	m_nextMatchSerial = 0;
+	m_matchCount = 0;
+
+	m_tickStats.ticks = 0;
+	m_tickStats.overruns = 0;
+	m_tickStats.stepTime = 0;
+	m_tickStats.cpuTime = 0;
+
+	std::random_device seed;
+	m_tokenGenerator.seed(seed());
+}
+
+// ===== Destructor ===============================================================================
+// The destructor will stop the shard and release every match it still owns. The listeners must
+// already be closed so that the accept threads can wake up and end.
+// ================================================================================================
+ServerShard::~ServerShard(void)
+{
+	Stop();
+	JoinAcceptThreads();
+
+	for(std::list<Match>::iterator it = m_matches.begin(); it != m_matches.end(); it++)
+	{
+		it->network->Disconnect();
+		delete it->engine;
+		delete it->network;
+	}
+
+	for(std::list<PendingClient>::iterator it = m_acceptedClients.begin(); it != m_acceptedClients.end(); it++)
+	{
+		delete it->transport;
+	}
+
+	for(std::list<PendingClient>::iterator it = m_handshakes.begin(); it != m_handshakes.end(); it++)
+	{
+		delete it->transport;
+	}
+
+	for(std::list<Resume>::iterator it = m_resumingClients.begin(); it != m_resumingClients.end(); it++)
+	{
+		delete it->transport;
+	}
+
+	for(std::list<Seating>::iterator it = m_joiningClients.begin(); it != m_joiningClients.end(); it++)
+	{
+		delete it->transport;
+	}
+}
+
+// ===== SetPeers =================================================================================
+// Method will give the shard the list of every shard in the server, so that it can pass a resuming
+// client to the shard that owns its' session, and the lobby every shard pairs its' players through,
+// so that it can pass a joining client to the shard with the open seat. Must be called before
+// Start().
+//
+// Input:
+//	[IN] std::vector<ServerShard*> *peers	- every shard, indexed by shard number
+//	[IN] MatchLobby *lobby					- the lobby shared by every shard
+//
+// Output: none
+// ================================================================================================
+void ServerShard::SetPeers(std::vector<ServerShard*> *peers, MatchLobby *lobby)
+{
+	m_peers = peers;
+	m_lobby = lobby;
+}
+
+// ===== Start ====================================================================================
+// Method will start the shard thread and an accept thread for each listener.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::Start(void)
+{
+	m_running = true;
+	m_tickClock.restart();
+
+	m_shardThread = new std::thread(&ServerShard::ShardLoop, this);
+
+	if(m_listener != NULL)
+	{
+		m_acceptThread = new std::thread(&ServerShard::AcceptLoop, this);
+	}
+
+	if(m_localListener != NULL)
+	{
+		m_localAcceptThread = new std::thread(&ServerShard::LocalAcceptLoop, this);
+	}
+}
+
+// ===== Stop =====================================================================================
+// Method will end the shard thread. The accept threads end once the listeners are closed.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::Stop(void)
+{
+	m_running = false;
+	Wake();
+
+	if(m_shardThread != NULL)
+	{
+		m_shardThread->join();
+		delete m_shardThread;
+		m_shardThread = NULL;
+	}
+}
+
+// ===== JoinAcceptThreads ========================================================================
+// Method will wait for the accept threads to end. The listeners must already be closed.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::JoinAcceptThreads(void)
+{
+	if(m_acceptThread != NULL)
+	{
+		m_acceptThread->join();
+		delete m_acceptThread;
+		m_acceptThread = NULL;
+	}
+
+	if(m_localAcceptThread != NULL)
+	{
+		m_localAcceptThread->join();
+		delete m_localAcceptThread;
+		m_localAcceptThread = NULL;
+	}
+}
+
+// ===== AddClient ================================================================================
+// Method will ask the admission control whether a newly connected transport may start its'
+// handshake, and if so queue it for the shard thread. A refused transport is sent a REJECT and
+// closed. This is how the accept threads hand over clients, and how clients running in the same
+// process (for example over a LoopbackTransport) can be attached. The shard takes ownership of the
+// transport.
+//
+// Input:
+//	[IN] Transport *transport	- the connected transport
+//
+// Output:
+//	[OUT] bool					- true if the transport was queued, false if it was rejected
+// ================================================================================================
+bool ServerShard::AddClient(Transport *transport)
+{
+	PendingClient pending;
+	pending.transport = transport;
+	pending.acceptTime = TimeBase::Now(m_gameClock);
+
+	sf::Uint8 reason;
+
+	if(!m_admission->Admit(transport->GetRemoteAddress(), reason))
+	{
+		Reject(transport, reason);
+		return false;
+	}
+
+	m_acceptLock.lock();
+
+	m_acceptedClients.push_back(pending);
+	m_woken = true;
+
+	m_acceptLock.unlock();
+
+	m_wake.notify_one();
+
+	return true;
+}
+
+// ===== ResumeClient =============================================================================
+// Method will queue a reconnected transport for the shard thread to hand back to the session it
+// belongs to. The transport has already been admitted by the shard that accepted it. The shard
+// takes ownership of the transport.
+//
+// Input:
+//	[IN] Transport *transport		- the connected transport
+//	[IN] sf::Uint32 sessionToken	- the token the client sent in its' RESUME
+//	[IN] NetTime acceptTime			- the game clock time the transport was accepted
+//
+// Output:
+//	[OUT] bool						- true if the transport was queued
+// ================================================================================================
+bool ServerShard::ResumeClient(Transport *transport, sf::Uint32 sessionToken, NetTime acceptTime)
+{
+	Resume resume;
+	resume.transport = transport;
+	resume.sessionToken = sessionToken;
+	resume.acceptTime = acceptTime;
+
+	m_acceptLock.lock();
+
+	m_resumingClients.push_back(resume);
+	m_woken = true;
+
+	m_acceptLock.unlock();
+
+	m_wake.notify_one();
+
+	return true;
+}
+
+// ===== JoinClient ===============================================================================
+// Method will queue a joined transport for the shard thread to seat in the match whose open seat
+// the lobby gave it. The transport has already finished its' handshake on the shard that accepted
+// it. The shard takes ownership of the transport.
+//
+// Input:
+//	[IN] Transport *transport		- the connected transport
+//	[IN] sf::Uint32 matchSerial		- the serial of the match with the open seat
+//	[IN] NetTime acceptTime			- the game clock time the transport was accepted
+//
+// Output:
+//	[OUT] bool						- true if the transport was queued
+// ================================================================================================
+bool ServerShard::JoinClient(Transport *transport, sf::Uint32 matchSerial, NetTime acceptTime)
+{
+	Seating seating;
+	seating.transport = transport;
+	seating.matchSerial = matchSerial;
+	seating.acceptTime = acceptTime;
+
+	m_acceptLock.lock();
+
+	m_joiningClients.push_back(seating);
+	m_woken = true;
+
+	m_acceptLock.unlock();
+
+	m_wake.notify_one();
+
+	return true;
+}
+
+// ===== AcceptLoop ===============================================================================
+// This is the method the TCP accept thread will loop through while the shard is running. Every
+// accepted socket is wrapped in a TcpTransport and passed to AddClient(). The thread never waits on
+// a client, so it is always ready for the next accept.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::AcceptLoop(void)
+{
+	sf::TcpSocket *tempClient = new sf::TcpSocket;
+
+	while(m_running)
+	{
+		if(m_listener->accept(*tempClient) == sf::Socket::Done)	// BLOCKING
+		{
+			AddClient(new TcpTransport(tempClient));
+
+			// Create a new TcpSocket for the next player; the Client Handler will release the memory
+			tempClient = new sf::TcpSocket;
+		}
+		else
+		{
+			sf::sleep(sf::milliseconds(10));	// Listener closed or failing, don't spin
+		}
+	}
+
+	delete tempClient;
+}
+
+// ===== LocalAcceptLoop ==========================================================================
+// This is the method the shared memory accept thread will loop through while the shard is running.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::LocalAcceptLoop(void)
+{
+	while(m_running)
+	{
+		Transport *transport = m_localListener->Accept();	// BLOCKING
+
+		if(transport != NULL)
+		{
+			AddClient(transport);
+		}
+	}
+}
+
+// ===== Reject ===================================================================================
+// Method will send a REJECT with the reason to a client and close its' transport.
+//
+// Input:
+//	[IN] Transport *transport	- the client's transport; the transport is released
+//	[IN] sf::Uint8 reason		- the GameData::RejectReason
+//
+// Output: none
+// ================================================================================================
+void ServerShard::Reject(Transport *transport, sf::Uint8 reason)
+{
+	sf::Packet rejectPacket;
+	sf::Uint8 cmdCode = GameData::REJECT;
+
+	rejectPacket << cmdCode << reason;
+	transport->Send(rejectPacket);
+
+	delete transport;
+}
+
+// ===== ShardLoop ================================================================================
+// This is the method the shard thread will loop through while the shard is running. It will move
+// newly accepted clients through their handshakes, start matches as soon as their players are
+// ready, and step every match once per ENGINE_SPEED. In between it sleeps until the next tick or
+// until it is woken, see Wake().
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::ShardLoop(void)
+{
+	const sf::Int64 tick = TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+	const sf::Int64 handshakePoll = TimeBase::FromMilliseconds(1);
+
+	PinToCore();
+
+	while(m_running)
+	{
+		AdmitClients();
+		StartReadyMatches();
+
+		sf::Int64 wait = (tick - m_tickClock.getElapsedTime().asMicroseconds());
+
+		if(wait <= 0)
+		{
+			m_tickClock.restart();
+
+			NetTime stepStart = TimeBase::Now(m_gameClock);
+			StepMatches();
+			RecordTick(TimeBase::Now(m_gameClock) - stepStart);
+			continue;
+		}
+
+		if(!m_handshakes.empty())
+		{
+			wait = std::min(wait, handshakePoll);
+		}
+
+		std::unique_lock<std::mutex> lock(m_acceptLock);
+
+		if(!m_woken && m_running)
+		{
+			m_wake.wait_for(lock, std::chrono::microseconds(wait));
+		}
+
+		m_woken = false;
+	}
+}
+
+// ===== Wake =====================================================================================
+// Method will wake the shard thread if it is asleep between ticks. Called when the shard stops,
+// and by a match's clients when they become ready.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::Wake(void)
+{
+	m_acceptLock.lock();
+
+	m_woken = true;
+
+	m_acceptLock.unlock();
+
+	m_wake.notify_one();
+}
+
+// ===== AdmitClients =============================================================================
+// Method will seat every joined transport other shards have passed here, hand every resuming
+// transport back to its' session, then poll every pending handshake, including those the accept
+// threads have just queued.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::AdmitClients(void)
+{
+	std::list<Resume> resuming;
+	std::list<Seating> joining;
+
+	m_acceptLock.lock();
+
+	m_handshakes.splice(m_handshakes.end(), m_acceptedClients);
+	resuming.swap(m_resumingClients);
+	joining.swap(m_joiningClients);
+
+	m_acceptLock.unlock();
+
+	for(std::list<Seating>::iterator it = joining.begin(); it != joining.end(); it++)
+	{
+		TakeSeat(it->transport, it->matchSerial, it->acceptTime);
+	}
+
+	for(std::list<Resume>::iterator it = resuming.begin(); it != resuming.end(); it++)
+	{
+		bool resumed = false;
+
+		for(std::list<Match>::iterator match = m_matches.begin(); match != m_matches.end(); match++)
+		{
+			if(match->network->ResumeClient(it->sessionToken, it->transport))
+			{
+				std::cout << "Shard " << m_shardNumber << ": a client resumed its' session.\n";
+				resumed = true;
+				break;
+			}
+		}
+
+		if(resumed)
+		{
+			m_admission->HandshakeDone(false, it->acceptTime);
+		}
+		else
+		{
+			std::cout << "Shard " << m_shardNumber << ": unable to resume session.\n";
+			m_admission->HandshakeFailed(GameData::UNKNOWN_SESSION);
+			Reject(it->transport, GameData::UNKNOWN_SESSION);
+		}
+	}
+
+	PollHandshakes();
+}
+
+// ===== PollHandshakes ===========================================================================
+// Method will check every pending handshake for its' first packet without waiting. A handshake that
+// has not sent a JOIN or RESUME within the handshake timeout, or whose connection fails, is closed.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::PollHandshakes(void)
+{
+	NetTime now = TimeBase::Now(m_gameClock);
+	sf::Packet firstPacket;
+
+	std::list<PendingClient>::iterator it = m_handshakes.begin();
+
+	while(it != m_handshakes.end())
+	{
+		sf::Socket::Status status = it->transport->Receive(firstPacket, Transport::Poll());
+
+		if(status == sf::Socket::Done)
+		{
+			FinishHandshake(*it, firstPacket);
+		}
+		else if((status == sf::Socket::NotReady) && ((now - it->acceptTime) < TimeBase::FromMilliseconds(m_config->handshakeTimeout)))
+		{
+			it++;
+			continue;
+		}
+		else
+		{
+			m_admission->HandshakeFailed(GameData::HANDSHAKE_FAILED);
+			Reject(it->transport, GameData::HANDSHAKE_FAILED);
+		}
+
+		it = m_handshakes.erase(it);
+	}
+}
+
+// ===== FinishHandshake ==========================================================================
+// Method will act on the first packet of a pending handshake. A JOIN is seated through the lobby;
+// a RESUME is queued for the shard that issued its' token. Anything else is rejected.
+//
+// Input:
+//	[IN] PendingClient &pending		- the handshake; the transport is passed on or released
+//	[IN/OUT] sf::Packet &firstPacket	- the first packet the client sent
+//
+// Output: none
+// ================================================================================================
+void ServerShard::FinishHandshake(PendingClient &pending, sf::Packet &firstPacket)
+{
+	sf::Uint8 cmdCode = GameData::REJECT;
+	sf::Uint32 sessionToken = 0;
+
+	firstPacket >> cmdCode;
+
+	if(cmdCode == GameData::JOIN)
+	{
+		RouteJoin(pending.transport, pending.acceptTime);
+	}
+	else if((cmdCode == GameData::RESUME) && (firstPacket >> sessionToken))
+	{
+		unsigned int owner = (sessionToken >> 24);
+
+		if((m_peers != NULL) && (owner < m_peers->size()))
+		{
+			(*m_peers)[owner]->ResumeClient(pending.transport, sessionToken, pending.acceptTime);
+		}
+		else if((m_peers == NULL) && ((int)owner == m_shardNumber))
+		{
+			ResumeClient(pending.transport, sessionToken, pending.acceptTime);
+		}
+		else
+		{
+			m_admission->HandshakeFailed(GameData::UNKNOWN_SESSION);
+			Reject(pending.transport, GameData::UNKNOWN_SESSION);
+		}
+	}
+	else
+	{
+		std::cout << "Shard " << m_shardNumber << ": unexpected first packet from a client.\n";
+		m_admission->HandshakeFailed(GameData::HANDSHAKE_FAILED);
+		Reject(pending.transport, GameData::HANDSHAKE_FAILED);
+	}
+}
+
+// ===== RouteJoin ================================================================================
+// Method will find a joined client a seat through the lobby. The client takes the server's open
+// seat if there is one, on this shard or passed to the shard holding it. Otherwise a new match is
+// opened here with the client seated, and its' seat becomes the open one.
+//
+// Input:
+//	[IN] Transport *transport	- the client's transport; it is passed on or seated
+//	[IN] NetTime acceptTime		- the game clock time the transport was accepted
+//
+// Output: none
+// ================================================================================================
+void ServerShard::RouteJoin(Transport *transport, NetTime acceptTime)
+{
+	int shard = m_shardNumber;
+	sf::Uint32 serial = m_nextMatchSerial;
+
+	if(!m_lobby->Join(shard, serial))
+	{
+		SeatClient(OpenMatch(), transport, acceptTime);
+	}
+	else if(shard == m_shardNumber)
+	{
+		TakeSeat(transport, serial, acceptTime);
+	}
+	else
+	{
+		(*m_peers)[shard]->JoinClient(transport, serial, acceptTime);
+	}
+}
+
+// ===== TakeSeat =================================================================================
+// Method will seat a joined client in the match of this shard whose open seat the lobby gave it.
+// If that match has been released, or its' waiting player has dropped, in the meantime, the client
+// joins again through the lobby.
+//
+// Input:
+//	[IN] Transport *transport		- the client's transport; it is seated or passed on
+//	[IN] sf::Uint32 matchSerial		- the serial of the match with the open seat
+//	[IN] NetTime acceptTime			- the game clock time the transport was accepted
+//
+// Output: none
+// ================================================================================================
+void ServerShard::TakeSeat(Transport *transport, sf::Uint32 matchSerial, NetTime acceptTime)
+{
+	Match *match = FindOpenMatch(matchSerial);
+
+	if(match != NULL)
+	{
+		SeatClient(match, transport, acceptTime);
+	}
+	else
+	{
+		RouteJoin(transport, acceptTime);
+	}
+}
+
+// ===== SeatClient ===============================================================================
+// Method will seat a client that has joined in a match and finish its' handshake.
+//
+// Input:
+//	[IN] Match *match			- the match to seat the client in
+//	[IN] Transport *transport	- the client's transport; the match takes ownership
+//	[IN] NetTime acceptTime		- the game clock time the transport was accepted
+//
+// Output: none
+// ================================================================================================
+void ServerShard::SeatClient(Match *match, Transport *transport, NetTime acceptTime)
+{
+	match->network->AddClient(transport, CreateSessionToken());
+	m_admission->HandshakeDone(true, acceptTime);
+}
+
+// ===== OpenMatch ================================================================================
+// Method will open a new match on this shard, with the next match serial.
+//
+// Input: none
+//
+// Output:
+//	[OUT] Match*	- the new match, with no players yet
+// ================================================================================================
+ServerShard::Match* ServerShard::OpenMatch(void)
+{
+	Match match;
+	match.network = new SNetworkController(m_gameClock, m_config, [this](){ Wake(); });
+	match.engine = NULL;
+	match.serial = m_nextMatchSerial++;
+
+	m_matches.push_back(match);
+	m_matchCount++;
+
+	return &m_matches.back();
+}
+
+// ===== FindOpenMatch ============================================================================
+// Method will find the match with the passed serial, if it is still waiting for a player.
+//
+// Input:
+//	[IN] sf::Uint32 matchSerial	- the match's serial
+//
+// Output:
+//	[OUT] Match*				- the match, or NULL if it has been released, filled up, or lost its'
+//								  waiting player
+// ================================================================================================
+ServerShard::Match* ServerShard::FindOpenMatch(sf::Uint32 matchSerial)
+{
+	for(std::list<Match>::iterator it = m_matches.begin(); it != m_matches.end(); it++)
+	{
+		if(it->serial == matchSerial)
+		{
+			if((it->engine != NULL) || it->network->IsFull() || it->network->ClientDropped())
+			{
+				return NULL;
+			}
+
+			return &(*it);
+		}
+	}
+
+	return NULL;
+}
+
+// ===== StartReadyMatches ========================================================================
+// Method will start every full match whose players are both ready. It is called on every pass of
+// the shard thread, so a match starts as soon as the shard is woken by its' last ready client.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::StartReadyMatches(void)
+{
+	for(std::list<Match>::iterator it = m_matches.begin(); it != m_matches.end(); it++)
+	{
+		if((it->engine == NULL) && it->network->IsFull() && it->network->IsReady() && !it->network->ClientDropped())
+		{
+			std::cout << "Shard " << m_shardNumber << ": starting match.\n";
+			it->engine = new ServerEngine(it->network);
+			it->engine->Start();
+		}
+	}
+}
+
+// ===== StepMatches ==============================================================================
+// Method will step every running match, and release matches that have ended. A match that has not
+// started yet is released as soon as any of its' players drops, and the lobby stops offering its'
+// seat, so a dead client never holds the open seat.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::StepMatches(void)
+{
+	std::list<Match>::iterator it = m_matches.begin();
+
+	while(it != m_matches.end())
+	{
+		bool finished = false;
+
+		if(it->engine != NULL)
+		{
+			finished = !it->engine->Step();
+		}
+		else if(it->network->ClientDropped())
+		{
+			std::cout << "Shard " << m_shardNumber << ": a client left before the match started.\n";
+			finished = true;
+		}
+
+		if(finished)
+		{
+			m_admission->ClientsLeft(it->network->GetPlayerCount());
+			m_lobby->Leave(m_shardNumber, it->serial);
+
+			it->network->Disconnect();
+			delete it->engine;
+			delete it->network;
+
+			it = m_matches.erase(it);
+			m_matchCount--;
+		}
+		else
+		{
+			it++;
+		}
+	}
+}
+
+// ===== RecordTick ===============================================================================
+// Method will add a step to the tick counters, along with the CPU time the shard thread has used
+// so far. Must only be called by the shard thread.
+//
+// Input:
+//	[IN] NetTime stepTime	- the time StepMatches() took
+//
+// Output: none
+// ================================================================================================
+void ServerShard::RecordTick(NetTime stepTime)
+{
+	FILETIME created, exited, kernel, user;
+	NetTime cpuTime = 0;
+
+	if(GetThreadTimes(GetCurrentThread(), &created, &exited, &kernel, &user))
+	{
+		ULARGE_INTEGER kernelTime, userTime;
+		kernelTime.LowPart = kernel.dwLowDateTime;
+		kernelTime.HighPart = kernel.dwHighDateTime;
+		userTime.LowPart = user.dwLowDateTime;
+		userTime.HighPart = user.dwHighDateTime;
+
+		cpuTime = (NetTime)((kernelTime.QuadPart + userTime.QuadPart) / 10);	// 100ns units to us
+	}
+
+	m_statsLock.lock();
+
+	m_tickStats.ticks++;
+	m_tickStats.stepTime += stepTime;
+	m_tickStats.cpuTime = cpuTime;
+
+	if(stepTime > TimeBase::FromMilliseconds(GameData::ENGINE_SPEED))
+	{
+		m_tickStats.overruns++;
+	}
+
+	m_statsLock.unlock();
+}
+
+// ===== GetTickStats =============================================================================
+// Method will return a copy of the shard thread's tick counters.
+//
+// Input: none
+//
+// Output:
+//	[OUT] TickStats	- the current counters
+// ================================================================================================
+ServerShard::TickStats ServerShard::GetTickStats(void)
+{
+	m_statsLock.lock();
+
+	TickStats stats = m_tickStats;
+
+	m_statsLock.unlock();
+
+	return stats;
+}
+
+// ===== CreateSessionToken =======================================================================
+// Method will create a session token that no other session on this shard is using. The top byte is
+// this shard's number and the rest is random.
+//
+// Input: none
+//
+// Output:
+//	[OUT] sf::Uint32	- the new session token
+// ================================================================================================
+sf::Uint32 ServerShard::CreateSessionToken(void)
+{
+	while(true)
+	{
+		sf::Uint32 token = (((sf::Uint32)m_shardNumber << 24) | (m_tokenGenerator() & 0x00FFFFFF));
+		bool inUse = ((token & 0x00FFFFFF) == 0);
+
+		for(std::list<Match>::iterator it = m_matches.begin(); !inUse && (it != m_matches.end()); it++)
+		{
+			inUse = it->network->OwnsSession(token);
+		}
+
+		if(!inUse)
+		{
+			return token;
+		}
+	}
+}
+
+// ===== PinToCore ================================================================================
+// Method will pin the calling thread to this shard's core.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ServerShard::PinToCore(void)
+{
+	if(SetThreadAffinityMask(GetCurrentThread(), ((DWORD_PTR)1 << m_shardNumber)) == 0)
+	{
+		std::cout << "Shard " << m_shardNumber << ": unable to pin to core.\n";
+	}
+}
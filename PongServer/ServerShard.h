@@ -0,0 +1,190 @@
+// ================================================================================================
+// Filename: "ServerShard.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ServerShard class runs an independent slice of the server on a single core. The server
+// starts one shard per core; the shards share nothing on the hot path, so accept rate and match
+// stepping grow with the number of cores instead of being bound to one thread.
+//
+// Every shard has its' own accept threads, its' own set of matches, and its' own shard thread that
+// steps those matches once per ENGINE_SPEED. The shard thread is pinned to the shard's core. The
+// only lock a shard takes is its' own accept lock, used to hand accepted transports from its'
+// accept threads to its' shard thread.
+//
+// All shards block in accept on the same listening socket and shared memory listener; the operating
+// system gives each new connection to exactly one of them. Players are paired across shards by the
+// MatchLobby they share: a JOIN takes the server's open seat, and is passed to the shard holding it,
+// or opens a match on its' own shard that becomes the open seat. A match always stays on the shard
+// that accepted its' first player. A shard used alone pairs its' players through a lobby of its' own.
+//
+// An accept thread only asks the AdmissionControl shared by all shards whether a new connection may
+// start its' handshake, and queues it for the shard thread; it never waits on the client. The shard
+// thread polls every pending handshake for its' first packet, a JOIN or a RESUME, without blocking.
+// A JOIN is seated through the lobby as above. A RESUME carries the session token the client was
+// given in INITIALIZE; the top byte of every token is the number of the shard that issued it, so the
+// transport can be passed to the shard that owns the session, which may not be itself. Refused or
+// failed connections are sent a REJECT with a reason code.
+//
+// Between ticks the shard thread sleeps on a condition variable, guarded by the accept lock. It is
+// woken when a connection is queued and when a client finishes its' clock sync, so a full match
+// starts as soon as its' second player is ready rather than on the next poll. While any handshake
+// is pending it still wakes every millisecond to poll them.
+// ================================================================================================
+
+#ifndef SERVERSHARD_H
+#define SERVERSHARD_H
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <list>
+#include <vector>
+#include <random>
+#include <SFML\Network\TcpListener.hpp>
+#include <SFML\System\Clock.hpp>
+#include "ServerConfig.h"
+#include "SNetworkController.h"
+#include "ServerEngine.h"
+#include "SharedMemoryTransport.h"
+#include "AdmissionControl.h"
+#include "MatchLobby.h"
+
+class ServerShard
+{
+
+public:
+
+	// A copy of the shard thread's tick counters
+	struct TickStats
+	{
+		sf::Int64 ticks;				// Times StepMatches() has run
+		sf::Int64 overruns;				// Steps that took longer than a tick
+		NetTime stepTime;				// Total time spent in StepMatches(), in us
+		NetTime cpuTime;				// CPU time the shard thread has used, in us
+	};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ServerShard(int shardNumber, sf::TcpListener *listener, SharedMemoryListener *localListener,
+				const sf::Clock *gameClock, const ServerConfig *config, AdmissionControl *admission);
+	~ServerShard(void);
+
+	// Method Prototypes
+	void SetPeers(std::vector<ServerShard*> *peers, MatchLobby *lobby);
+	void Start(void);
+	void Stop(void);
+	void JoinAcceptThreads(void);
+	bool AddClient(Transport *transport);
+	bool ResumeClient(Transport *transport, sf::Uint32 sessionToken, NetTime acceptTime);
+	bool JoinClient(Transport *transport, sf::Uint32 matchSerial, NetTime acceptTime);
+	TickStats GetTickStats(void);
+
+	// Inlined Methods
+	int GetShardNumber(void){ return m_shardNumber; }
+	int GetMatchCount(void){ return m_matchCount; }
+
+private:
+
+	// A match and, once both players are ready, the engine running it
+	struct Match
+	{
+		SNetworkController *network;
+		ServerEngine *engine;
+		sf::Uint32 serial;				// Names the match to the lobby
+	};
+
+	// A newly accepted client that has not yet sent its' JOIN or RESUME
+	struct PendingClient
+	{
+		Transport *transport;
+		NetTime acceptTime;
+	};
+
+	// A reconnected client waiting to be handed back its' session
+	struct Resume
+	{
+		Transport *transport;
+		sf::Uint32 sessionToken;
+		NetTime acceptTime;
+	};
+
+	// A joined client passed to this shard to take the lobby's open seat in one of its' matches
+	struct Seating
+	{
+		Transport *transport;
+		sf::Uint32 matchSerial;
+		NetTime acceptTime;
+	};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	void ShardLoop(void);
+	void AcceptLoop(void);
+	void LocalAcceptLoop(void);
+	void Reject(Transport *transport, sf::Uint8 reason);
+	void AdmitClients(void);
+	void PollHandshakes(void);
+	void FinishHandshake(PendingClient &pending, sf::Packet &firstPacket);
+	void RouteJoin(Transport *transport, NetTime acceptTime);
+	void TakeSeat(Transport *transport, sf::Uint32 matchSerial, NetTime acceptTime);
+	void SeatClient(Match *match, Transport *transport, NetTime acceptTime);
+	Match* OpenMatch(void);
+	Match* FindOpenMatch(sf::Uint32 matchSerial);
+	sf::Uint32 CreateSessionToken(void);
+	void StartReadyMatches(void);
+	void StepMatches(void);
+	void RecordTick(NetTime stepTime);
+	void Wake(void);
+	void PinToCore(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Shard Data
+	int m_shardNumber;
+	const sf::Clock *m_gameClock;
+	const ServerConfig *m_config;
+	std::atomic<bool> m_running;		// Written by Stop(), polled by the shard and accept threads
+	sf::Clock m_tickClock;
+
+	// Accept Data
+	sf::TcpListener *m_listener;
+	SharedMemoryListener *m_localListener;
+	std::thread *m_acceptThread;
+	std::thread *m_localAcceptThread;
+	AdmissionControl *m_admission;
+	std::mutex m_acceptLock;
+	std::condition_variable m_wake;		// Signalled with m_acceptLock to wake the shard thread early
+	bool m_woken;						// Set with m_acceptLock when the shard thread has been signalled
+	std::list<PendingClient> m_acceptedClients;
+	std::list<Resume> m_resumingClients;
+	std::list<Seating> m_joiningClients;
+	std::vector<ServerShard*> *m_peers;
+	MatchLobby *m_lobby;
+	MatchLobby m_ownLobby;				// The lobby used until SetPeers() gives a shared one
+
+	// Match Data, only touched by the shard thread
+	std::thread *m_shardThread;
+	std::list<PendingClient> m_handshakes;
+	std::list<Match> m_matches;
+	sf::Uint32 m_nextMatchSerial;
+	int m_matchCount;
+	std::mt19937 m_tokenGenerator;
+
+	// Tick Data, written by the shard thread
+	std::mutex m_statsLock;
+	TickStats m_tickStats;
+};
+
+#endif
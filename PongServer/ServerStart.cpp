@@ -2,52 +2,227 @@
 // Filename: "ServerStart.cpp"
 // ================================================================================================
 // Primary Author: Travis Smith
-// Last Modified: Mar 04, 2014
+// Last Modified: Oct 18, 2026
 // ================================================================================================
-// This file is where server execution will start. It will create an instance of the ServerEngine
-// and start it.
+// This file is where server execution will start. It will open the listeners and start one
+// ServerShard per core. The shards pair the clients they accept through a shared MatchLobby, and
+// each runs the matches it holds.
+//
+// Command Line Options:
+//	-shards <n>					- number of shards to run, defaults to one per core
+//	-bench <clients>			- benchmark 1, 2, 4... up to -shards shards with this many in-process
+//								  loopback clients, print the results and exit
+//	-heartbeat <ms>				- longest a client goes without hearing from the server
+//	-idle-timeout <ms>			- drop a client after this long without receiving anything
+//	-half-open-timeout <ms>		- drop a client after a send has been stuck this long
+//	-resume-grace <ms>			- how long a dropped client has to reconnect and resume its' slot
+//	-sync-interval <ms>			- time between clock sync rounds once a client is ready
+//	-max-sync-interval <ms>		- longest the sync interval backs off to while the clock model holds
+//	-link-log <ms>				- print each client's link and input buffer stats this often, 0 for off
+//	-min-snapshot-rate <hz>		- fewest game updates per second a congested client is backed off to
+//	-max-rewind <ms>			- longest the server looks back to judge a paddle hit, 0 for off
+//	-net-profile <name>			- network conditions to emulate: off, lan, broadband, wifi, mobile,
+//								  overseas or legacy; asked for at start-up if not given
+//	-net-seed <n>				- seed for the emulator's random choices, so a run can be repeated
+//	-net-trace <file>			- replay a recorded trace's delay and loss in place of the profile's
+//	-record-trace <prefix>		- record each client's delay and loss to <prefix>-<token>.trace
+//	-max-clients <n>			- most clients the server will hold, seated or handshaking
+//	-max-pending <n>			- most connections that may be handshaking at once
+//	-handshake-timeout <ms>		- how long a new connection has to send its' JOIN or RESUME
+//	-accept-rate <n>			- connections per second allowed from a single address
+//	-accept-burst <n>			- connections a single address may make at once
+//
+// While running, entering 's' prints the accept counters and entering anything else stops the
+// server.
 // ================================================================================================
 
 #include <iostream>
+#include <vector>
+#include <string>
 #include <Windows.h>
+#include <SFML\Network\TcpListener.hpp>
+#include "ServerConfig.h"
+#include "AdmissionControl.h"
+#include "MatchLobby.h"
 #include "SNetworkController.h"
-#include "ServerEngine.h"
+#include "ServerShard.h"
+#include "ShardBenchmark.h"
+#include "SharedMemoryTransport.h"
 
 int main(int argc, char* argv[])
 {
-	bool usingArtificalLatency = true;
-	bool waitingForPlayers = true;
-	int numPlayers = 0;
+	ServerConfig config;
 	sf::Clock gameClock;
 
 	// Introduction Output
 	std::cout << "Pong Server\nClass: ICS 167\n\n";
 
-	// Get y/n for artificial latency
-	std::cout << "Using artificial latency? (Y/N) : Default = on\n";
+	// Read Command Line Options
+	for(int i = 1; i < argc; i++)
+	{
+		if(!config.ParseOption(argc, argv, i))
+		{
+			std::cout << "Ignoring unknown option " << argv[i] << "\n";
+		}
+	}
+
+	if(config.numShards < 1)
+	{
+		config.numShards = 1;
+	}
+	else if(config.numShards > (int)(sizeof(DWORD_PTR) * 8))
+	{
+		config.numShards = (int)(sizeof(DWORD_PTR) * 8);	// One bit per core in the affinity mask
+	}
+
+	if(config.heartbeatInterval < GameData::ENGINE_SPEED)
+	{
+		config.heartbeatInterval = GameData::ENGINE_SPEED;
+	}
 
-	char latencyOption[256];
-	fgets(latencyOption, 256, stdin);	// Get the next characters off input stream
+	if(config.idleTimeout <= config.heartbeatInterval)
+	{
+		config.idleTimeout = (config.heartbeatInterval * 2);	// Allow at least one lost heartbeat
+	}
 
-	if((latencyOption[0] == 'n') || (latencyOption[0] == 'N'))	// If the first character on the input isn't 'n', latency is defaulted to on
+	if(config.halfOpenTimeout <= config.heartbeatInterval)
 	{
-		usingArtificalLatency = false;
-		std::cout << "Artificial latency is off.\n";
+		config.halfOpenTimeout = (config.heartbeatInterval * 2);
 	}
-	else
+
+	if(config.resumeGrace < 0)
 	{
-		std::cout << "Artificial latency is on.\n";
+		config.resumeGrace = 0;		// Resumption off, a dropped client ends the match
+	}
+
+	if(config.syncInterval < config.heartbeatInterval)
+	{
+		config.syncInterval = config.heartbeatInterval;
+	}
+
+	if(config.maxSyncInterval < config.syncInterval)
+	{
+		config.maxSyncInterval = config.syncInterval;
+	}
+
+	if(config.minSnapshotRate < 1)
+	{
+		config.minSnapshotRate = 1;
+	}
+
+	if(config.maxRewind < 0)
+	{
+		config.maxRewind = 0;
+	}
+
+	if(config.maxPendingHandshakes < 1)
+	{
+		config.maxPendingHandshakes = 1;
+	}
+
+	if(config.acceptBurst < 1)
+	{
+		config.acceptBurst = 1;
+	}
+
+	if(config.benchClients > 0)
+	{
+		config.benchClients += (config.benchClients % 2);	// Every client needs an opponent
+
+		ShardBenchmark benchmark(&config, &gameClock);
+		return benchmark.Run();
 	}
 
-	SNetworkController networkControl(&gameClock, usingArtificalLatency);
-	ServerEngine engine(&networkControl);
+	// Get the network profile to emulate, if it wasn't given
+	if(!config.netTrace.IsEmpty())
+	{
+		std::cout << "Replaying network trace, " << config.netTrace.up.size() << " up and "
+				  << config.netTrace.down.size() << " down samples.\n";
+	}
+	else if(!config.netProfileGiven)
+	{
+		std::cout << "Network profile to emulate (";
+		NetworkProfile::PrintProfiles(std::cout);
+		std::cout << ") : Default = " << config.netProfile.name << "\n";
+
+		char profileOption[256];
+		fgets(profileOption, 256, stdin);	// Get the next characters off input stream
+
+		std::string profileName(profileOption);
+		profileName.erase(profileName.find_last_not_of(" \r\n") + 1);
+
+		if(!profileName.empty() && !NetworkProfile::Find(profileName, config.netProfile))
+		{
+			std::cout << "Unknown network profile " << profileName << ".\n";
+		}
+	}
+
+	std::cout << "Emulating network profile " << config.netProfile.name << ", seed " << config.netSeed << ".\n";
+
+	// Set-Up the listeners shared by every shard
+	sf::TcpListener listener;
+	SharedMemoryListener localListener;
+	bool listening = (listener.listen(SNetworkController::LISTENING_PORT) == sf::Socket::Done);
+	bool localListening = localListener.Listen(SNetworkController::LISTENING_PORT);
+
+	if(!listening)
+	{
+		std::cout << "Error establishing listener.\n";
+	}
+
+	if(!localListening)
+	{
+		std::cout << "Error establishing shared memory listener.\n";
+	}
+
+	// Start the Shards
+	AdmissionControl admission(&config, &gameClock);
+	MatchLobby lobby;
+	std::vector<ServerShard*> shards;
+
+	for(int i = 0; i < config.numShards; i++)
+	{
+		shards.push_back(new ServerShard(i, (listening ? &listener : NULL), (localListening ? &localListener : NULL),
+										 &gameClock, &config, &admission));
+	}
+
+	for(int i = 0; i < config.numShards; i++)
+	{
+		shards[i]->SetPeers(&shards, &lobby);	// Paired and resumed clients may be accepted by any shard
+		shards[i]->Start();
+	}
+
+	std::cout << "Server running " << config.numShards << " shard(s). Waiting For Clients...\n";
+	std::cout << "Enter 's' for accept statistics, or press Enter to stop the server.\n";
+
+	char command[256];
+
+	while((fgets(command, 256, stdin) != NULL) && ((command[0] == 's') || (command[0] == 'S')))
+	{
+		admission.PrintStats(std::cout);
+	}
+
+	// Shut Down; stop the shards, then close the listeners to wake their accept threads
+	for(int i = 0; i < config.numShards; i++)
+	{
+		shards[i]->Stop();
+	}
+
+	listener.close();
+	localListener.Close();
+
+	// Every accept thread must be finished before any shard is deleted, as they hand resumed
+	// clients to each other. The shard threads, which hand joined clients to each other, were
+	// finished by Stop()
+	for(int i = 0; i < config.numShards; i++)
+	{
+		shards[i]->JoinAcceptThreads();
+	}
 
-	while(!networkControl.IsReady())
+	for(int i = 0; i < config.numShards; i++)
 	{
-		Sleep(2500);
-		std::wcout << "NWC is not Ready...\n";
+		delete shards[i];
 	}
 
-	std::cout << "Server Engine Starting...\n";
-	engine.Run();
-}
\ No newline at end of file
+	admission.PrintStats(std::cout);
+}
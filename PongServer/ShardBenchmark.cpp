@@ -0,0 +1,362 @@
+// ================================================================================================
+// Filename: "ShardBenchmark.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the ShardBenchmark class. For a class description see
+// the header file "ShardBenchmark.h"
+// ================================================================================================
+
+#include <iostream>
+#include <SFML\System\Sleep.hpp>
+#include "ShardBenchmark.h"
+#include "ServerShard.h"
+#include "AdmissionControl.h"
+#include "MatchLobby.h"
+#include "LoopbackTransport.h"
+#include "TimeSync.h"
+#include "GameData.h"
+
+// Initialize Static Constants
+const int ShardBenchmark::START_TIMEOUT = 30000;
+const int ShardBenchmark::MEASURE_TIME = 10000;
+
+// ===== Constructor ==============================================================================
+// The constructor will copy the server's options, opening the admission limits up to the number of
+// benchmark clients and turning network emulation off.
+//
+// Input:
+//	[IN] const ServerConfig *config		- the options the server was started with
+//	[IN] const sf::Clock *gameClock		- the server's game clock
+//
+// Output: none
+// ================================================================================================
+ShardBenchmark::ShardBenchmark(const ServerConfig *config, const sf::Clock *gameClock) : m_config(*config)
+{
+	m_gameClock = gameClock;
+
+	NetworkProfile::Find("off", m_config.netProfile);
+	m_config.netTrace = NetworkTrace();
+	m_config.recordTrace.clear();
+	m_config.linkLogInterval = 0;
+
+	m_config.maxClients = m_config.benchClients;
+	m_config.maxPendingHandshakes = m_config.benchClients;
+	m_config.acceptBurst = m_config.benchClients;
+	m_config.acceptRate = (float)m_config.benchClients;
+}
+
+// ===== Run ======================================================================================
+// Method will run a round for 1, 2, 4 and so on shards, up to the configured number, then print
+// the results.
+//
+// Input: none
+//
+// Output:
+//	[OUT] int	- the process exit code, 0 if every game started in every round
+// ================================================================================================
+int ShardBenchmark::Run(void)
+{
+	int exitCode = 0;
+	int shardCount = 1;
+
+	std::cout << "Benchmarking " << m_config.benchClients << " loopback clients on up to "
+			  << m_config.numShards << " shard(s).\n";
+
+	while(true)
+	{
+		m_rounds.push_back(RunRound(shardCount));
+
+		if(shardCount == m_config.numShards)
+		{
+			break;
+		}
+
+		// Always finish on the configured number of shards
+		shardCount *= 2;
+
+		if(shardCount > m_config.numShards)
+		{
+			shardCount = m_config.numShards;
+		}
+	}
+
+	PrintResults();
+
+	for(std::vector<Round>::iterator it = m_rounds.begin(); it != m_rounds.end(); it++)
+	{
+		if(it->started < m_config.benchClients)
+		{
+			exitCode = 1;
+		}
+	}
+
+	return exitCode;
+}
+
+// ===== RunRound =================================================================================
+// Method will start the shards, connect every client to them in turn, wait for the games to start,
+// and compare each shard's tick counters from the start and end of the measuring time. The client
+// ends are closed before the shards are stopped, so no server thread is left waiting on a full
+// ring.
+//
+// Input:
+//	[IN] int shardCount	- the number of shards to run
+//
+// Output:
+//	[OUT] Round			- the round's results
+// ================================================================================================
+ShardBenchmark::Round ShardBenchmark::RunRound(int shardCount)
+{
+	Round round;
+	round.shards = shardCount;
+	round.matches = 0;
+	round.started = 0;
+	round.tickRate = 0;
+	round.stepTime = 0;
+	round.worstStepTime = 0;
+	round.cpuPerTick = 0;
+	round.overruns = 0;
+
+	// Start the Shards
+	AdmissionControl admission(&m_config, m_gameClock);
+	MatchLobby lobby;
+	std::vector<ServerShard*> shards;
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		shards.push_back(new ServerShard(i, NULL, NULL, m_gameClock, &m_config, &admission));
+	}
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		shards[i]->SetPeers(&shards, &lobby);
+		shards[i]->Start();
+	}
+
+	// Connect the Clients
+	NetTime roundStart = TimeBase::Now(m_gameClock);
+
+	m_clients.resize(m_config.benchClients);
+
+	for(int i = 0; i < m_config.benchClients; i++)
+	{
+		Transport *serverEnd = NULL;
+		Client &client = m_clients[i];
+
+		LoopbackTransport::CreatePair(serverEnd, client.transport);
+		client.started = false;
+		client.connected = shards[i % shardCount]->AddClient(serverEnd);
+
+		if(client.connected)
+		{
+			sf::Packet joinPacket;
+			sf::Uint8 cmdCode = GameData::JOIN;
+
+			joinPacket << cmdCode;
+			client.transport->Send(joinPacket);
+		}
+	}
+
+	// Wait for the Games to Start
+	NetTime startDeadline = (roundStart + TimeBase::FromMilliseconds(START_TIMEOUT));
+
+	while((round.started < m_config.benchClients) && (TimeBase::Now(m_gameClock) < startDeadline))
+	{
+		if(ServiceClients() == 0)
+		{
+			sf::sleep(sf::milliseconds(1));
+		}
+
+		round.started = 0;
+
+		for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); it++)
+		{
+			round.started += (it->started ? 1 : 0);
+		}
+	}
+
+	round.startTime = (TimeBase::Now(m_gameClock) - roundStart);
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		round.matches += shards[i]->GetMatchCount();
+	}
+
+	// Measure
+	std::vector<ServerShard::TickStats> before;
+	NetTime measureStart = TimeBase::Now(m_gameClock);
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		before.push_back(shards[i]->GetTickStats());
+	}
+
+	NetTime measureEnd = (measureStart + TimeBase::FromMilliseconds(MEASURE_TIME));
+
+	while(TimeBase::Now(m_gameClock) < measureEnd)
+	{
+		if(ServiceClients() == 0)
+		{
+			sf::sleep(sf::milliseconds(1));
+		}
+	}
+
+	double seconds = ((TimeBase::Now(m_gameClock) - measureStart) / 1000000.0);
+	sf::Int64 totalTicks = 0;
+	NetTime totalStepTime = 0;
+	NetTime totalCpuTime = 0;
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		ServerShard::TickStats after = shards[i]->GetTickStats();
+		sf::Int64 ticks = (after.ticks - before[i].ticks);
+		NetTime stepTime = (after.stepTime - before[i].stepTime);
+
+		totalTicks += ticks;
+		totalStepTime += stepTime;
+		totalCpuTime += (after.cpuTime - before[i].cpuTime);
+		round.overruns += (after.overruns - before[i].overruns);
+
+		if((ticks > 0) && (((double)stepTime / ticks) > round.worstStepTime))
+		{
+			round.worstStepTime = ((double)stepTime / ticks);
+		}
+	}
+
+	if(totalTicks > 0)
+	{
+		round.tickRate = ((totalTicks / seconds) / shardCount);
+		round.stepTime = ((double)totalStepTime / totalTicks);
+		round.cpuPerTick = ((double)totalCpuTime / totalTicks);
+	}
+
+	// Shut Down; close the clients, stop every shard, then delete them, as they hand joined
+	// clients to each other
+	for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); it++)
+	{
+		it->transport->Disconnect();
+	}
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		shards[i]->Stop();
+	}
+
+	for(int i = 0; i < shardCount; i++)
+	{
+		delete shards[i];
+	}
+
+	for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); it++)
+	{
+		delete it->transport;
+	}
+
+	m_clients.clear();
+
+	return round;
+}
+
+// ===== ServiceClients ===========================================================================
+// Method will service every client once.
+//
+// Input: none
+//
+// Output:
+//	[OUT] int	- the number of packets read, over every client
+// ================================================================================================
+int ShardBenchmark::ServiceClients(void)
+{
+	int packets = 0;
+
+	for(std::vector<Client>::iterator it = m_clients.begin(); it != m_clients.end(); it++)
+	{
+		packets += Service(*it);
+	}
+
+	return packets;
+}
+
+// ===== Service ==================================================================================
+// Method will read every packet waiting for a client. TIME_SYNC requests are stamped and returned
+// and HEARTBEATs echoed, as a real client would; the first GAME_UPDATE marks the client's game as
+// started. Anything else is dropped.
+//
+// Input:
+//	[IN/OUT] Client &client	- the client to service
+//
+// Output:
+//	[OUT] int				- the number of packets read
+// ================================================================================================
+int ShardBenchmark::Service(Client &client)
+{
+	sf::Packet receivedPacket;
+	sf::Uint8 cmdCode;
+	int packets = 0;
+
+	while(client.connected)
+	{
+		sf::Socket::Status status = client.transport->Receive(receivedPacket, Transport::Poll());
+
+		if(status != sf::Socket::Done)
+		{
+			client.connected = (status == sf::Socket::NotReady);
+			break;
+		}
+
+		packets++;
+		receivedPacket >> cmdCode;
+
+		if(cmdCode == GameData::GAME_UPDATE)
+		{
+			client.started = true;
+		}
+		else if(cmdCode == GameData::TIME_SYNC)
+		{
+			TimeSync syncRequest;
+			sf::Packet syncPacket;
+
+			receivedPacket >> syncRequest;
+			syncRequest.clientRecieveTime = TimeBase::Now(m_gameClock);
+			syncRequest.clientSendTime = syncRequest.clientRecieveTime;
+			syncPacket << cmdCode << syncRequest;
+
+			client.transport->Send(syncPacket);
+		}
+		else if(cmdCode == GameData::HEARTBEAT)
+		{
+			client.transport->Send(receivedPacket);		// The packet is sent whole, whatever has been read
+		}
+	}
+
+	return packets;
+}
+
+// ===== PrintResults =============================================================================
+// Method will print a line of results for every round.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void ShardBenchmark::PrintResults(void)
+{
+	std::cout << "\nBenchmark Results, " << m_config.benchClients << " clients, "
+			  << (MEASURE_TIME / 1000) << " seconds measured per round, target "
+			  << (1000.0 / GameData::ENGINE_SPEED) << " ticks/s per shard\n";
+
+	for(std::vector<Round>::iterator it = m_rounds.begin(); it != m_rounds.end(); it++)
+	{
+		std::cout << "Shards: " << it->shards << "  Matches: " << it->matches
+				  << "  Started: " << it->started << "/" << m_config.benchClients
+				  << " in " << (it->startTime / 1000) << "ms"
+				  << "  Ticks/s: " << it->tickRate
+				  << "  Step: " << it->stepTime << "us (busiest " << it->worstStepTime << "us)"
+				  << "  CPU/Tick: " << it->cpuPerTick << "us"
+				  << "  Overruns: " << it->overruns << "\n";
+	}
+
+	std::cout << "Only the shard threads are measured. Each client's ClientHandler still runs two "
+			  << "unpinned threads of its' own, which share the shards' cores.\n";
+}
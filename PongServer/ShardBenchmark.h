@@ -0,0 +1,115 @@
+// ================================================================================================
+// Filename: "ShardBenchmark.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The ShardBenchmark class measures how the server scales with its' number of shards, all in one
+// process. It is run by the server's -bench option in place of the listeners.
+//
+// Each round starts a set of shards with no listeners, exactly as ServerStart does, and connects
+// the requested number of clients to them through LoopbackTransport pairs, so no sockets or kernel
+// network stack are involved and only the shards' own work is measured. Clients are handed to the
+// shards in turn, as the operating system spreads connections across the accept threads, so most
+// pairs have to meet through the MatchLobby. The rounds run 1, 2, 4 and so on shards, up to the
+// -shards option.
+//
+// The benchmark's clients are scripted rather than full clients: each sends a JOIN, echoes the
+// server's TIME_SYNC requests and HEARTBEATs, and drains its' GAME_UPDATEs. They never move their
+// paddles. All of them are serviced from the calling thread, which only sleeps after a pass that
+// found nothing to read.
+//
+// A round first waits, up to START_TIMEOUT, for every client's game to start, and records how long
+// that took and how many matches the shards hold. It then measures each shard thread over
+// MEASURE_TIME from its' TickStats: ticks stepped a second, the mean time StepMatches() takes, the
+// CPU time the thread uses per tick, and the steps that overran a tick. A shard keeps up while it
+// steps close to 1000 / ENGINE_SPEED ticks a second with no overruns; the step and CPU times show
+// how much room is left, and how it changes as the same clients are spread over more shards. Once
+// every round is done a table of the results is printed, after the shards' own output.
+//
+// Only the shard threads are measured. Each ClientHandler still runs two threads of its' own,
+// which are not pinned, so they compete with the shards for the same cores.
+//
+// Admission limits would only measure the token bucket, so each round's shards get a copy of the
+// server's options with them opened up to the number of clients, and with network emulation off.
+// ================================================================================================
+
+#ifndef SHARDBENCHMARK_H
+#define SHARDBENCHMARK_H
+
+#include <vector>
+#include <SFML\System\Clock.hpp>
+#include "ServerConfig.h"
+#include "Transport.h"
+#include "NetTime.h"
+
+class ShardBenchmark
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	ShardBenchmark(const ServerConfig *config, const sf::Clock *gameClock);
+	~ShardBenchmark(void){}
+
+	// Method Prototypes
+	int Run(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int START_TIMEOUT;		// Time, in ms, a round waits for every game to start
+	static const int MEASURE_TIME;		// Time, in ms, a round measures the shards for
+
+private:
+
+	// The results of one round
+	struct Round
+	{
+		int shards;
+		int matches;					// Matches the shards held once the games had started
+		int started;					// Clients whose game started
+		NetTime startTime;				// Time for every game to start, or the timeout
+		double tickRate;				// Mean ticks a second stepped by each shard
+		double stepTime;				// Mean time, in us, of a StepMatches() over every shard
+		double worstStepTime;			// Mean time, in us, of a StepMatches() on the busiest shard
+		double cpuPerTick;				// Mean CPU time, in us, a shard thread used per tick
+		sf::Int64 overruns;				// Steps, on every shard, that took longer than a tick
+	};
+
+	// A scripted client and its' end of a loopback pair
+	struct Client
+	{
+		Transport *transport;
+		bool started;					// True once the first GAME_UPDATE has arrived
+		bool connected;
+	};
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	Round RunRound(int shardCount);
+	int Service(Client &client);
+	int ServiceClients(void);
+	void PrintResults(void);
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	ServerConfig m_config;				// The server's options, with admission opened up
+	const sf::Clock *m_gameClock;
+	std::vector<Client> m_clients;
+	std::vector<Round> m_rounds;
+};
+
+#endif
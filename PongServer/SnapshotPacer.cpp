@@ -0,0 +1,228 @@
+// ================================================================================================
+// Filename: "SnapshotPacer.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the SnapshotPacer class. For a class description see
+// the header file "SnapshotPacer.h"
+// ================================================================================================
+
+#include "SnapshotPacer.h"
+
+// Initialize Static Constants
+const int SnapshotPacer::QUEUE_LIMIT = 2;
+const int SnapshotPacer::RTT_MARGIN = 30;
+const int SnapshotPacer::MIN_BACKOFF_SPACING = 100;
+const int SnapshotPacer::RECOVER_TIME = 500;
+
+// ===== Constructor ==============================================================================
+// The constructor will start the pacer at the full rate and full precision. The longest interval
+// is the number of engine ticks between snapshots at the minimum snapshot rate.
+//
+// Input:
+//	[IN] const ServerConfig *config	- the options the server was started with
+//
+// Output: none
+// ================================================================================================
+SnapshotPacer::SnapshotPacer(const ServerConfig *config)
+{
+	m_config = config;
+	m_maxInterval = 1;
+
+	if(m_config->minSnapshotRate > 0)
+	{
+		m_maxInterval = ((1000 / m_config->minSnapshotRate) / GameData::ENGINE_SPEED);
+	}
+
+	if(m_maxInterval < 1)
+	{
+		m_maxInterval = 1;
+	}
+
+	Reset(0);
+}
+
+// ===== Reset ====================================================================================
+// Method will put the pacer back to the full rate and full precision, for a new connection.
+//
+// Input:
+//	[IN] NetTime now	- the current game clock time
+//
+// Output: none
+// ================================================================================================
+void SnapshotPacer::Reset(NetTime now)
+{
+	m_interval = 1;
+	m_ticksSinceSend = 0;
+	m_precision = GameData::FULL_PRECISION;
+	m_lastBackOff = now;
+	m_lastChange = now;
+	m_hasSent = false;
+}
+
+// ===== ShouldSend ===============================================================================
+// Method will be called once per engine tick, and will adjust the pacing to the link and decide if
+// this tick's snapshot should be sent.
+//
+// Input:
+//	[IN] const GameData &state		- this tick's snapshot
+//	[IN] NetTime now				- the current game clock time
+//	[IN] int queueDepth				- packets waiting in the client's out queue
+//	[IN] const LinkStats &stats		- the client's latest link measurements
+//
+// Output:
+//	[OUT] bool						- true if the snapshot should be sent, false to skip it
+// ================================================================================================
+bool SnapshotPacer::ShouldSend(const GameData &state, NetTime now, int queueDepth, const LinkStats &stats)
+{
+	if(IsCongested(queueDepth, stats))
+	{
+		BackOff(now, stats);
+	}
+	else
+	{
+		Recover(now);
+	}
+
+	m_ticksSinceSend++;
+
+	if(!HasEvent(state) && (m_ticksSinceSend < m_interval))
+	{
+		return false;
+	}
+
+	m_ticksSinceSend = 0;
+	m_lastSent = state;
+	m_hasSent = true;
+
+	return true;
+}
+
+// ===== IsCongested ==============================================================================
+// Method will check if the client's link is falling behind.
+//
+// Input:
+//	[IN] int queueDepth			- packets waiting in the client's out queue
+//	[IN] const LinkStats &stats	- the client's latest link measurements
+//
+// Output:
+//	[OUT] bool					- true if snapshots are queueing or the round trip has grown past
+//								  what the link's usual variation explains
+// ================================================================================================
+bool SnapshotPacer::IsCongested(int queueDepth, const LinkStats &stats)
+{
+	if(queueDepth > QUEUE_LIMIT)
+	{
+		return true;
+	}
+
+	if(stats.rttValid)
+	{
+		NetTime margin = TimeBase::FromMilliseconds(RTT_MARGIN);
+
+		if((stats.minRtt / 2) > margin)
+		{
+			margin = (stats.minRtt / 2);
+		}
+
+		NetTime limit = (stats.minRtt + margin + (4 * stats.rttVariance));
+
+		return (stats.smoothedRtt > limit);
+	}
+
+	return false;
+}
+
+// ===== HasEvent =================================================================================
+// Method will check if a snapshot carries something the client can't miss.
+//
+// Input:
+//	[IN] const GameData &state	- the snapshot
+//
+// Output:
+//	[OUT] bool					- true if the snapshot must be sent
+// ================================================================================================
+bool SnapshotPacer::HasEvent(const GameData &state)
+{
+	if(!m_hasSent || state.playerScored)
+	{
+		return true;
+	}
+
+	return ((state.playerOneScore != m_lastSent.playerOneScore) || (state.playerTwoScore != m_lastSent.playerTwoScore) ||
+			(state.playerOneHealth != m_lastSent.playerOneHealth) || (state.playerTwoHealth != m_lastSent.playerTwoHealth) ||
+			(state.gameWon != m_lastSent.gameWon) || (state.startGame != m_lastSent.startGame) ||
+			(state.healthPackSpawned != m_lastSent.healthPackSpawned));
+}
+
+// ===== BackOff ==================================================================================
+// Method will take one step down, no sooner than a round trip after the last one: double the
+// interval, or once at the longest interval, drop to compact precision.
+//
+// Input:
+//	[IN] NetTime now				- the current game clock time
+//	[IN] const LinkStats &stats		- the client's latest link measurements
+//
+// Output: none
+// ================================================================================================
+void SnapshotPacer::BackOff(NetTime now, const LinkStats &stats)
+{
+	NetTime spacing = TimeBase::FromMilliseconds(MIN_BACKOFF_SPACING);
+
+	if(stats.rttValid && (stats.smoothedRtt > spacing))
+	{
+		spacing = stats.smoothedRtt;
+	}
+
+	m_lastChange = now;		// Not clear, so recovery starts over
+
+	if((now - m_lastBackOff) < spacing)
+	{
+		return;
+	}
+
+	m_lastBackOff = now;
+
+	if(m_interval < m_maxInterval)
+	{
+		m_interval *= 2;
+
+		if(m_interval > m_maxInterval)
+		{
+			m_interval = m_maxInterval;
+		}
+	}
+	else
+	{
+		m_precision = GameData::COMPACT_PRECISION;
+	}
+}
+
+// ===== Recover ==================================================================================
+// Method will take one step back up for every RECOVER_TIME the link stays clear: full precision
+// first, then one tick off the interval.
+//
+// Input:
+//	[IN] NetTime now	- the current game clock time
+//
+// Output: none
+// ================================================================================================
+void SnapshotPacer::Recover(NetTime now)
+{
+	if((now - m_lastChange) < TimeBase::FromMilliseconds(RECOVER_TIME))
+	{
+		return;
+	}
+
+	m_lastChange = now;
+
+	if(m_precision != GameData::FULL_PRECISION)
+	{
+		m_precision = GameData::FULL_PRECISION;
+	}
+	else if(m_interval > 1)
+	{
+		m_interval--;
+	}
+}
@@ -0,0 +1,93 @@
+// ================================================================================================
+// Filename: "SnapshotPacer.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The SnapshotPacer class decides, every engine tick, whether a client should be sent a GAME_UPDATE
+// and at what precision. Each ClientHandler has one. A client on a good link gets a full precision
+// snapshot every tick. A client whose link can't keep up is sent fewer, smaller snapshots instead
+// of having them pile up in its' out queue and fall further and further behind.
+//
+// The link is congested when more than QUEUE_LIMIT packets are waiting in the out queue, or when
+// the smoothed round trip time has grown past the least round trip of the last ten seconds by more
+// than RTT_MARGIN or half the least round trip, whichever is more, plus four times the round trip
+// variance. The least round trip expires, so a link whose route has lastingly grown longer is only
+// backed off until the new round trip becomes its' base, not for the rest of the match. The
+// variance term is the one TCP uses for its' retransmission timer; it keeps a link that is merely
+// jittery from being taken for a congested one. On congestion the pacer backs off multiplicatively:
+//	1. the snapshot interval doubles, up to the longest interval the minimum snapshot rate allows
+//	2. once at that interval, snapshots are sent at compact precision
+// Back-offs are spaced at least a round trip apart, so the pacer sees the effect of one before
+// making the next.
+//
+// Once the link has been clear for RECOVER_TIME the pacer recovers one step at a time, precision
+// first and then one tick of interval at a time, so it creeps back up to the full rate rather than
+// jumping straight back into congestion.
+//
+// A snapshot that carries an event the client can't miss, a score, a health change, the start or
+// end of the game, or the health pack appearing or being taken, is always sent.
+//
+// The SnapshotPacer is only used by the thread stepping the match, so it needs no lock.
+// ================================================================================================
+
+#ifndef SNAPSHOTPACER_H
+#define SNAPSHOTPACER_H
+
+#include "ServerConfig.h"
+#include "GameData.h"
+#include "NetTime.h"
+#include "LinkTelemetry.h"
+
+class SnapshotPacer
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Constructor/Destructor Prototypes
+	SnapshotPacer(const ServerConfig *config);
+	~SnapshotPacer(void){}
+
+	// Method Prototypes
+	bool ShouldSend(const GameData &state, NetTime now, int queueDepth, const LinkStats &stats);
+	void Reset(NetTime now);
+
+	// Inlined Methods
+	int GetInterval(void){ return m_interval; }
+	sf::Uint8 GetPrecision(void){ return m_precision; }
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	// Constants
+	static const int QUEUE_LIMIT;			// Packets that may wait in the out queue before backing off
+	static const int RTT_MARGIN;			// Time, in ms, the round trip may grow before backing off
+	static const int MIN_BACKOFF_SPACING;	// Least time, in ms, between back-offs
+	static const int RECOVER_TIME;			// Time, in ms, the link must be clear for each step back up
+
+private:
+
+	bool IsCongested(int queueDepth, const LinkStats &stats);
+	bool HasEvent(const GameData &state);
+	void BackOff(NetTime now, const LinkStats &stats);
+	void Recover(NetTime now);
+
+	const ServerConfig *m_config;
+	int m_maxInterval;				// Longest interval, in ticks, the minimum snapshot rate allows
+	int m_interval;					// Ticks between snapshots
+	int m_ticksSinceSend;
+	sf::Uint8 m_precision;			// One of the GameData::Precision values
+	NetTime m_lastBackOff;
+	NetTime m_lastChange;			// When the pacer last backed off or recovered a step
+	GameData m_lastSent;
+	bool m_hasSent;
+};
+
+#endif
@@ -0,0 +1,238 @@
+// ================================================================================================
+// Filename: "ClockSyncTests.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file holds the ClockSync suite. Each TimeSync round is built from the true clock offset at
+// the client's time and the delay on each leg, so the offset a round measures is off by half the
+// difference between the legs.
+// ================================================================================================
+
+#include <cmath>
+#include "TestHarness.h"
+#include "ClockSync.h"
+
+// ===== MakeRound ================================================================================
+// Function will build a completed TimeSync round. The client answers the moment the request
+// arrives.
+//
+// Input:
+//	[IN] NetTime clientTime		- the client time the request arrives and is answered
+//	[IN] NetTime offset			- the true server time minus client time
+//	[IN] NetTime downDelay		- time the request takes to reach the client
+//	[IN] NetTime upDelay		- time the answer takes to reach the server
+//
+// Output:
+//	[OUT] TimeSync				- the round, with all four times stamped
+// ================================================================================================
+static TimeSync MakeRound(NetTime clientTime, NetTime offset, NetTime downDelay, NetTime upDelay)
+{
+	TimeSync round;
+
+	round.serverSendTime = (clientTime + offset - downDelay);
+	round.clientRecieveTime = clientTime;
+	round.clientSendTime = clientTime;
+	round.serverReceivedTime = (clientTime + offset + upDelay);
+
+	return round;
+}
+
+// ===== TestLowestRoundTrip ======================================================================
+// Function will check that the estimate follows the round with the lowest round trip, and ignores
+// rounds whose answer was queued on the way back.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestLowestRoundTrip(void)
+{
+	ClockSync clockSync;
+	NetTime offset = 250000;
+	NetTime clientTime = 1000000;
+
+	CHECK(!clockSync.GetEstimate().valid);
+
+	clockSync.AddSample(MakeRound(clientTime, offset, 5000, 5000));
+
+	CHECK(clockSync.GetEstimate().valid);
+	CHECK(clockSync.GetEstimate().offset == offset);
+
+	// Answers queued for 80ms measure the offset 40ms high
+	for(int i = 0; i < 10; i++)
+	{
+		clientTime += 100000;
+		clockSync.AddSample(MakeRound(clientTime, offset, 5000, 85000));
+	}
+
+	ClockEstimate estimate = clockSync.GetEstimate();
+
+	CHECK(clockSync.GetSampleCount() == 11);
+	CHECK(estimate.offset == offset);
+	CHECK(estimate.roundTripTime == 10000);
+	CHECK(estimate.uncertainty == 5000);
+	CHECK(clockSync.ToServerTime(clientTime) == (clientTime + offset));
+
+	// Once the fast round leaves the window the best of the rest is trusted
+	for(unsigned int i = 0; i < ClockSync::WINDOW_SIZE; i++)
+	{
+		clientTime += 100000;
+		clockSync.AddSample(MakeRound(clientTime, offset, 5000, 85000));
+	}
+
+	CHECK(clockSync.GetEstimate().roundTripTime == 90000);
+	CHECK(clockSync.GetEstimate().offset > offset);
+}
+
+// ===== TestSmoothing ============================================================================
+// Function will check that a change in the offset is followed a SMOOTHING step at a time, with the
+// correction still to come counted in the uncertainty.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestSmoothing(void)
+{
+	ClockSync clockSync;
+	NetTime clientTime = 1000000;
+
+	clockSync.AddSample(MakeRound(clientTime, 100000, 5000, 5000));
+
+	// The client clock is stepped back 100ms, seen by faster rounds
+	clientTime += 100000;
+	clockSync.AddSample(MakeRound(clientTime, 200000, 2000, 2000));
+
+	ClockEstimate estimate = clockSync.GetEstimate();
+
+	CHECK(estimate.offset == 125000);
+	CHECK(estimate.uncertainty == (2000 + 75000));
+
+	NetTime lastOffset = estimate.offset;
+	bool approaching = true;
+
+	for(int i = 0; i < 40; i++)
+	{
+		clientTime += 100000;
+		clockSync.AddSample(MakeRound(clientTime, 200000, 2000, 2000));
+
+		approaching = (approaching && (clockSync.GetEstimate().offset >= lastOffset));
+		lastOffset = clockSync.GetEstimate().offset;
+	}
+
+	estimate = clockSync.GetEstimate();
+
+	CHECK(approaching);
+	CHECK(estimate.offset <= 200000);
+	CHECK(estimate.offset > (200000 - 100));
+	CHECK(estimate.uncertainty < (2000 + 100));
+
+	// Clock resolution can make a very short round look negative, it is taken as instant
+	TimeSync instant = MakeRound((clientTime + 100000), 200000, 50, 50);
+
+	instant.clientSendTime += 300;
+	clockSync.AddSample(instant);
+
+	CHECK(clockSync.GetEstimate().roundTripTime == 0);
+
+	clockSync.Reset();
+
+	CHECK(!clockSync.GetEstimate().valid);
+	CHECK(clockSync.GetSampleCount() == 0);
+}
+
+// ===== DriftingOffset ===========================================================================
+// Function will give the true offset of a client clock that drifts at a steady rate.
+//
+// Input:
+//	[IN] NetTime clientTime		- the client time
+//	[IN] double skew			- the rate the offset changes per unit of client time
+//
+// Output:
+//	[OUT] NetTime				- the offset at the client time
+// ================================================================================================
+static NetTime DriftingOffset(NetTime clientTime, double skew)
+{
+	return (300000 + (NetTime)(skew * clientTime));
+}
+
+// ===== TestSkewFit ==============================================================================
+// Function will check that the skew is fit once the history spans MIN_SKEW_SPAN, through the
+// faster rounds only, and that the estimate then maps client times ahead of the last round.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestSkewFit(void)
+{
+	ClockSync clockSync;
+	double skew = 0.0002;
+	NetTime clientTime = 0;
+	int agreed = 0;
+	int rounds = 0;
+
+	// A round a second, every third one queued for 60ms on the way back
+	for(rounds = 0; rounds < 40; rounds++)
+	{
+		clientTime += 1000000;
+
+		NetTime queued = (((rounds % 3) == 2) ? 60000 : 0);
+
+		agreed += (clockSync.AddSample(MakeRound(clientTime, DriftingOffset(clientTime, skew), 5000, (5000 + queued))) ? 1 : 0);
+
+		if(rounds == 5)
+		{
+			CHECK(clockSync.GetEstimate().skew == 0);	// Only 5 seconds of history
+		}
+	}
+
+	ClockEstimate estimate = clockSync.GetEstimate();
+	NetTime ahead = (clientTime + 8000000);
+
+	CHECK(agreed == rounds);
+	CHECK(std::fabs(estimate.skew - skew) < 0.000001);
+	CHECK(std::llabs(estimate.ToServerTime(ahead) - (ahead + DriftingOffset(ahead, skew))) < 100);
+
+	// A clock stepped by 50ms doesn't agree
+	clientTime += 1000000;
+
+	CHECK(!clockSync.AddSample(MakeRound(clientTime, (DriftingOffset(clientTime, skew) + 50000), 5000, 5000)));
+}
+
+// ===== TestSkewLimit ============================================================================
+// Function will check that a skew beyond MAX_SKEW, either way, is held at the limit.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestSkewLimit(void)
+{
+	ClockSync fast;
+	ClockSync slow;
+	NetTime clientTime = 0;
+
+	for(int i = 0; i < 20; i++)
+	{
+		clientTime += 1000000;
+		fast.AddSample(MakeRound(clientTime, DriftingOffset(clientTime, 0.002), 5000, 5000));
+		slow.AddSample(MakeRound(clientTime, DriftingOffset(clientTime, -0.002), 5000, 5000));
+	}
+
+	CHECK(fast.GetEstimate().skew == ClockSync::MAX_SKEW);
+	CHECK(slow.GetEstimate().skew == -ClockSync::MAX_SKEW);
+}
+
+// ===== RunClockSyncTests ========================================================================
+// Function will run the ClockSync suite.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RunClockSyncTests(void)
+{
+	TestHarness::BeginSuite("ClockSync");
+
+	TestLowestRoundTrip();
+	TestSmoothing();
+	TestSkewFit();
+	TestSkewLimit();
+}
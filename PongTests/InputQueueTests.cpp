@@ -0,0 +1,218 @@
+// ================================================================================================
+// Filename: "InputQueueTests.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file holds the InputQueue suite. Paddle updates are stamped a tick apart on the client's
+// clock and arrive TRANSIT later on the server's, plus any extra delay, so the clock offset
+// cancels out of the jitter.
+// ================================================================================================
+
+#include "TestHarness.h"
+#include "InputQueue.h"
+#include "GameData.h"
+
+// Scenario Constants
+static const NetTime TRANSIT = 30000;
+static const sf::Uint32 NEAR_WRAP = 0xFFFFFFFD;		// Three sequences short of wrapping to 0
+
+// ===== PushUpdate ===============================================================================
+// Function will push the update with a sequence, stamped as if a sequence were sent every tick.
+//
+// Input:
+//	[IN/OUT] InputQueue &queue	- the queue
+//	[IN] sf::Uint32 sequence	- the update's sequence
+//	[IN] NetTime delay			- time spent queued on top of the transit time
+//
+// Output:
+//	[OUT] bool					- the result of the push
+// ================================================================================================
+static bool PushUpdate(InputQueue &queue, sf::Uint32 sequence, NetTime delay)
+{
+	PaddleUpdate update;
+
+	update.m_sequence = sequence;
+	update.m_timestamp = ((sf::Uint32)(sequence - NEAR_WRAP) * TimeBase::FromMilliseconds(GameData::ENGINE_SPEED));
+
+	return queue.Push(update, (update.m_timestamp + TRANSIT + delay));
+}
+
+// ===== TestWraparound ===========================================================================
+// Function will check the counters as the sequence wraps through 0: a gap counted as dropped until
+// it is filled, a repeat counted as duplicated, and updates handed out in sequence order.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestWraparound(void)
+{
+	InputQueue queue;
+	std::list<PaddleUpdate> taken;
+
+	// 0xFFFFFFFD, 0xFFFFFFFE, 0xFFFFFFFF, 0, then 1 is lost for now
+	for(sf::Uint32 sequence = NEAR_WRAP; sequence != 1; sequence++)
+	{
+		CHECK(PushUpdate(queue, sequence, 0));
+	}
+
+	CHECK(PushUpdate(queue, 2, 0));
+	CHECK(queue.GetStats().dropped == 1);
+
+	CHECK(!PushUpdate(queue, 2, 0));
+	CHECK(queue.GetStats().duplicated == 1);
+
+	// The gap is filled before the engine reaches it
+	CHECK(PushUpdate(queue, 1, 0));
+
+	InputStats stats = queue.GetStats();
+
+	CHECK(stats.received == 7);
+	CHECK(stats.dropped == 0);
+	CHECK(stats.late == 0);
+	CHECK(stats.depth == 6);
+
+	// Well over the target, so the engine takes all it can
+	CHECK(queue.Take(taken, InputQueue::MAX_INPUTS));
+	CHECK(taken.size() == 6);
+
+	sf::Uint32 expected = NEAR_WRAP;
+
+	for(std::list<PaddleUpdate>::iterator it = taken.begin(); it != taken.end(); it++, expected++)
+	{
+		CHECK(it->m_sequence == expected);
+	}
+
+	// Already given to the engine
+	CHECK(!PushUpdate(queue, 0, 0));
+	CHECK(queue.GetStats().duplicated == 2);
+
+	// 3 is lost, and by the time it turns up the engine has moved past it
+	taken.clear();
+
+	CHECK(PushUpdate(queue, 4, 0));
+	CHECK(queue.Take(taken, InputQueue::MAX_INPUTS));
+	CHECK(!PushUpdate(queue, 3, 0));
+
+	stats = queue.GetStats();
+
+	CHECK(stats.late == 1);
+	CHECK(stats.dropped == 1);
+	CHECK(stats.duplicated == 2);
+	CHECK(stats.received == 10);
+}
+
+// ===== TestOverflow =============================================================================
+// Function will check that once MAX_INPUTS are queued the oldest are dropped, and can't be
+// queued again.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestOverflow(void)
+{
+	InputQueue queue;
+	sf::Uint32 sequence = NEAR_WRAP;
+
+	for(int i = 0; i < (InputQueue::MAX_INPUTS + 3); i++, sequence++)
+	{
+		PushUpdate(queue, sequence, 0);
+	}
+
+	InputStats stats = queue.GetStats();
+
+	CHECK(stats.depth == InputQueue::MAX_INPUTS);
+	CHECK(stats.dropped == 3);
+
+	// A sequence that was pushed out is still remembered as received
+	CHECK(!PushUpdate(queue, (NEAR_WRAP + 1), 0));
+	CHECK(queue.GetStats().depth == InputQueue::MAX_INPUTS);
+	CHECK(queue.GetStats().duplicated == 1);
+}
+
+// ===== HeldUp ===================================================================================
+// Function will give the extra delay of every other update.
+//
+// Input:
+//	[IN] sf::Uint32 sequence	- the update's sequence
+//
+// Output:
+//	[OUT] NetTime				- 30ms for odd sequences, none for even ones
+// ================================================================================================
+static NetTime HeldUp(sf::Uint32 sequence)
+{
+	return (((sequence % 2) == 1) ? 30000 : 0);
+}
+
+// ===== TestStarved ==============================================================================
+// Function will check that the buffer fills to the target depth before the engine is given any
+// updates, that the target follows the arrival jitter, and that an update the engine ran dry
+// waiting for is counted as late.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestStarved(void)
+{
+	InputQueue queue;
+	std::list<PaddleUpdate> taken;
+	sf::Uint32 sequence = NEAR_WRAP;
+
+	for(int i = 0; i < 100; i++, sequence++)
+	{
+		PushUpdate(queue, sequence, HeldUp(sequence));
+		queue.Take(taken, 1);
+	}
+
+	InputStats stats = queue.GetStats();
+
+	CHECK(stats.jitter > 25000);
+	CHECK(stats.targetDepth > 1);
+	CHECK(stats.targetDepth <= InputQueue::MAX_DEPTH);
+
+	// Drain the buffer, so the engine is left waiting
+	taken.clear();
+
+	while(queue.Take(taken, InputQueue::MAX_INPUTS))
+	{
+		taken.clear();
+	}
+
+	CHECK(!queue.Take(taken, 1));
+
+	sf::Uint32 lateBefore = queue.GetStats().late;
+
+	CHECK(PushUpdate(queue, sequence, HeldUp(sequence)));
+	CHECK(queue.GetStats().late == (lateBefore + 1));
+
+	// Nothing more is given until the buffer is back up to the target
+	int refilled = 1;
+
+	while(queue.GetStats().depth < queue.GetStats().targetDepth)
+	{
+		CHECK(!queue.Take(taken, 1));
+
+		sequence++;
+		PushUpdate(queue, sequence, HeldUp(sequence));
+		refilled++;
+	}
+
+	CHECK(refilled > 1);
+	CHECK(queue.Take(taken, 1));
+	CHECK(taken.size() == 1);
+}
+
+// ===== RunInputQueueTests =======================================================================
+// Function will run the InputQueue suite.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RunInputQueueTests(void)
+{
+	TestHarness::BeginSuite("InputQueue");
+
+	TestWraparound();
+	TestOverflow();
+	TestStarved();
+}
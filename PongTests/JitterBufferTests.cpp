@@ -0,0 +1,241 @@
+// ================================================================================================
+// Filename: "JitterBufferTests.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file holds the JitterBuffer suite. The server sends a snapshot every engine tick, each one
+// taking at least TRANSIT to arrive on a local clock that is CLOCK_OFFSET behind the server's, so
+// the buffer's clock offset estimate settles on CLOCK_OFFSET - TRANSIT.
+// ================================================================================================
+
+#include <cmath>
+#include "TestHarness.h"
+#include "JitterBuffer.h"
+
+// Scenario Constants
+static const NetTime SERVER_START = 10000000;
+static const NetTime CLOCK_OFFSET = 500000;
+static const NetTime TRANSIT = 20000;
+
+// ===== MakeSnapshot =============================================================================
+// Function will build the snapshot the server sent for a tick.
+//
+// Input:
+//	[IN] int tick		- the server tick
+//
+// Output:
+//	[OUT] GameData		- the snapshot, with its' server time set
+// ================================================================================================
+static GameData MakeSnapshot(int tick)
+{
+	GameData snapshot;
+
+	snapshot.serverTick = tick;
+	snapshot.serverTime = (SERVER_START + (tick * TimeBase::FromMilliseconds(GameData::ENGINE_SPEED)));
+
+	return snapshot;
+}
+
+// ===== ArrivalTime ==============================================================================
+// Function will give the local time a snapshot arrives at, with an optional extra delay.
+//
+// Input:
+//	[IN] const GameData &snapshot	- the snapshot
+//	[IN] NetTime delay				- time spent queued on top of the transit time
+//
+// Output:
+//	[OUT] NetTime					- the local arrival time
+// ================================================================================================
+static NetTime ArrivalTime(const GameData &snapshot, NetTime delay)
+{
+	return (snapshot.serverTime - CLOCK_OFFSET + TRANSIT + delay);
+}
+
+// ===== LocalTimeFor =============================================================================
+// Function will give the local time at which the buffer renders a given server time.
+//
+// Input:
+//	[IN] JitterBuffer &buffer	- the buffer
+//	[IN] NetTime renderTime		- the server time to render
+//
+// Output:
+//	[OUT] NetTime				- the local time
+// ================================================================================================
+static NetTime LocalTimeFor(JitterBuffer &buffer, NetTime renderTime)
+{
+	return (renderTime - CLOCK_OFFSET + TRANSIT + buffer.GetPlayoutDelay());
+}
+
+// ===== TestBracket ==============================================================================
+// Function will check that the snapshots either side of the render time are picked, with the blend
+// factor for how far between them it falls, and that the older ones are released.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestBracket(void)
+{
+	JitterBuffer buffer;
+	GameData older;
+	GameData newer;
+	float alpha = -1;
+
+	for(int tick = 0; tick < 6; tick++)
+	{
+		GameData snapshot = MakeSnapshot(tick);
+
+		CHECK(buffer.Insert(snapshot, ArrivalTime(snapshot, 0)));
+	}
+
+	CHECK(buffer.GetPlayoutDelay() == TimeBase::FromMilliseconds(JitterBuffer::MIN_PLAYOUT_DELAY));
+
+	// A quarter of the way from tick 2 to tick 3
+	NetTime renderTime = (MakeSnapshot(2).serverTime + (TimeBase::FromMilliseconds(GameData::ENGINE_SPEED) / 4));
+
+	CHECK(buffer.GetBracket(LocalTimeFor(buffer, renderTime), older, newer, alpha));
+	CHECK(older.serverTick == 2);
+	CHECK(newer.serverTick == 3);
+	CHECK(std::fabs(alpha - 0.25f) < 0.001f);
+
+	// Ticks 0 and 1 were released, and can't come back
+	GameData released = MakeSnapshot(1);
+
+	CHECK(!buffer.Insert(released, ArrivalTime(released, 0)));
+
+	// Exactly on a snapshot
+	CHECK(buffer.GetBracket(LocalTimeFor(buffer, MakeSnapshot(4).serverTime), older, newer, alpha));
+	CHECK(older.serverTick == 4);
+	CHECK(newer.serverTick == 5);
+	CHECK(alpha == 0);
+}
+
+// ===== TestEdges ================================================================================
+// Function will check the render time falling before the oldest snapshot and past the newest.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestEdges(void)
+{
+	JitterBuffer buffer;
+	GameData older;
+	GameData newer;
+	GameData latest;
+	float alpha = -1;
+
+	CHECK(!buffer.GetBracket(0, older, newer, alpha));
+	CHECK(!buffer.GetLatest(latest));
+
+	for(int tick = 10; tick < 13; tick++)
+	{
+		GameData snapshot = MakeSnapshot(tick);
+
+		buffer.Insert(snapshot, ArrivalTime(snapshot, 0));
+	}
+
+	// Before the oldest, hold it
+	CHECK(buffer.GetBracket(LocalTimeFor(buffer, MakeSnapshot(9).serverTime), older, newer, alpha));
+	CHECK(older.serverTick == 10);
+	CHECK(newer.serverTick == 10);
+	CHECK(alpha == 0);
+
+	// Past the newest, hold it and report running out
+	CHECK(!buffer.GetBracket(LocalTimeFor(buffer, MakeSnapshot(14).serverTime), older, newer, alpha));
+	CHECK(older.serverTick == 12);
+	CHECK(newer.serverTick == 12);
+	CHECK(buffer.GetLatest(latest));
+	CHECK(latest.serverTick == 12);
+}
+
+// ===== TestReordering ===========================================================================
+// Function will check that snapshots arriving out of order are slotted into tick order and that a
+// duplicate is dropped.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestReordering(void)
+{
+	JitterBuffer buffer;
+	GameData older;
+	GameData newer;
+	float alpha = -1;
+	int order[] = {0, 2, 1, 4, 3};
+
+	for(int i = 0; i < 5; i++)
+	{
+		GameData snapshot = MakeSnapshot(order[i]);
+
+		CHECK(buffer.Insert(snapshot, ArrivalTime(snapshot, 0)));
+	}
+
+	GameData duplicate = MakeSnapshot(2);
+
+	CHECK(!buffer.Insert(duplicate, ArrivalTime(duplicate, 0)));
+
+	for(int tick = 0; tick < 4; tick++)
+	{
+		CHECK(buffer.GetBracket(LocalTimeFor(buffer, MakeSnapshot(tick).serverTime + 1), older, newer, alpha));
+		CHECK(older.serverTick == tick);
+		CHECK(newer.serverTick == (tick + 1));
+	}
+}
+
+// ===== TestPlayoutDelay =========================================================================
+// Function will check that the playout delay grows with the arrival jitter, up to its' maximum.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestPlayoutDelay(void)
+{
+	JitterBuffer buffer;
+	int tick = 0;
+
+	// Every other snapshot queued for 20ms
+	for(int i = 0; i < 200; i++, tick++)
+	{
+		GameData snapshot = MakeSnapshot(tick);
+
+		buffer.Insert(snapshot, ArrivalTime(snapshot, (((i % 2) == 0) ? 0 : TimeBase::FromMilliseconds(20))));
+	}
+
+	NetTime delay = buffer.GetPlayoutDelay();
+
+	CHECK(buffer.GetJitter() > TimeBase::FromMilliseconds(15));
+	CHECK(delay > TimeBase::FromMilliseconds(GameData::ENGINE_SPEED + 45));
+	CHECK(delay < TimeBase::FromMilliseconds(JitterBuffer::MAX_PLAYOUT_DELAY));
+
+	// Every other snapshot queued for 150ms
+	for(int i = 0; i < 200; i++, tick++)
+	{
+		GameData snapshot = MakeSnapshot(tick);
+
+		buffer.Insert(snapshot, ArrivalTime(snapshot, (((i % 2) == 0) ? 0 : TimeBase::FromMilliseconds(150))));
+	}
+
+	CHECK(buffer.GetPlayoutDelay() == TimeBase::FromMilliseconds(JitterBuffer::MAX_PLAYOUT_DELAY));
+
+	// Clear starts over at the minimum
+	buffer.Clear();
+
+	CHECK(buffer.IsEmpty());
+	CHECK(buffer.GetPlayoutDelay() == TimeBase::FromMilliseconds(JitterBuffer::MIN_PLAYOUT_DELAY));
+}
+
+// ===== RunJitterBufferTests =====================================================================
+// Function will run the JitterBuffer suite.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RunJitterBufferTests(void)
+{
+	TestHarness::BeginSuite("JitterBuffer");
+
+	TestBracket();
+	TestEdges();
+	TestReordering();
+	TestPlayoutDelay();
+}
@@ -0,0 +1,226 @@
+// ================================================================================================
+// Filename: "RollbackSessionTests.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file holds the RollbackSession suite. The session plays player one, four ticks ahead of the
+// server, and holds its' paddle up from tick 5 on with input sequences 1 to 6. The server's side
+// is a SimState stepped with the inputs it really had, and its' snapshots are built from that.
+// ================================================================================================
+
+#include "TestHarness.h"
+#include "RollbackSession.h"
+#include "Paddle.h"
+
+// Scenario Constants
+static const int LEAD = 4;
+static const int FIRST_INPUT_TICK = 5;
+static const int PRESENT_TICK = 10;
+
+// ===== StartSession =============================================================================
+// Function will start a session from tick 0 and advance it to PRESENT_TICK, holding the paddle up
+// from FIRST_INPUT_TICK.
+//
+// Input:
+//	[IN/OUT] RollbackSession &session	- the session
+//	[IN] const GameData &start			- the snapshot of tick 0
+//
+// Output: none
+// ================================================================================================
+static void StartSession(RollbackSession &session, const GameData &start)
+{
+	session.Reset(start, LEAD);
+
+	for(int tick = FIRST_INPUT_TICK; tick <= PRESENT_TICK; tick++)
+	{
+		session.Advance(Paddle::UP, (sf::Uint32)(tick - FIRST_INPUT_TICK + 1));
+	}
+}
+
+// ===== StepState ================================================================================
+// Function will step a state a number of ticks with the same inputs.
+//
+// Input:
+//	[IN/OUT] SimState &state	- the state
+//	[IN] int ticks				- the number of ticks
+//	[IN] int playerOne			- player one's direction
+//	[IN] int playerTwo			- player two's direction
+//
+// Output: none
+// ================================================================================================
+static void StepState(SimState &state, int ticks, int playerOne, int playerTwo)
+{
+	for(int i = 0; i < ticks; i++)
+	{
+		state.Step(playerOne, playerTwo);
+	}
+}
+
+// ===== MakeSnapshot =============================================================================
+// Function will build the server's snapshot of a state.
+//
+// Input:
+//	[IN] const SimState &state		- the server's state
+//	[IN] int playerTwoDirection		- the opponent's direction at that tick
+//	[IN] sf::Uint32 lastInput		- the last of player one's inputs the server has applied
+//
+// Output:
+//	[OUT] GameData					- the snapshot
+// ================================================================================================
+static GameData MakeSnapshot(const SimState &state, int playerTwoDirection, sf::Uint32 lastInput)
+{
+	GameData snapshot;
+
+	snapshot.serverTick = state.serverTick;
+	snapshot.playerOneScore = state.playerOneScore;
+	snapshot.playerTwoScore = state.playerTwoScore;
+	snapshot.playerOneHealth = state.playerOneHealth;
+	snapshot.playerTwoHealth = state.playerTwoHealth;
+	snapshot.playerTwoDirection = playerTwoDirection;
+	snapshot.playerOneLastInput = lastInput;
+	state.ApplyPositions(snapshot);
+
+	return snapshot;
+}
+
+// ===== TestPredictionHeld =======================================================================
+// Function will check that a snapshot matching the prediction rolls nothing back.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestPredictionHeld(void)
+{
+	RollbackSession session(1);
+	GameData start;
+	SimState server = SimState::FromGameData(start);
+
+	CHECK(!session.IsStarted());
+
+	StartSession(session, start);
+
+	CHECK(session.IsStarted());
+	CHECK(session.GetPresent().serverTick == PRESENT_TICK);
+
+	StepState(server, 3, Paddle::STILL, Paddle::STILL);
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::STILL, 0)) == 0);
+	CHECK(session.GetPresent().serverTick == PRESENT_TICK);
+}
+
+// ===== TestOpponentMisprediction ================================================================
+// Function will check that when the opponent turns out to have been moving, the session restores
+// the snapshot's tick and simulates every tick up to the present again with the opponent's real
+// direction and this client's own inputs, then goes on predicting the new direction.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestOpponentMisprediction(void)
+{
+	RollbackSession session(1);
+	GameData start;
+	SimState server = SimState::FromGameData(start);
+
+	StartSession(session, start);
+
+	// The opponent held down from tick 1, and none of the inputs have reached the server
+	StepState(server, 3, Paddle::STILL, Paddle::DOWN);
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::DOWN, 0)) == (PRESENT_TICK - 3));
+
+	// What the present should be
+	SimState expected = server;
+
+	StepState(expected, (FIRST_INPUT_TICK - 4), Paddle::STILL, Paddle::DOWN);
+	StepState(expected, (PRESENT_TICK - FIRST_INPUT_TICK + 1), Paddle::UP, Paddle::DOWN);
+
+	CHECK(session.GetPresent().serverTick == PRESENT_TICK);
+	CHECK(session.GetPresent().Matches(expected, 0.001f));
+	CHECK(session.GetPresent().playerTwoPaddlePosition > start.playerTwoPaddlePosition);
+
+	// The opponent is now predicted to keep moving down
+	session.Advance(Paddle::STILL, 7);
+	StepState(expected, 1, Paddle::STILL, Paddle::DOWN);
+
+	CHECK(session.GetPresent().Matches(expected, 0.001f));
+
+	// So the next snapshot holds
+	StepState(server, 1, Paddle::STILL, Paddle::DOWN);
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::DOWN, 0)) == 0);
+}
+
+// ===== TestAcknowledgedInputs ===================================================================
+// Function will check that a rollback replays only this client's inputs the server hadn't applied
+// by the snapshot's tick; the rest are already part of the restored state.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestAcknowledgedInputs(void)
+{
+	RollbackSession session(1);
+	GameData start;
+	SimState server = SimState::FromGameData(start);
+
+	StartSession(session, start);
+
+	// The server applied inputs 1 to 5 at ticks 4 to 8, a tick before the client simulated them
+	StepState(server, (FIRST_INPUT_TICK - 2), Paddle::STILL, Paddle::STILL);
+	StepState(server, 5, Paddle::UP, Paddle::STILL);
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::STILL, 5)) == (PRESENT_TICK - 8));
+
+	// Tick 9 holds input 5, already applied, and tick 10 input 6
+	SimState expected = server;
+
+	StepState(expected, 1, Paddle::STILL, Paddle::STILL);
+	StepState(expected, 1, Paddle::UP, Paddle::STILL);
+
+	CHECK(session.GetPresent().Matches(expected, 0.001f));
+}
+
+// ===== TestDrift ================================================================================
+// Function will check that a snapshot from the session's future, or from further back than
+// MAX_ROLLBACK, starts the session again from it.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestDrift(void)
+{
+	RollbackSession session(1);
+	GameData start;
+	SimState server = SimState::FromGameData(start);
+
+	StartSession(session, start);
+	StepState(server, (PRESENT_TICK + 2), Paddle::STILL, Paddle::STILL);
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::STILL, 0)) == -1);
+	CHECK(session.GetPresent().serverTick == (PRESENT_TICK + 2 + LEAD));
+
+	for(int i = 0; i <= RollbackSession::MAX_ROLLBACK; i++)
+	{
+		session.Advance(Paddle::STILL, 0);
+	}
+
+	CHECK(session.Confirm(MakeSnapshot(server, Paddle::STILL, 0)) == -1);
+}
+
+// ===== RunRollbackSessionTests ==================================================================
+// Function will run the RollbackSession suite.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RunRollbackSessionTests(void)
+{
+	TestHarness::BeginSuite("RollbackSession");
+
+	TestPredictionHeld();
+	TestOpponentMisprediction();
+	TestAcknowledgedInputs();
+	TestDrift();
+}
@@ -0,0 +1,214 @@
+// ================================================================================================
+// Filename: "SnapshotPacerTests.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file holds the SnapshotPacer suite. The pacer is ticked at the engine rate with a made up
+// out queue depth and link measurements, and a minimum snapshot rate that allows four ticks
+// between snapshots.
+// ================================================================================================
+
+#include "TestHarness.h"
+#include "SnapshotPacer.h"
+
+// Scenario Constants
+static const int MIN_SNAPSHOT_RATE = 14;		// (1000 / 14) / 17 = 4 ticks
+static const int LONGEST_INTERVAL = 4;
+
+// ===== RunTicks =================================================================================
+// Function will tick the pacer with the same snapshot and link state.
+//
+// Input:
+//	[IN/OUT] SnapshotPacer &pacer	- the pacer
+//	[IN/OUT] NetTime &now			- the game clock, advanced a tick before each call
+//	[IN] int ticks					- the number of ticks to run
+//	[IN] int queueDepth				- packets waiting in the out queue
+//	[IN] const LinkStats &stats		- the link measurements
+//
+// Output:
+//	[OUT] int						- the number of snapshots sent
+// ================================================================================================
+static int RunTicks(SnapshotPacer &pacer, NetTime &now, int ticks, int queueDepth, const LinkStats &stats)
+{
+	GameData state;
+	int sent = 0;
+
+	for(int i = 0; i < ticks; i++)
+	{
+		now += TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+		sent += (pacer.ShouldSend(state, now, queueDepth, stats) ? 1 : 0);
+	}
+
+	return sent;
+}
+
+// ===== TestBackOff ==============================================================================
+// Function will check that a backed up out queue doubles the interval no more than once per
+// MIN_BACKOFF_SPACING, up to the minimum snapshot rate, then drops to compact precision, and that
+// a score is still sent at once.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestBackOff(void)
+{
+	ServerConfig config;
+	config.minSnapshotRate = MIN_SNAPSHOT_RATE;
+
+	SnapshotPacer pacer(&config);
+	LinkStats stats;
+	NetTime now = 0;
+	int backedUp = (SnapshotPacer::QUEUE_LIMIT + 1);
+
+	CHECK(RunTicks(pacer, now, 10, 0, stats) == 10);
+	CHECK(pacer.GetInterval() == 1);
+
+	// MIN_BACKOFF_SPACING, 100ms, is six ticks
+	pacer.Reset(now);
+	RunTicks(pacer, now, 5, backedUp, stats);
+
+	CHECK(pacer.GetInterval() == 1);
+
+	RunTicks(pacer, now, 1, backedUp, stats);
+
+	CHECK(pacer.GetInterval() == 2);
+
+	RunTicks(pacer, now, 6, backedUp, stats);
+
+	CHECK(pacer.GetInterval() == LONGEST_INTERVAL);
+	CHECK(pacer.GetPrecision() == GameData::FULL_PRECISION);
+
+	RunTicks(pacer, now, 6, backedUp, stats);
+
+	CHECK(pacer.GetInterval() == LONGEST_INTERVAL);
+	CHECK(pacer.GetPrecision() == GameData::COMPACT_PRECISION);
+
+	// Every fourth snapshot goes out
+	CHECK(RunTicks(pacer, now, (10 * LONGEST_INTERVAL), backedUp, stats) == 10);
+
+	// Unless there is something the client can't miss, even the tick after a send
+	GameData scored;
+	scored.playerOneScore = 1;
+	bool sent = false;
+
+	while(!sent)
+	{
+		sent = (RunTicks(pacer, now, 1, backedUp, stats) > 0);
+	}
+
+	now += TimeBase::FromMilliseconds(GameData::ENGINE_SPEED);
+
+	CHECK(pacer.ShouldSend(scored, now, backedUp, stats));
+}
+
+// ===== TestRecover ==============================================================================
+// Function will check that once the link is clear the pacer steps back up once per RECOVER_TIME:
+// full precision first, then a tick off the interval at a time.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestRecover(void)
+{
+	ServerConfig config;
+	config.minSnapshotRate = MIN_SNAPSHOT_RATE;
+
+	SnapshotPacer pacer(&config);
+	LinkStats stats;
+	NetTime now = 0;
+
+	RunTicks(pacer, now, 30, (SnapshotPacer::QUEUE_LIMIT + 1), stats);
+
+	CHECK(pacer.GetPrecision() == GameData::COMPACT_PRECISION);
+
+	// RECOVER_TIME, 500ms, is thirty ticks
+	RunTicks(pacer, now, 29, 0, stats);
+
+	CHECK(pacer.GetPrecision() == GameData::COMPACT_PRECISION);
+
+	RunTicks(pacer, now, 1, 0, stats);
+
+	CHECK(pacer.GetPrecision() == GameData::FULL_PRECISION);
+	CHECK(pacer.GetInterval() == LONGEST_INTERVAL);
+
+	for(int interval = (LONGEST_INTERVAL - 1); interval > 0; interval--)
+	{
+		RunTicks(pacer, now, 30, 0, stats);
+
+		CHECK(pacer.GetInterval() == interval);
+	}
+
+	// A backed up tick steps down, and recovery waits RECOVER_TIME from there
+	RunTicks(pacer, now, 1, (SnapshotPacer::QUEUE_LIMIT + 1), stats);
+
+	CHECK(pacer.GetInterval() == 2);
+
+	RunTicks(pacer, now, 29, 0, stats);
+
+	CHECK(pacer.GetInterval() == 2);
+
+	RunTicks(pacer, now, 1, 0, stats);
+
+	CHECK(pacer.GetInterval() == 1);
+
+	// Reset goes straight back to the full rate
+	RunTicks(pacer, now, 30, (SnapshotPacer::QUEUE_LIMIT + 1), stats);
+	pacer.Reset(now);
+
+	CHECK(pacer.GetInterval() == 1);
+	CHECK(pacer.GetPrecision() == GameData::FULL_PRECISION);
+}
+
+// ===== TestRoundTrip ============================================================================
+// Function will check that a round trip grown past the link's usual variation counts as congested,
+// and that back-offs are then spaced a round trip apart.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+static void TestRoundTrip(void)
+{
+	ServerConfig config;
+	config.minSnapshotRate = MIN_SNAPSHOT_RATE;
+
+	SnapshotPacer pacer(&config);
+	LinkStats stats;
+	NetTime now = 0;
+
+	stats.rttValid = true;
+	stats.minRtt = TimeBase::FromMilliseconds(40);
+	stats.rttVariance = TimeBase::FromMilliseconds(2);
+	stats.smoothedRtt = TimeBase::FromMilliseconds(75);		// Under 40 + 30 + (4 * 2)
+
+	RunTicks(pacer, now, 30, 0, stats);
+
+	CHECK(pacer.GetInterval() == 1);
+
+	// Seven ticks are 119ms, eight are 136ms
+	stats.smoothedRtt = TimeBase::FromMilliseconds(120);
+	pacer.Reset(now);
+
+	RunTicks(pacer, now, 7, 0, stats);
+
+	CHECK(pacer.GetInterval() == 1);
+
+	RunTicks(pacer, now, 1, 0, stats);
+
+	CHECK(pacer.GetInterval() == 2);
+}
+
+// ===== RunSnapshotPacerTests ====================================================================
+// Function will run the SnapshotPacer suite.
+//
+// Input: none
+// Output: none
+// ================================================================================================
+void RunSnapshotPacerTests(void)
+{
+	TestHarness::BeginSuite("SnapshotPacer");
+
+	TestBackOff();
+	TestRecover();
+	TestRoundTrip();
+}
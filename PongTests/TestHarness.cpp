@@ -0,0 +1,70 @@
+// ================================================================================================
+// Filename: "TestHarness.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This is the class implementation file for the TestHarness class. For a class description see the
+// header file "TestHarness.h"
+// ================================================================================================
+
+#include <iostream>
+#include "TestHarness.h"
+
+// Initialize Static Members
+int TestHarness::m_checks = 0;
+int TestHarness::m_failures = 0;
+const char *TestHarness::m_suite = "";
+
+// ===== BeginSuite ===============================================================================
+// Method will announce a suite, so any failures that follow are reported under its' name.
+//
+// Input:
+//	[IN] const char *name	- the suite's name
+//
+// Output: none
+// ================================================================================================
+void TestHarness::BeginSuite(const char *name)
+{
+	m_suite = name;
+
+	std::cout << "Running " << name << "\n";
+}
+
+// ===== Check ====================================================================================
+// Method will count a check, and print it if it failed.
+//
+// Input:
+//	[IN] bool passed				- the result of the check
+//	[IN] const char *expression		- the expression that was checked
+//	[IN] const char *file			- the file the check is in
+//	[IN] int line					- the line the check is on
+//
+// Output: none
+// ================================================================================================
+void TestHarness::Check(bool passed, const char *expression, const char *file, int line)
+{
+	m_checks++;
+
+	if(!passed)
+	{
+		m_failures++;
+
+		std::cout << "  FAILED " << m_suite << ": " << expression << " (" << file << ":" << line << ")\n";
+	}
+}
+
+// ===== PrintSummary =============================================================================
+// Method will print how many checks were run and how many failed.
+//
+// Input: none
+//
+// Output:
+//	[OUT] int	- the process exit code, 0 if every check passed
+// ================================================================================================
+int TestHarness::PrintSummary(void)
+{
+	std::cout << "\n" << m_checks << " checks, " << m_failures << " failed\n";
+
+	return ((m_failures == 0) ? 0 : 1);
+}
@@ -0,0 +1,55 @@
+// ================================================================================================
+// Filename: "TestHarness.h"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// Class Description:
+//
+// The TestHarness class keeps the counts for the test driver. Each suite is a function that sets
+// up one of the pure networking classes, drives it through a scenario with made up times, and
+// checks the results with the CHECK macro. A failed check prints its' expression and location and
+// the run carries on, so one run reports every failure.
+//
+// The suites are declared here and run in turn by TestStart.cpp.
+// ================================================================================================
+
+#ifndef TESTHARNESS_H
+#define TESTHARNESS_H
+
+// Checks a condition, recording the expression and location if it fails
+#define CHECK(condition) TestHarness::Check((condition), #condition, __FILE__, __LINE__)
+
+class TestHarness
+{
+
+public:
+
+	// ============================================================================================
+	// Methods
+	// ============================================================================================
+
+	// Static Methods
+	static void BeginSuite(const char *name);
+	static void Check(bool passed, const char *expression, const char *file, int line);
+	static int PrintSummary(void);
+
+private:
+
+	// ============================================================================================
+	// Class Data Members
+	// ============================================================================================
+
+	static int m_checks;
+	static int m_failures;
+	static const char *m_suite;
+};
+
+// Test Suites
+void RunJitterBufferTests(void);
+void RunClockSyncTests(void);
+void RunSnapshotPacerTests(void);
+void RunRollbackSessionTests(void);
+void RunInputQueueTests(void);
+
+#endif
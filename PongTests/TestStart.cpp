@@ -0,0 +1,23 @@
+// ================================================================================================
+// Filename: "TestStart.cpp"
+// ================================================================================================
+// Author: Travis Smith
+// Last Modified: Oct 18, 2026
+// ================================================================================================
+// This file is where the test driver starts. It runs every suite in turn against the pure
+// networking classes, which keep no sockets or threads of their own, and prints the failed checks.
+// The exit code is 0 only if every check passed.
+// ================================================================================================
+
+#include "TestHarness.h"
+
+int main(int argc, char* argv[])
+{
+	RunJitterBufferTests();
+	RunClockSyncTests();
+	RunSnapshotPacerTests();
+	RunRollbackSessionTests();
+	RunInputQueueTests();
+
+	return TestHarness::PrintSummary();
+}